@@ -0,0 +1,101 @@
+#pragma once
+#include "Tbx/Math/Vectors.h"
+#include "Tbx/Math/Quaternion.h"
+#include "Tbx/Math/Mat4x4.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Helpers to benchmark one API entry point both as a single call and over an array of inputs.
+// MakeInput(i) builds the i-th input, inputs vary with i so the calls can't be folded away.
+// Call(input) calls the function under test and returns its result.
+
+namespace Tbx::Benchmarks
+{
+    template <typename MakeInput, typename Call>
+    void SingleCall(benchmark::State& state, MakeInput makeInput, Call call)
+    {
+        auto input = makeInput(size_t(1));
+        for (auto _ : state)
+        {
+            // Hides the input value from the optimizer so every iteration really makes the call
+            benchmark::DoNotOptimize(input);
+            benchmark::DoNotOptimize(call(input));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template <typename MakeInput, typename Call>
+    void BulkCall(benchmark::State& state, MakeInput makeInput, Call call)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<decltype(makeInput(size_t(0)))> inputs;
+        inputs.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            inputs.push_back(makeInput(i));
+        }
+
+        // Results are stored so the work can't be discarded, bools as bytes to avoid std::vector<bool> bit packing
+        // The first result fills the array so types without a default constructor work too
+        using Result = std::decay_t<decltype(call(inputs[0]))>;
+        std::vector<std::conditional_t<std::is_same_v<Result, bool>, uint8_t, Result>> results(count, call(inputs[0]));
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                results[i] = call(inputs[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    inline float MakeFloat(size_t i)
+    {
+        return 0.25f + static_cast<float>(i % 97) * 0.01f;
+    }
+
+    inline Vector3 MakeVector3(size_t i)
+    {
+        const float f = MakeFloat(i);
+        return Vector3(f, 2.0f - f, 0.5f + f * f);
+    }
+
+    inline Quaternion MakeQuaternion(size_t i)
+    {
+        const float f = static_cast<float>(i % 360);
+        return Quaternion::FromEuler(f, 2.0f * f, 0.5f * f);
+    }
+
+    inline Mat4x4 MakeMat4x4(size_t i)
+    {
+        return Mat4x4::FromTRS(MakeVector3(i), MakeQuaternion(i), MakeVector3(i + 7));
+    }
+
+    template <typename Lhs, typename Rhs>
+    struct Pair
+    {
+        Lhs First;
+        Rhs Second;
+    };
+
+    inline Pair<Vector3, Vector3> MakeVector3Pair(size_t i) { return { MakeVector3(i), MakeVector3(i + 13) }; }
+    inline Pair<Vector3, float> MakeVector3Scalar(size_t i) { return { MakeVector3(i), MakeFloat(i + 5) }; }
+    inline Pair<Quaternion, Quaternion> MakeQuaternionPair(size_t i) { return { MakeQuaternion(i), MakeQuaternion(i + 13) }; }
+    inline Pair<Quaternion, Vector3> MakeQuaternionVector3(size_t i) { return { MakeQuaternion(i), MakeVector3(i + 13) }; }
+    inline Pair<Mat4x4, Mat4x4> MakeMat4x4Pair(size_t i) { return { MakeMat4x4(i), MakeMat4x4(i + 13) }; }
+    inline Pair<Mat4x4, float> MakeMat4x4Scalar(size_t i) { return { MakeMat4x4(i), MakeFloat(i + 5) }; }
+    inline Pair<Mat4x4, Vector3> MakeMat4x4Vector3(size_t i) { return { MakeMat4x4(i), MakeVector3(i + 13) }; }
+}
+
+/// <summary>
+/// Registers a single call benchmark and a bulk benchmark over 1K and 64K inputs for one API entry point.
+/// They show up as SingleCall/name and BulkCall/name/count.
+/// </summary>
+#define TBX_API_BENCHMARK(name, makeInput, call) \
+    BENCHMARK_CAPTURE(SingleCall, name, makeInput, call); \
+    BENCHMARK_CAPTURE(BulkCall, name, makeInput, call)->Arg(1 << 10)->Arg(1 << 16)
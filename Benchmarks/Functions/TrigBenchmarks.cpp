@@ -0,0 +1,87 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/Trig.h"
+#include <vector>
+
+namespace Tbx::Benchmarks
+{
+    TBX_API_BENCHMARK(Math_DegreesToRadians, MakeFloat, [](float f) { return Math::DegreesToRadians(f * 360.0f); });
+    TBX_API_BENCHMARK(Math_RadiansToDegrees, MakeFloat, [](float f) { return Math::RadiansToDegrees(f); });
+    TBX_API_BENCHMARK(Math_Cos, MakeFloat, [](float f) { return Math::Cos(f); });
+    TBX_API_BENCHMARK(Math_Sin, MakeFloat, [](float f) { return Math::Sin(f); });
+    TBX_API_BENCHMARK(Math_Tan, MakeFloat, [](float f) { return Math::Tan(f); });
+    TBX_API_BENCHMARK(Math_ACos, MakeFloat, [](float f) { return Math::ACos(f); });
+    TBX_API_BENCHMARK(Math_ASin, MakeFloat, [](float f) { return Math::ASin(f); });
+    TBX_API_BENCHMARK(Math_ATan, MakeFloat, [](float f) { return Math::ATan(f); });
+    TBX_API_BENCHMARK(Math_FastCos, MakeFloat, [](float f) { return Math::FastCos(f); });
+    TBX_API_BENCHMARK(Math_FastSin, MakeFloat, [](float f) { return Math::FastSin(f); });
+    TBX_API_BENCHMARK(Math_FastTan, MakeFloat, [](float f) { return Math::FastTan(f); });
+    TBX_API_BENCHMARK(Math_FastACos, MakeFloat, [](float f) { return Math::FastACos(f); });
+    TBX_API_BENCHMARK(Math_FastASin, MakeFloat, [](float f) { return Math::FastASin(f); });
+    TBX_API_BENCHMARK(Math_FastATan, MakeFloat, [](float f) { return Math::FastATan(f); });
+    TBX_API_BENCHMARK(Math_SinCos, MakeFloat, [](float f) { float s; float c; Math::SinCos(f, s, c); return s + c; });
+    TBX_API_BENCHMARK(Math_FastSinCos, MakeFloat, [](float f) { float s; float c; Math::FastSinCos(f, s, c); return s + c; });
+
+    static std::vector<float> MakeAngles(size_t count)
+    {
+        std::vector<float> angles(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            angles[i] = static_cast<float>(i % 3607) * 0.01f - 18.0f;
+        }
+        return angles;
+    }
+
+    static void Math_SinCosLoop(benchmark::State& state)
+    {
+        const auto angles = MakeAngles(static_cast<size_t>(state.range(0)));
+        std::vector<float> sin(angles.size());
+        std::vector<float> cos(angles.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < angles.size(); i++)
+            {
+                sin[i] = Math::Sin(angles[i]);
+                cos[i] = Math::Cos(angles[i]);
+            }
+            benchmark::DoNotOptimize(sin.data());
+            benchmark::DoNotOptimize(cos.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Math_SinCosLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Math_SinCosBatch(benchmark::State& state)
+    {
+        const auto angles = MakeAngles(static_cast<size_t>(state.range(0)));
+        std::vector<float> sin(angles.size());
+        std::vector<float> cos(angles.size());
+
+        for (auto _ : state)
+        {
+            Math::SinCosBatch(angles, sin, cos);
+            benchmark::DoNotOptimize(sin.data());
+            benchmark::DoNotOptimize(cos.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Math_SinCosBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void Math_SinBatch(benchmark::State& state)
+    {
+        const auto angles = MakeAngles(static_cast<size_t>(state.range(0)));
+        std::vector<float> sin(angles.size());
+
+        for (auto _ : state)
+        {
+            Math::SinBatch(angles, sin);
+            benchmark::DoNotOptimize(sin.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Math_SinBatch)->Arg(1 << 10)->Arg(100000);
+}
@@ -0,0 +1,3 @@
+#include "PCH.h"
+
+BENCHMARK_MAIN();
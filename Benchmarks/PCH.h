@@ -0,0 +1,4 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <vector>
@@ -0,0 +1,110 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/AABBBuffer.h"
+
+namespace Tbx::Benchmarks
+{
+    static std::vector<AABB> MakeBoxes(size_t count)
+    {
+        std::vector<AABB> boxes(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i % 1000);
+            boxes[i] = AABB::FromCenterExtents(Vector3(f, -0.5f * f, 0.25f * f), Vector3(1.0f + (i % 7), 2.0f, 0.5f));
+        }
+        return boxes;
+    }
+
+    static void AABB_OverlapsLoop(benchmark::State& state)
+    {
+        const auto boxes = MakeBoxes(static_cast<size_t>(state.range(0)));
+        const AABB query({ 100.0f, -300.0f, 0.0f }, { 400.0f, 0.0f, 150.0f });
+        std::vector<uint64> mask((boxes.size() + 63) / 64);
+
+        for (auto _ : state)
+        {
+            std::fill(mask.begin(), mask.end(), 0ull);
+            for (size_t i = 0; i < boxes.size(); i++)
+            {
+                mask[i / 64] |= static_cast<uint64>(AABB::Overlaps(boxes[i], query)) << (i % 64);
+            }
+            benchmark::DoNotOptimize(mask.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(AABB_OverlapsLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void AABBBuffer_Overlaps(benchmark::State& state)
+    {
+        const AABBBuffer buffer(MakeBoxes(static_cast<size_t>(state.range(0))));
+        const AABB query({ 100.0f, -300.0f, 0.0f }, { 400.0f, 0.0f, 150.0f });
+        std::vector<uint64> mask(buffer.GetMaskWordCount());
+
+        for (auto _ : state)
+        {
+            buffer.Overlaps(query, mask);
+            benchmark::DoNotOptimize(mask.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(AABBBuffer_Overlaps)->Arg(1 << 10)->Arg(100000);
+
+    static void AABB_TransformByLoop(benchmark::State& state)
+    {
+        const auto boxes = MakeBoxes(static_cast<size_t>(state.range(0)));
+        const Mat4x4 matrix = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(2.0f));
+        std::vector<AABB> transformed(boxes.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < boxes.size(); i++)
+            {
+                transformed[i] = AABB::TransformBy(boxes[i], matrix);
+            }
+            benchmark::DoNotOptimize(transformed.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(AABB_TransformByLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void AABBBuffer_TransformBy(benchmark::State& state)
+    {
+        const AABBBuffer buffer(MakeBoxes(static_cast<size_t>(state.range(0))));
+        const Mat4x4 matrix = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(2.0f));
+        AABBBuffer transformed;
+
+        for (auto _ : state)
+        {
+            buffer.TransformBy(matrix, transformed);
+            benchmark::DoNotOptimize(transformed.GetMinX().data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(AABBBuffer_TransformBy)->Arg(1 << 10)->Arg(100000);
+
+    static AABB MakeAABB(size_t i)
+    {
+        return AABB::FromCenterExtents(MakeVector3(i), MakeVector3(i + 3));
+    }
+
+    static Pair<AABB, AABB> MakeAABBPair(size_t i) { return { MakeAABB(i), MakeAABB(i + 13) }; }
+    static Pair<AABB, Vector3> MakeAABBVector3(size_t i) { return { MakeAABB(i), MakeVector3(i + 13) }; }
+    static Pair<AABB, Mat4x4> MakeAABBMat4x4(size_t i) { return { MakeAABB(i), MakeMat4x4(i + 13) }; }
+
+    TBX_API_BENCHMARK(AABB_GetCenter, MakeAABB, [](const AABB& box) { return box.GetCenter(); });
+    TBX_API_BENCHMARK(AABB_GetExtents, MakeAABB, [](const AABB& box) { return box.GetExtents(); });
+    TBX_API_BENCHMARK(AABB_GetSize, MakeAABB, [](const AABB& box) { return box.GetSize(); });
+    TBX_API_BENCHMARK(AABB_IsEmpty, MakeAABB, [](const AABB& box) { return box.IsEmpty(); });
+    TBX_API_BENCHMARK(AABB_FromCenterExtents, MakeVector3Pair, [](const auto& in) { return AABB::FromCenterExtents(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_Merge, MakeAABBPair, [](const auto& in) { return AABB::Merge(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_MergePoint, MakeAABBVector3, [](const auto& in) { return AABB::Merge(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_ContainsPoint, MakeAABBVector3, [](const auto& in) { return AABB::Contains(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_ContainsBox, MakeAABBPair, [](const auto& in) { return AABB::Contains(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_Overlaps, MakeAABBPair, [](const auto& in) { return AABB::Overlaps(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_TransformBy, MakeAABBMat4x4, [](const auto& in) { return AABB::TransformBy(in.First, in.Second); });
+    TBX_API_BENCHMARK(AABB_ToString, MakeAABB, [](const AABB& box) { return box.ToString(); });
+}
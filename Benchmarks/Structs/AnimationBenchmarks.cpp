@@ -0,0 +1,123 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/AnimationSampler.h"
+#include <algorithm>
+#include <vector>
+
+namespace Tbx::Benchmarks
+{
+    static constexpr size_t BoneCount = 64;
+    static constexpr int KeyCount = 240;
+    static constexpr float KeyInterval = 1.0f / 30.0f;
+    static constexpr float FrameTime = 1.0f / 60.0f;
+
+    static AnimationClip MakeSkeletonClip()
+    {
+        AnimationClip clip(BoneCount);
+        for (size_t bone = 0; bone < BoneCount; bone++)
+        {
+            for (int key = 0; key < KeyCount; key++)
+            {
+                const float f = static_cast<float>(key + bone);
+                clip.AddPositionKey(bone, static_cast<float>(key) * KeyInterval, Vector3(f * 0.01f, 1.0f, -f * 0.02f));
+                clip.AddRotationKey(bone, static_cast<float>(key) * KeyInterval, Quaternion::FromEuler(f * 3.0f, f * 5.0f, f * 7.0f));
+                clip.AddScaleKey(bone, static_cast<float>(key) * KeyInterval, Vector3(1.0f + f * 0.001f));
+            }
+        }
+        return clip;
+    }
+
+    /// <summary>
+    /// Samples one track the way a sampler without cursors has to, with a binary search for every sample.
+    /// </summary>
+    template <typename Track>
+    static size_t SearchKey(const Track& track, float time, float& outWeight)
+    {
+        const auto next = std::upper_bound(track.Times.begin(), track.Times.end(), time);
+        const size_t key = next == track.Times.begin() ? 0 : static_cast<size_t>(next - track.Times.begin()) - 1;
+        outWeight = key + 1 < track.Size() ? std::clamp((time - track.Times[key]) / (track.Times[key + 1] - track.Times[key]), 0.0f, 1.0f) : 0.0f;
+        return key;
+    }
+
+    static Vector3 LerpKeys(const AnimationClip::Vector3Track& track, float time)
+    {
+        float weight = 0.0f;
+        const size_t key = SearchKey(track, time, weight);
+        const size_t next = std::min(key + 1, track.Size() - 1);
+        return Vector3::Add(track.Get(key), Vector3::Multiply(Vector3::Subtract(track.Get(next), track.Get(key)), weight));
+    }
+
+    static void AnimationClip_SampleBinarySearchLoop(benchmark::State& state)
+    {
+        const AnimationClip clip = MakeSkeletonClip();
+        const auto instances = static_cast<size_t>(state.range(0));
+        std::vector<std::vector<Transform>> poses(instances, std::vector<Transform>(BoneCount));
+        float time = 0.0f;
+
+        for (auto _ : state)
+        {
+            time = time + FrameTime > clip.GetDuration() ? 0.0f : time + FrameTime;
+            for (auto& pose : poses)
+            {
+                for (size_t bone = 0; bone < BoneCount; bone++)
+                {
+                    const auto& rotations = clip.GetRotationTrack(bone);
+                    float weight = 0.0f;
+                    const size_t key = SearchKey(rotations, time, weight);
+                    pose[bone].Position = LerpKeys(clip.GetPositionTrack(bone), time);
+                    pose[bone].Rotation = Quaternion::Slerp(rotations.Get(key), rotations.Get(std::min(key + 1, rotations.Size() - 1)), weight);
+                    pose[bone].Scale = LerpKeys(clip.GetScaleTrack(bone), time);
+                }
+            }
+            benchmark::DoNotOptimize(poses.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * BoneCount);
+    }
+    BENCHMARK(AnimationClip_SampleBinarySearchLoop)->Arg(1)->Arg(100);
+
+    static void AnimationSampler_Sample(benchmark::State& state)
+    {
+        const AnimationClip clip = MakeSkeletonClip();
+        const auto instances = static_cast<size_t>(state.range(0));
+        std::vector<AnimationSampler> samplers(instances, AnimationSampler(clip));
+        std::vector<std::vector<Transform>> poses(instances, std::vector<Transform>(BoneCount));
+        float time = 0.0f;
+
+        for (auto _ : state)
+        {
+            time = time + FrameTime > clip.GetDuration() ? 0.0f : time + FrameTime;
+            for (size_t i = 0; i < instances; i++)
+            {
+                samplers[i].Sample(time, poses[i]);
+            }
+            benchmark::DoNotOptimize(poses.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * BoneCount);
+    }
+    BENCHMARK(AnimationSampler_Sample)->Arg(1)->Arg(100);
+
+    static void AnimationSampler_SampleTransformBuffer(benchmark::State& state)
+    {
+        const AnimationClip clip = MakeSkeletonClip();
+        const auto instances = static_cast<size_t>(state.range(0));
+        std::vector<AnimationSampler> samplers(instances, AnimationSampler(clip));
+        const std::vector<Transform> bindPose(BoneCount);
+        std::vector<TransformBuffer> poses(instances, TransformBuffer(bindPose));
+        float time = 0.0f;
+
+        for (auto _ : state)
+        {
+            time = time + FrameTime > clip.GetDuration() ? 0.0f : time + FrameTime;
+            for (size_t i = 0; i < instances; i++)
+            {
+                samplers[i].Sample(time, poses[i]);
+            }
+            benchmark::DoNotOptimize(poses.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * BoneCount);
+    }
+    BENCHMARK(AnimationSampler_SampleTransformBuffer)->Arg(1)->Arg(100);
+}
@@ -0,0 +1,112 @@
+#include "PCH.h"
+#include "Tbx/Math/BVH.h"
+#include <random>
+
+namespace Tbx::Benchmarks
+{
+    static std::vector<AABB> MakePrimitives(size_t count)
+    {
+        // Keep the density constant so query cost reflects the tree, not how crowded the scene is
+        const float halfSize = 0.5f * std::cbrt(static_cast<float>(count)) * 4.0f;
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> position(-halfSize, halfSize);
+        std::uniform_real_distribution<float> size(0.25f, 1.0f);
+
+        std::vector<AABB> primitives(count);
+        for (auto& primitive : primitives)
+        {
+            primitive = AABB::FromCenterExtents(Vector3(position(random), position(random), position(random)), Vector3(size(random), size(random), size(random)));
+        }
+        return primitives;
+    }
+
+    static void BVH_Build(benchmark::State& state)
+    {
+        const auto primitives = MakePrimitives(static_cast<size_t>(state.range(0)));
+        BVH bvh;
+
+        for (auto _ : state)
+        {
+            bvh.Build(primitives);
+            benchmark::DoNotOptimize(bvh.GetNodes().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BVH_Build)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+    static void BVH_Refit(benchmark::State& state)
+    {
+        const auto primitives = MakePrimitives(static_cast<size_t>(state.range(0)));
+        BVH bvh(primitives);
+
+        for (auto _ : state)
+        {
+            bvh.Refit(primitives);
+            benchmark::DoNotOptimize(bvh.GetNodes().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BVH_Refit)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+    static void BVH_RayCast(benchmark::State& state)
+    {
+        const auto primitives = MakePrimitives(static_cast<size_t>(state.range(0)));
+        const BVH bvh(primitives);
+        std::mt19937 random(2);
+        std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+        std::vector<Vector3> directions(1024);
+        for (auto& value : directions)
+        {
+            value = Vector3::Normalize(Vector3(direction(random), direction(random), direction(random)));
+        }
+
+        size_t ray = 0;
+        for (auto _ : state)
+        {
+            BVH::RayHit hit;
+            benchmark::DoNotOptimize(bvh.RayCast(Vector3(0.0f, 0.0f, 0.0f), directions[ray++ % directions.size()], 1000.0f, hit));
+            benchmark::DoNotOptimize(hit);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BVH_RayCast)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+    static void BVH_QueryAABB(benchmark::State& state)
+    {
+        const auto primitives = MakePrimitives(static_cast<size_t>(state.range(0)));
+        const BVH bvh(primitives);
+        std::vector<uint32> result;
+
+        size_t query = 0;
+        for (auto _ : state)
+        {
+            result.clear();
+            const AABB& center = primitives[(query++ * 7919) % primitives.size()];
+            bvh.QueryAABB(AABB::FromCenterExtents(center.GetCenter(), Vector3(4.0f)), result);
+            benchmark::DoNotOptimize(result.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BVH_QueryAABB)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+    static void AABB_QueryLinearScan(benchmark::State& state)
+    {
+        const auto primitives = MakePrimitives(static_cast<size_t>(state.range(0)));
+        std::vector<uint32> result;
+
+        size_t query = 0;
+        for (auto _ : state)
+        {
+            result.clear();
+            const AABB& center = primitives[(query++ * 7919) % primitives.size()];
+            const AABB box = AABB::FromCenterExtents(center.GetCenter(), Vector3(4.0f));
+            for (uint32 i = 0; i < primitives.size(); i++)
+            {
+                if (AABB::Overlaps(primitives[i], box)) result.push_back(i);
+            }
+            benchmark::DoNotOptimize(result.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(AABB_QueryLinearScan)->Arg(10000)->Arg(100000)->Arg(1000000);
+}
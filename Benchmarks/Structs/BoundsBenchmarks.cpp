@@ -0,0 +1,17 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/Bounds.h"
+#include "Tbx/Math/Size.h"
+#include "Tbx/Math/Transform.h"
+
+namespace Tbx::Benchmarks
+{
+    TBX_API_BENCHMARK(Bounds_FromOrthographicProjection, MakeFloat, [](float f) { return Bounds::FromOrthographicProjection(f * 10.0f, 16.0f / 9.0f); });
+    TBX_API_BENCHMARK(Bounds_FromPerspectiveProjection, MakeFloat, [](float f) { return Bounds::FromPerspectiveProjection(f, 16.0f / 9.0f, 0.1f); });
+    TBX_API_BENCHMARK(Bounds_ToString, MakeFloat, [](float f) { return Bounds(-f, f, f, -f).ToString(); });
+
+    TBX_API_BENCHMARK(Size_GetAspectRatio, MakeVector3, [](const Vector3& v) { return Size(static_cast<int>(v.X * 1000.0f), 720).GetAspectRatio(); });
+    TBX_API_BENCHMARK(Size_ToString, MakeVector3, [](const Vector3& v) { return Size(static_cast<int>(v.X * 1000.0f), 720).ToString(); });
+
+    TBX_API_BENCHMARK(Transform_ToString, MakeQuaternionVector3, [](const auto& in) { return Transform(in.Second, in.First, in.Second).ToString(); });
+}
@@ -0,0 +1,157 @@
+#include "PCH.h"
+#include "Tbx/Math/Vectors.h"
+#include "Tbx/Math/Quaternion.h"
+#include "Tbx/Math/Mat4x4.h"
+
+// Compares the math API against hand written scalar loops doing the same work.
+// Build with the tbx-math-inline option to define the arithmetic in the headers, the two should then match.
+
+namespace Tbx::Benchmarks
+{
+    static void Vector3_IntegrateVelocity_Api(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3> positions(count, Vector3(1.0f, 2.0f, 3.0f));
+        std::vector<Vector3> velocities(count, Vector3(0.5f, -0.25f, 1.0f));
+        const float deltaTime = 1.0f / 60.0f;
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                positions[i] += velocities[i] * deltaTime;
+            }
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Vector3_IntegrateVelocity_Api)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Vector3_IntegrateVelocity_Scalar(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3> positions(count, Vector3(1.0f, 2.0f, 3.0f));
+        std::vector<Vector3> velocities(count, Vector3(0.5f, -0.25f, 1.0f));
+        const float deltaTime = 1.0f / 60.0f;
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                positions[i].X += velocities[i].X * deltaTime;
+                positions[i].Y += velocities[i].Y * deltaTime;
+                positions[i].Z += velocities[i].Z * deltaTime;
+            }
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Vector3_IntegrateVelocity_Scalar)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Quaternion_RotateVectors_Api(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Quaternion rotation = Quaternion::Normalize({ 0.1f, 0.2f, 0.3f, 0.9f });
+        std::vector<Vector3> input(count, Vector3(1.0f, 2.0f, 3.0f));
+        std::vector<Vector3> output(count);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                output[i] = rotation * input[i];
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_RotateVectors_Api)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Quaternion_RotateVectors_Scalar(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Quaternion q = Quaternion::Normalize({ 0.1f, 0.2f, 0.3f, 0.9f });
+        std::vector<Vector3> input(count, Vector3(1.0f, 2.0f, 3.0f));
+        std::vector<Vector3> output(count);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                const Vector3& v = input[i];
+                const float uvX = q.Y * v.Z - q.Z * v.Y;
+                const float uvY = q.Z * v.X - q.X * v.Z;
+                const float uvZ = q.X * v.Y - q.Y * v.X;
+                const float uuvX = q.Y * uvZ - q.Z * uvY;
+                const float uuvY = q.Z * uvX - q.X * uvZ;
+                const float uuvZ = q.X * uvY - q.Y * uvX;
+                output[i] =
+                {
+                    v.X + 2.0f * (uvX * q.W + uuvX),
+                    v.Y + 2.0f * (uvY * q.W + uuvY),
+                    v.Z + 2.0f * (uvZ * q.W + uuvZ)
+                };
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_RotateVectors_Scalar)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Mat4x4_Multiply_Api(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        std::vector<Mat4x4> models(count, Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f)));
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                output[i] = viewProjection * models[i];
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_Multiply_Api)->Arg(1 << 10)->Arg(1 << 14);
+
+    static void Mat4x4_Multiply_Scalar(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        std::vector<Mat4x4> models(count, Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f)));
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                const float* lhs = viewProjection.Values.data();
+                const float* rhs = models[i].Values.data();
+                float* result = output[i].Values.data();
+                for (int col = 0; col < 4; col++)
+                {
+                    for (int row = 0; row < 4; row++)
+                    {
+                        result[col * 4 + row] =
+                            lhs[row] * rhs[col * 4] +
+                            lhs[4 + row] * rhs[col * 4 + 1] +
+                            lhs[8 + row] * rhs[col * 4 + 2] +
+                            lhs[12 + row] * rhs[col * 4 + 3];
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_Multiply_Scalar)->Arg(1 << 10)->Arg(1 << 14);
+}
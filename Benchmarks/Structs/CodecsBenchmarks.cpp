@@ -0,0 +1,113 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/Codecs.h"
+
+namespace Tbx::Benchmarks
+{
+    static Quaternion MakeUnitQuaternion(size_t i)
+    {
+        return Quaternion::Normalize(MakeQuaternion(i));
+    }
+
+    static Vector3 MakeNormal(size_t i)
+    {
+        return Vector3::Normalize(MakeVector3(i) + Vector3(0.1f));
+    }
+
+    static uint32 MakePacked32(size_t i) { return QuaternionCodec::Pack32(MakeUnitQuaternion(i)); }
+    static PackedQuaternion48 MakePacked48(size_t i) { return QuaternionCodec::Pack48(MakeUnitQuaternion(i)); }
+    static uint64 MakePacked64(size_t i) { return QuaternionCodec::Pack64(MakeUnitQuaternion(i)); }
+    static uint16 MakeEncoded16(size_t i) { return NormalCodec::Encode16(MakeNormal(i)); }
+    static uint32 MakeEncoded32(size_t i) { return NormalCodec::Encode32(MakeNormal(i)); }
+
+    TBX_API_BENCHMARK(QuaternionCodec_Pack32, MakeUnitQuaternion, [](const Quaternion& q) { return QuaternionCodec::Pack32(q); });
+    TBX_API_BENCHMARK(QuaternionCodec_Unpack32, MakePacked32, [](uint32 packed) { return QuaternionCodec::Unpack32(packed); });
+    TBX_API_BENCHMARK(QuaternionCodec_Pack48, MakeUnitQuaternion, [](const Quaternion& q) { return QuaternionCodec::Pack48(q); });
+    TBX_API_BENCHMARK(QuaternionCodec_Unpack48, MakePacked48, [](const PackedQuaternion48& packed) { return QuaternionCodec::Unpack48(packed); });
+    TBX_API_BENCHMARK(QuaternionCodec_Pack64, MakeUnitQuaternion, [](const Quaternion& q) { return QuaternionCodec::Pack64(q); });
+    TBX_API_BENCHMARK(QuaternionCodec_Unpack64, MakePacked64, [](uint64 packed) { return QuaternionCodec::Unpack64(packed); });
+    TBX_API_BENCHMARK(NormalCodec_Encode16, MakeNormal, [](const Vector3& n) { return NormalCodec::Encode16(n); });
+    TBX_API_BENCHMARK(NormalCodec_Decode16, MakeEncoded16, [](uint16 encoded) { return NormalCodec::Decode16(encoded); });
+    TBX_API_BENCHMARK(NormalCodec_Encode32, MakeNormal, [](const Vector3& n) { return NormalCodec::Encode32(n); });
+    TBX_API_BENCHMARK(NormalCodec_Decode32, MakeEncoded32, [](uint32 encoded) { return NormalCodec::Decode32(encoded); });
+
+    static void QuaternionCodec_Pack32Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Quaternion> rotations(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            rotations[i] = MakeUnitQuaternion(i);
+        }
+        std::vector<uint32> output(count);
+
+        for (auto _ : state)
+        {
+            QuaternionCodec::Pack32Batch(rotations, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(QuaternionCodec_Pack32Batch)->Arg(1 << 10)->Arg(100000);
+
+    static void QuaternionCodec_Unpack32Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<uint32> packed(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            packed[i] = MakePacked32(i);
+        }
+        std::vector<Quaternion> output(count);
+
+        for (auto _ : state)
+        {
+            QuaternionCodec::Unpack32Batch(packed, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(QuaternionCodec_Unpack32Batch)->Arg(1 << 10)->Arg(100000);
+
+    static void NormalCodec_Encode16Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3> normals(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            normals[i] = MakeNormal(i);
+        }
+        std::vector<uint16> output(count);
+
+        for (auto _ : state)
+        {
+            NormalCodec::Encode16Batch(normals, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(NormalCodec_Encode16Batch)->Arg(1 << 10)->Arg(100000);
+
+    static void NormalCodec_Decode16Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<uint16> encoded(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            encoded[i] = MakeEncoded16(i);
+        }
+        std::vector<Vector3> output(count);
+
+        for (auto _ : state)
+        {
+            NormalCodec::Decode16Batch(encoded, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(NormalCodec_Decode16Batch)->Arg(1 << 10)->Arg(100000);
+}
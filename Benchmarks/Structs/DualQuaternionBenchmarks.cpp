@@ -0,0 +1,161 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/DualQuaternion.h"
+
+namespace Tbx::Benchmarks
+{
+    static DualQuaternion MakeDualQuaternion(size_t i)
+    {
+        return DualQuaternion::FromRotationTranslation(MakeQuaternion(i), MakeVector3(i));
+    }
+
+    static Transform MakeRigidTransform(size_t i)
+    {
+        return { MakeVector3(i), MakeQuaternion(i), Vector3(1.0f) };
+    }
+
+    static Pair<DualQuaternion, DualQuaternion> MakeDualQuaternionPair(size_t i) { return { MakeDualQuaternion(i), MakeDualQuaternion(i + 13) }; }
+    static Pair<DualQuaternion, Vector3> MakeDualQuaternionVector3(size_t i) { return { MakeDualQuaternion(i), MakeVector3(i + 13) }; }
+
+    TBX_API_BENCHMARK(DualQuaternion_FromRotationTranslation, MakeQuaternionVector3, [](const auto& in) { return DualQuaternion::FromRotationTranslation(in.First, in.Second); });
+    TBX_API_BENCHMARK(DualQuaternion_FromTransform, MakeRigidTransform, [](const Transform& t) { return DualQuaternion::FromTransform(t); });
+    TBX_API_BENCHMARK(DualQuaternion_FromMat4x4, MakeMat4x4, [](const Mat4x4& m) { return DualQuaternion::FromMat4x4(m); });
+    TBX_API_BENCHMARK(DualQuaternion_ToTransform, MakeDualQuaternion, [](const DualQuaternion& d) { return DualQuaternion::ToTransform(d); });
+    TBX_API_BENCHMARK(DualQuaternion_ToMat4x4, MakeDualQuaternion, [](const DualQuaternion& d) { return DualQuaternion::ToMat4x4(d); });
+    TBX_API_BENCHMARK(DualQuaternion_GetTranslation, MakeDualQuaternion, [](const DualQuaternion& d) { return DualQuaternion::GetTranslation(d); });
+    TBX_API_BENCHMARK(DualQuaternion_Multiply, MakeDualQuaternionPair, [](const auto& in) { return DualQuaternion::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(DualQuaternion_Inverse, MakeDualQuaternion, [](const DualQuaternion& d) { return DualQuaternion::Inverse(d); });
+    TBX_API_BENCHMARK(DualQuaternion_Normalize, MakeDualQuaternion, [](const DualQuaternion& d) { return DualQuaternion::Normalize(d); });
+    TBX_API_BENCHMARK(DualQuaternion_TransformPoint, MakeDualQuaternionVector3, [](const auto& in) { return DualQuaternion::TransformPoint(in.First, in.Second); });
+    TBX_API_BENCHMARK(DualQuaternion_TransformDirection, MakeDualQuaternionVector3, [](const auto& in) { return DualQuaternion::TransformDirection(in.First, in.Second); });
+    TBX_API_BENCHMARK(DualQuaternion_Blend, MakeDualQuaternionPair, [](const auto& in) { return DualQuaternion::Blend(in.First, in.Second, 0.3f); });
+    TBX_API_BENCHMARK(DualQuaternion_ToString, MakeDualQuaternion, [](const DualQuaternion& d) { return d.ToString(); });
+
+    // Concatenating rigid transforms as matrices, the work MultiplyBatch replaces
+    static void DualQuaternion_ComposeMat4x4Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Mat4x4> lhs(count);
+        std::vector<Mat4x4> rhs(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            lhs[i] = DualQuaternion::ToMat4x4(MakeDualQuaternion(i));
+            rhs[i] = DualQuaternion::ToMat4x4(MakeDualQuaternion(i + 13));
+        }
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            Mat4x4::MultiplyBatch(lhs, rhs, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(DualQuaternion_ComposeMat4x4Batch)->Arg(1 << 10)->Arg(100000);
+
+    static void DualQuaternion_MultiplyBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<DualQuaternion> lhs(count);
+        std::vector<DualQuaternion> rhs(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            lhs[i] = MakeDualQuaternion(i);
+            rhs[i] = MakeDualQuaternion(i + 13);
+        }
+        std::vector<DualQuaternion> output(count);
+
+        for (auto _ : state)
+        {
+            DualQuaternion::MultiplyBatch(lhs, rhs, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(DualQuaternion_MultiplyBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void DualQuaternion_BlendBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<DualQuaternion> from(count);
+        std::vector<DualQuaternion> to(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            from[i] = MakeDualQuaternion(i);
+            to[i] = MakeDualQuaternion(i + 13);
+        }
+        std::vector<DualQuaternion> output(count);
+
+        for (auto _ : state)
+        {
+            DualQuaternion::BlendBatch(from, to, 0.3f, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(DualQuaternion_BlendBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void DualQuaternion_TransformPointBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const DualQuaternion dualQuaternion = MakeDualQuaternion(3);
+        std::vector<Vector3> points(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            points[i] = MakeVector3(i);
+        }
+        std::vector<Vector3> output(count);
+
+        for (auto _ : state)
+        {
+            DualQuaternion::TransformPointBatch(dualQuaternion, points, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(DualQuaternion_TransformPointBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void DualQuaternion_FromTransformBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Transform> transforms(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            transforms[i] = MakeRigidTransform(i);
+        }
+        std::vector<DualQuaternion> output(count);
+
+        for (auto _ : state)
+        {
+            DualQuaternion::FromTransformBatch(transforms, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(DualQuaternion_FromTransformBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void DualQuaternion_ToMat4x4Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<DualQuaternion> dualQuaternions(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            dualQuaternions[i] = MakeDualQuaternion(i);
+        }
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            DualQuaternion::ToMat4x4Batch(dualQuaternions, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(DualQuaternion_ToMat4x4Batch)->Arg(1 << 10)->Arg(100000);
+}
@@ -0,0 +1,100 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/Frustum.h"
+#include "Tbx/Math/Trig.h"
+
+namespace Tbx::Benchmarks
+{
+    static Frustum MakeCameraFrustum()
+    {
+        const Mat4x4 projection = Mat4x4::PerspectiveProjection(Math::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+        const Mat4x4 view = Mat4x4::LookAt(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 1.0f, 0.0f));
+        return Frustum(projection * view);
+    }
+
+    static std::vector<AABB> MakeSceneBoxes(size_t count)
+    {
+        std::vector<AABB> boxes(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const Vector3 center(static_cast<float>(i % 97) * 8.0f - 400.0f, static_cast<float>(i % 13) * 4.0f - 26.0f, static_cast<float>(i % 89) * 8.0f - 200.0f);
+            boxes[i] = AABB::FromCenterExtents(center, Vector3(1.0f + (i % 3)));
+        }
+        return boxes;
+    }
+
+    static void Frustum_IntersectsAABBLoop(benchmark::State& state)
+    {
+        const Frustum frustum = MakeCameraFrustum();
+        const auto boxes = MakeSceneBoxes(static_cast<size_t>(state.range(0)));
+        std::vector<uint64> mask((boxes.size() + 63) / 64);
+
+        for (auto _ : state)
+        {
+            std::fill(mask.begin(), mask.end(), 0ull);
+            for (size_t i = 0; i < boxes.size(); i++)
+            {
+                mask[i / 64] |= static_cast<uint64>(Frustum::Intersects(frustum, boxes[i])) << (i % 64);
+            }
+            benchmark::DoNotOptimize(mask.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Frustum_IntersectsAABBLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Frustum_CullAABBs(benchmark::State& state)
+    {
+        const Frustum frustum = MakeCameraFrustum();
+        const AABBBuffer boxes(MakeSceneBoxes(static_cast<size_t>(state.range(0))));
+        std::vector<uint64> mask(boxes.GetMaskWordCount());
+
+        for (auto _ : state)
+        {
+            Frustum::CullAABBs(frustum, boxes, mask);
+            benchmark::DoNotOptimize(mask.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Frustum_CullAABBs)->Arg(1 << 10)->Arg(100000);
+
+    static void Frustum_CullSpheres(benchmark::State& state)
+    {
+        const Frustum frustum = MakeCameraFrustum();
+        const auto boxes = MakeSceneBoxes(static_cast<size_t>(state.range(0)));
+        std::vector<float> x, y, z, radius;
+        for (const auto& box : boxes)
+        {
+            const Vector3 center = box.GetCenter();
+            x.push_back(center.X);
+            y.push_back(center.Y);
+            z.push_back(center.Z);
+            radius.push_back(box.GetExtents().X * 1.7320508f);
+        }
+        std::vector<uint64> mask((boxes.size() + 63) / 64);
+
+        for (auto _ : state)
+        {
+            Frustum::CullSpheres(frustum, x, y, z, radius, mask);
+            benchmark::DoNotOptimize(mask.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Frustum_CullSpheres)->Arg(1 << 10)->Arg(100000);
+
+    static Pair<Frustum, Vector3> MakeFrustumPoint(size_t i)
+    {
+        return { MakeCameraFrustum(), MakeVector3(i) * 100.0f - Vector3(50.0f, 50.0f, 0.0f) };
+    }
+
+    TBX_API_BENCHMARK(Frustum_FromViewProjection, MakeMat4x4, [](const Mat4x4& m) { return Frustum(m); });
+    TBX_API_BENCHMARK(Frustum_Contains, MakeFrustumPoint, [](const auto& in) { return Frustum::Contains(in.First, in.Second); });
+    TBX_API_BENCHMARK(Frustum_IntersectsSphere, MakeFrustumPoint, [](const auto& in) { return Frustum::Intersects(in.First, in.Second, 2.0f); });
+    TBX_API_BENCHMARK(Frustum_IntersectsAABB, MakeFrustumPoint, [](const auto& in) { return Frustum::Intersects(in.First, AABB::FromCenterExtents(in.Second, Vector3(2.0f))); });
+    TBX_API_BENCHMARK(Plane_GetSignedDistance, MakeVector3Pair, [](const auto& in) { return Plane::GetSignedDistance(Plane(in.First, 1.0f), in.Second); });
+    TBX_API_BENCHMARK(Frustum_ToString, MakeMat4x4, [](const Mat4x4& m) { return Frustum(m).ToString(); });
+    TBX_API_BENCHMARK(Plane_Normalize, MakeVector3Scalar, [](const auto& in) { return Plane::Normalize(Plane(in.First, in.Second)); });
+    TBX_API_BENCHMARK(Plane_ToString, MakeVector3Scalar, [](const auto& in) { return Plane(in.First, in.Second).ToString(); });
+}
@@ -0,0 +1,25 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/Mat3x4.h"
+
+namespace Tbx::Benchmarks
+{
+    // Compare with the Mat4x4_Multiply, Mat4x4_Inverse and Mat4x4_FromTRS benchmarks
+    static Mat3x4 MakeMat3x4(size_t i)
+    {
+        return Mat3x4::FromMat4x4(MakeMat4x4(i));
+    }
+
+    static Pair<Mat3x4, Mat3x4> MakeMat3x4Pair(size_t i) { return { MakeMat3x4(i), MakeMat3x4(i + 13) }; }
+    static Pair<Mat3x4, Vector3> MakeMat3x4Vector3(size_t i) { return { MakeMat3x4(i), MakeVector3(i + 13) }; }
+
+    TBX_API_BENCHMARK(Mat3x4_FromTRS, MakeQuaternionVector3, [](const auto& in) { return Mat3x4::FromTRS(in.Second, in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat3x4_FromMat4x4, MakeMat4x4, [](const Mat4x4& m) { return Mat3x4::FromMat4x4(m); });
+    TBX_API_BENCHMARK(Mat3x4_ToMat4x4, MakeMat3x4, [](const Mat3x4& m) { return Mat3x4::ToMat4x4(m); });
+    TBX_API_BENCHMARK(Mat3x4_Multiply, MakeMat3x4Pair, [](const auto& in) { return Mat3x4::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat3x4_Inverse, MakeMat3x4, [](const Mat3x4& m) { return Mat3x4::Inverse(m); });
+    TBX_API_BENCHMARK(Mat3x4_InverseOrthonormal, MakeMat3x4, [](const Mat3x4& m) { return Mat3x4::InverseOrthonormal(m); });
+    TBX_API_BENCHMARK(Mat3x4_TransformPoint, MakeMat3x4Vector3, [](const auto& in) { return Mat3x4::TransformPoint(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat3x4_TransformVector, MakeMat3x4Vector3, [](const auto& in) { return Mat3x4::TransformVector(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat3x4_ToString, MakeMat3x4, [](const Mat3x4& m) { return m.ToString(); });
+}
@@ -0,0 +1,242 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/Mat.h"
+#include "Tbx/Math/Bounds.h"
+#include "Tbx/Math/ThreadPool.h"
+
+namespace Tbx::Benchmarks
+{
+    static void Mat4x4_MultiplyLoop(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        std::vector<Mat4x4> models(count, Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f)));
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                output[i] = viewProjection * models[i];
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_MultiplyLoop)->Arg(1 << 10)->Arg(1 << 16);
+
+    // Compare with Mat4x4_MultiplyLoop, the double precision product runs the generic Mat loops
+    static void Mat4x4D_MultiplyLoop(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        const Mat4x4 model = Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f));
+        std::array<double, 16> viewProjectionValues = {};
+        std::array<double, 16> modelValues = {};
+        for (size_t i = 0; i < 16; i++)
+        {
+            viewProjectionValues[i] = viewProjection.Values[i];
+            modelValues[i] = model.Values[i];
+        }
+        const Mat4x4D viewProjectionD(viewProjectionValues);
+        std::vector<Mat4x4D> models(count, Mat4x4D(modelValues));
+        std::vector<Mat4x4D> output(count);
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                output[i] = viewProjectionD * models[i];
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4D_MultiplyLoop)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Mat4x4_MultiplyBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        std::vector<Mat4x4> models(count, Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f)));
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            Mat4x4::MultiplyBatch(viewProjection, models, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_MultiplyBatch)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Mat4x4_MultiplyBatchPairwise(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Mat4x4> lhs(count, Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+        std::vector<Mat4x4> rhs(count, Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f)));
+        std::vector<Mat4x4> output(count);
+
+        for (auto _ : state)
+        {
+            Mat4x4::MultiplyBatch(lhs, rhs, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_MultiplyBatchPairwise)->Arg(1 << 10)->Arg(1 << 16);
+
+    static void Mat4x4_DefaultConstructVector(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+
+        for (auto _ : state)
+        {
+            std::vector<Mat4x4> matrices(count);
+            benchmark::DoNotOptimize(matrices.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(Mat4x4)));
+    }
+    BENCHMARK(Mat4x4_DefaultConstructVector)->Arg(1 << 20);
+
+    // Baseline for Mat4x4_DefaultConstructVector, value initializing the same number of bytes is a plain memset
+    static void Mat4x4_ZeroFillVectorBaseline(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+
+        for (auto _ : state)
+        {
+            std::vector<float> values(count * 16);
+            benchmark::DoNotOptimize(values.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(Mat4x4)));
+    }
+    BENCHMARK(Mat4x4_ZeroFillVectorBaseline)->Arg(1 << 20);
+
+    static std::vector<Vector3> MakeTransformPoints(size_t count)
+    {
+        std::vector<Vector3> points(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i);
+            points[i] = Vector3(f, 0.5f * f, 10.0f + f);
+        }
+        return points;
+    }
+
+    static void Mat4x4_TransformPointLoop(benchmark::State& state)
+    {
+        const Mat4x4 model = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(2.0f));
+        const auto points = MakeTransformPoints(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> output(points.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < points.size(); i++)
+            {
+                output[i] = Mat4x4::TransformPoint(model, points[i]);
+            }
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_TransformPointLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Mat4x4_TransformPoints(benchmark::State& state)
+    {
+        const Mat4x4 model = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(2.0f));
+        const auto points = MakeTransformPoints(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> output(points.size());
+
+        for (auto _ : state)
+        {
+            Mat4x4::TransformPoints(model, points, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_TransformPoints)->Arg(1 << 10)->Arg(100000);
+
+    static void Mat4x4_TransformPointsThreadPool(benchmark::State& state)
+    {
+        const Mat4x4 model = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(2.0f));
+        const auto points = MakeTransformPoints(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> output(points.size());
+        ThreadPool pool(4);
+
+        for (auto _ : state)
+        {
+            Mat4x4::TransformPoints(model, points, output, pool);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_TransformPointsThreadPool)->Arg(1 << 10)->Arg(100000)->UseRealTime();
+
+    static void Mat4x4_TransformDirections(benchmark::State& state)
+    {
+        const Mat4x4 model = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(2.0f));
+        const auto directions = MakeTransformPoints(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> output(directions.size());
+
+        for (auto _ : state)
+        {
+            Mat4x4::TransformDirections(model, directions, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_TransformDirections)->Arg(1 << 10)->Arg(100000);
+
+    static void Mat4x4_TransformPointsProjective(benchmark::State& state)
+    {
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        const auto points = MakeTransformPoints(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> output(points.size());
+
+        for (auto _ : state)
+        {
+            Mat4x4::TransformPointsProjective(viewProjection, points, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Mat4x4_TransformPointsProjective)->Arg(1 << 10)->Arg(100000);
+
+    TBX_API_BENCHMARK(Mat4x4_FromPosition, MakeVector3, [](const Vector3& v) { return Mat4x4::FromPosition(v); });
+    TBX_API_BENCHMARK(Mat4x4_FromRotation, MakeQuaternion, [](const Quaternion& q) { return Mat4x4::FromRotation(q); });
+    TBX_API_BENCHMARK(Mat4x4_FromScale, MakeVector3, [](const Vector3& v) { return Mat4x4::FromScale(v); });
+    TBX_API_BENCHMARK(Mat4x4_FromTRS, MakeQuaternionVector3, [](const auto& in) { return Mat4x4::FromTRS(in.Second, in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_LookAt, MakeVector3Pair, [](const auto& in) { return Mat4x4::LookAt(in.First, in.Second, Vector3(0.0f, 1.0f, 0.0f)); });
+    TBX_API_BENCHMARK(Mat4x4_OrthographicProjection, MakeFloat, [](float f) { return Mat4x4::OrthographicProjection(Bounds(-f, f, f, -f), 0.1f, 100.0f); });
+    TBX_API_BENCHMARK(Mat4x4_PerspectiveProjection, MakeFloat, [](float f) { return Mat4x4::PerspectiveProjection(f, 16.0f / 9.0f, 0.1f, 100.0f); });
+    TBX_API_BENCHMARK(Mat4x4_Inverse, MakeMat4x4, [](const Mat4x4& m) { return Mat4x4::Inverse(m); });
+    TBX_API_BENCHMARK(Mat4x4_Transpose, MakeMat4x4, [](const Mat4x4& m) { return Mat4x4::Transpose(m); });
+    TBX_API_BENCHMARK(Mat4x4_Translate, MakeMat4x4Vector3, [](const auto& in) { return Mat4x4::Translate(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_Rotate, MakeMat4x4Vector3, [](const auto& in) { return Mat4x4::Rotate(in.First, 30.0f, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_Scale, MakeMat4x4Vector3, [](const auto& in) { return Mat4x4::Scale(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_Add, MakeMat4x4Pair, [](const auto& in) { return Mat4x4::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_Subtract, MakeMat4x4Pair, [](const auto& in) { return Mat4x4::Subtract(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_Multiply, MakeMat4x4Pair, [](const auto& in) { return Mat4x4::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_MultiplyScalar, MakeMat4x4Scalar, [](const auto& in) { return Mat4x4::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_MultiplyScalarLhs, MakeMat4x4Scalar, [](const auto& in) { return Mat4x4::Multiply(in.Second, in.First); });
+    TBX_API_BENCHMARK(Mat4x4_TransformPoint, MakeMat4x4Vector3, [](const auto& in) { return Mat4x4::TransformPoint(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_TransformDirection, MakeMat4x4Vector3, [](const auto& in) { return Mat4x4::TransformDirection(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_TransformPointProjective, MakeMat4x4Vector3, [](const auto& in) { return Mat4x4::TransformPointProjective(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_IsEqual, MakeMat4x4Scalar, [](const auto& in) { return Mat4x4::IsEqual(in.First, in.Second); });
+    TBX_API_BENCHMARK(Mat4x4_ToString, MakeMat4x4, [](const Mat4x4& m) { return m.ToString(); });
+}
@@ -0,0 +1,98 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include "Tbx/Math/PackedVectors.h"
+
+namespace Tbx::Benchmarks
+{
+    static const AABB PositionBounds = { Vector3(-100.0f), Vector3(100.0f) };
+
+    static Vector3H MakeVector3H(size_t i) { return Vector3H(MakeVector3(i)); }
+    static Vector3Q16 MakeVector3Q16(size_t i) { return Vector3Q16::Quantize(MakeVector3(i), PositionBounds); }
+
+    TBX_API_BENCHMARK(Vector3H_FromVector3, MakeVector3, [](const Vector3& v) { return Vector3H(v); });
+    TBX_API_BENCHMARK(Vector3H_ToVector3, MakeVector3H, [](const Vector3H& v) { return v.ToVector3(); });
+    TBX_API_BENCHMARK(Vector3H_FloatToHalf, MakeFloat, [](float value) { return Vector3H::FloatToHalf(value); });
+    TBX_API_BENCHMARK(Vector3H_HalfToFloat, MakeVector3H, [](const Vector3H& v) { return Vector3H::HalfToFloat(v.X); });
+    TBX_API_BENCHMARK(Vector3Q16_Quantize, MakeVector3, [](const Vector3& v) { return Vector3Q16::Quantize(v, PositionBounds); });
+    TBX_API_BENCHMARK(Vector3Q16_Dequantize, MakeVector3Q16, [](const Vector3Q16& v) { return Vector3Q16::Dequantize(v, PositionBounds); });
+
+    static void Vector3H_FromVector3Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3> vectors(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            vectors[i] = MakeVector3(i);
+        }
+        std::vector<Vector3H> output(count);
+
+        for (auto _ : state)
+        {
+            Vector3H::FromVector3Batch(vectors, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Vector3H_FromVector3Batch)->Arg(1 << 10)->Arg(100000);
+
+    static void Vector3H_ToVector3Batch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3H> vectors(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            vectors[i] = MakeVector3H(i);
+        }
+        std::vector<Vector3> output(count);
+
+        for (auto _ : state)
+        {
+            Vector3H::ToVector3Batch(vectors, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Vector3H_ToVector3Batch)->Arg(1 << 10)->Arg(100000);
+
+    static void Vector3Q16_QuantizeBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3> positions(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            positions[i] = MakeVector3(i);
+        }
+        std::vector<Vector3Q16> output(count);
+
+        for (auto _ : state)
+        {
+            Vector3Q16::QuantizeBatch(positions, PositionBounds, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Vector3Q16_QuantizeBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void Vector3Q16_DequantizeBatch(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        std::vector<Vector3Q16> positions(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            positions[i] = MakeVector3Q16(i);
+        }
+        std::vector<Vector3> output(count);
+
+        for (auto _ : state)
+        {
+            Vector3Q16::DequantizeBatch(positions, PositionBounds, output);
+            benchmark::DoNotOptimize(output.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Vector3Q16_DequantizeBatch)->Arg(1 << 10)->Arg(100000);
+}
@@ -0,0 +1,237 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+#include <glm/gtc/quaternion.hpp>
+#include <vector>
+
+namespace Tbx::Benchmarks
+{
+    TBX_API_BENCHMARK(Quaternion_Normalize, MakeQuaternion, [](const Quaternion& q) { return Quaternion::Normalize(q); });
+    TBX_API_BENCHMARK(Quaternion_Add, MakeQuaternionPair, [](const auto& in) { return Quaternion::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_Subtract, MakeQuaternionPair, [](const auto& in) { return Quaternion::Subtract(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_Multiply, MakeQuaternionPair, [](const auto& in) { return Quaternion::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_MultiplyVector3, MakeQuaternionVector3, [](const auto& in) { return Quaternion::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_MultiplyVector3Inverse, MakeQuaternionVector3, [](const auto& in) { return Quaternion::Multiply(in.Second, in.First); });
+    TBX_API_BENCHMARK(Quaternion_GetRight, MakeQuaternion, [](const Quaternion& q) { return Quaternion::GetRight(q); });
+    TBX_API_BENCHMARK(Quaternion_GetForward, MakeQuaternion, [](const Quaternion& q) { return Quaternion::GetForward(q); });
+    TBX_API_BENCHMARK(Quaternion_GetUp, MakeQuaternion, [](const Quaternion& q) { return Quaternion::GetUp(q); });
+    TBX_API_BENCHMARK(Quaternion_FromAxisAngle, MakeVector3Scalar, [](const auto& in) { return Quaternion::FromAxisAngle(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_FromEuler, MakeVector3, [](const Vector3& v) { return Quaternion::FromEuler(v.X, v.Y, v.Z); });
+    TBX_API_BENCHMARK(Quaternion_FromEulerVector3, MakeVector3, [](const Vector3& v) { return Quaternion::FromEuler(v); });
+    TBX_API_BENCHMARK(Quaternion_ToEuler, MakeQuaternion, [](const Quaternion& q) { return Quaternion::ToEuler(q); });
+    TBX_API_BENCHMARK(Quaternion_Dot, MakeQuaternionPair, [](const auto& in) { return Quaternion::Dot(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_Slerp, MakeQuaternionPair, [](const auto& in) { return Quaternion::Slerp(in.First, in.Second, 0.35f); });
+    TBX_API_BENCHMARK(Quaternion_Nlerp, MakeQuaternionPair, [](const auto& in) { return Quaternion::Nlerp(in.First, in.Second, 0.35f); });
+    TBX_API_BENCHMARK(Quaternion_FastSlerp, MakeQuaternionPair, [](const auto& in) { return Quaternion::FastSlerp(in.First, in.Second, 0.35f); });
+    TBX_API_BENCHMARK(Quaternion_IsEqualOrEquivalent, MakeQuaternionPair, [](const auto& in) { return Quaternion::IsEqualOrEquivalent(in.First, in.Second); });
+    TBX_API_BENCHMARK(Quaternion_ToString, MakeQuaternion, [](const Quaternion& q) { return q.ToString(); });
+
+    static std::vector<Vector3> MakeEulerAngles(size_t count)
+    {
+        std::vector<Vector3> euler(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            euler[i] = Vector3(static_cast<float>(i % 360) - 180.0f, static_cast<float>(i % 170) - 85.0f, static_cast<float>(i % 719) - 360.0f);
+        }
+        return euler;
+    }
+
+    static void Quaternion_FromEulerLoop(benchmark::State& state)
+    {
+        const auto euler = MakeEulerAngles(static_cast<size_t>(state.range(0)));
+        std::vector<Quaternion> quaternions(euler.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < euler.size(); i++)
+            {
+                quaternions[i] = Quaternion::FromEuler(euler[i]);
+            }
+            benchmark::DoNotOptimize(quaternions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_FromEulerLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_FromEulerBatch(benchmark::State& state)
+    {
+        const auto euler = MakeEulerAngles(static_cast<size_t>(state.range(0)));
+        std::vector<Quaternion> quaternions(euler.size());
+
+        for (auto _ : state)
+        {
+            Quaternion::FromEulerBatch(euler, quaternions);
+            benchmark::DoNotOptimize(quaternions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_FromEulerBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_ToEulerLoop(benchmark::State& state)
+    {
+        std::vector<Quaternion> quaternions(static_cast<size_t>(state.range(0)));
+        Quaternion::FromEulerBatch(MakeEulerAngles(quaternions.size()), quaternions);
+        std::vector<Vector3> euler(quaternions.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < quaternions.size(); i++)
+            {
+                euler[i] = Quaternion::ToEuler(quaternions[i]);
+            }
+            benchmark::DoNotOptimize(euler.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_ToEulerLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_ToEulerBatch(benchmark::State& state)
+    {
+        std::vector<Quaternion> quaternions(static_cast<size_t>(state.range(0)));
+        Quaternion::FromEulerBatch(MakeEulerAngles(quaternions.size()), quaternions);
+        std::vector<Vector3> euler(quaternions.size());
+
+        for (auto _ : state)
+        {
+            Quaternion::ToEulerBatch(quaternions, euler);
+            benchmark::DoNotOptimize(euler.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_ToEulerBatch)->Arg(1 << 10)->Arg(100000);
+
+    struct BlendInput
+    {
+        std::vector<Quaternion> From;
+        std::vector<Quaternion> To;
+        std::vector<float> T;
+    };
+
+    static BlendInput MakeBlendInput(size_t count)
+    {
+        BlendInput input;
+        for (size_t i = 0; i < count; i++)
+        {
+            input.From.push_back(MakeQuaternion(i));
+            input.To.push_back(MakeQuaternion(i + 131));
+            input.T.push_back(static_cast<float>(i % 101) / 100.0f);
+        }
+        return input;
+    }
+
+    static void Quaternion_SlerpGlmLoop(benchmark::State& state)
+    {
+        const BlendInput input = MakeBlendInput(static_cast<size_t>(state.range(0)));
+        std::vector<glm::quat> from;
+        std::vector<glm::quat> to;
+        for (size_t i = 0; i < input.From.size(); i++)
+        {
+            from.emplace_back(input.From[i].W, input.From[i].X, input.From[i].Y, input.From[i].Z);
+            to.emplace_back(input.To[i].W, input.To[i].X, input.To[i].Y, input.To[i].Z);
+        }
+        std::vector<glm::quat> blended(from.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < from.size(); i++)
+            {
+                blended[i] = glm::slerp(from[i], to[i], input.T[i]);
+            }
+            benchmark::DoNotOptimize(blended.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_SlerpGlmLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_SlerpLoop(benchmark::State& state)
+    {
+        const BlendInput input = MakeBlendInput(static_cast<size_t>(state.range(0)));
+        std::vector<Quaternion> blended(input.From.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < blended.size(); i++)
+            {
+                blended[i] = Quaternion::Slerp(input.From[i], input.To[i], input.T[i]);
+            }
+            benchmark::DoNotOptimize(blended.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_SlerpLoop)->Arg(1 << 10)->Arg(100000);
+
+    template <typename Blend>
+    static void BlendBatchBenchmark(benchmark::State& state, Blend blend)
+    {
+        const BlendInput input = MakeBlendInput(static_cast<size_t>(state.range(0)));
+        std::vector<Quaternion> blended(input.From.size());
+
+        for (auto _ : state)
+        {
+            blend(input.From, input.To, input.T, blended);
+            benchmark::DoNotOptimize(blended.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_CAPTURE(BlendBatchBenchmark, Quaternion_SlerpBatch, [](const auto& from, const auto& to, const auto& t, auto& out) { Quaternion::SlerpBatch(from, to, t, out); })->Arg(1 << 10)->Arg(100000);
+    BENCHMARK_CAPTURE(BlendBatchBenchmark, Quaternion_NlerpBatch, [](const auto& from, const auto& to, const auto& t, auto& out) { Quaternion::NlerpBatch(from, to, t, out); })->Arg(1 << 10)->Arg(100000);
+    BENCHMARK_CAPTURE(BlendBatchBenchmark, Quaternion_FastSlerpBatch, [](const auto& from, const auto& to, const auto& t, auto& out) { Quaternion::FastSlerpBatch(from, to, t, out); })->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_RotateLoop(benchmark::State& state)
+    {
+        const Quaternion rotation = Quaternion::FromEuler(30.0f, -45.0f, 60.0f);
+        const auto vectors = MakeEulerAngles(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> rotated(vectors.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < vectors.size(); i++)
+            {
+                rotated[i] = rotation * vectors[i];
+            }
+            benchmark::DoNotOptimize(rotated.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_RotateLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_RotateBatch(benchmark::State& state)
+    {
+        const Quaternion rotation = Quaternion::FromEuler(30.0f, -45.0f, 60.0f);
+        const auto vectors = MakeEulerAngles(static_cast<size_t>(state.range(0)));
+        std::vector<Vector3> rotated(vectors.size());
+
+        for (auto _ : state)
+        {
+            Quaternion::RotateBatch(rotation, vectors, rotated);
+            benchmark::DoNotOptimize(rotated.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_RotateBatch)->Arg(1 << 10)->Arg(100000);
+
+    static void Quaternion_RotateBatchPerVector(benchmark::State& state)
+    {
+        const auto vectors = MakeEulerAngles(static_cast<size_t>(state.range(0)));
+        std::vector<Quaternion> rotations(vectors.size());
+        Quaternion::FromEulerBatch(vectors, rotations);
+        std::vector<Vector3> rotated(vectors.size());
+
+        for (auto _ : state)
+        {
+            Quaternion::RotateBatch(rotations, vectors, rotated);
+            benchmark::DoNotOptimize(rotated.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Quaternion_RotateBatchPerVector)->Arg(1 << 10)->Arg(100000);
+}
@@ -0,0 +1,106 @@
+#include "PCH.h"
+#include "Tbx/Math/SkinnedVertexBuffer.h"
+
+namespace Tbx::Benchmarks
+{
+    static constexpr uint32 SkinJointCount = 64;
+
+    static std::vector<SkinnedVertexBuffer::Vertex> MakeSkinnedVertices(size_t count)
+    {
+        std::vector<SkinnedVertexBuffer::Vertex> vertices(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i);
+            const auto joint = static_cast<uint32>(i * 7);
+            vertices[i].Position = Vector3(f, 0.5f * f, -f);
+            vertices[i].Normal = Vector3(0.0f, 1.0f, 0.0f);
+            vertices[i].Joints = { joint % SkinJointCount, (joint + 1) % SkinJointCount, (joint + 2) % SkinJointCount, (joint + 3) % SkinJointCount };
+            vertices[i].Weights = { 0.4f, 0.3f, 0.2f, 0.1f };
+        }
+        return vertices;
+    }
+
+    static std::vector<Mat4x4> MakeSkinMatrices()
+    {
+        std::vector<Mat4x4> matrices(SkinJointCount);
+        for (uint32 i = 0; i < SkinJointCount; i++)
+        {
+            const auto f = static_cast<float>(i);
+            matrices[i] = Mat4x4::FromTRS(Vector3(f, -f, 2.0f * f), Quaternion::FromEuler(f, 2.0f * f, 3.0f * f), Vector3(1.0f));
+        }
+        return matrices;
+    }
+
+    static void Skin_MatrixBlendLoop(benchmark::State& state)
+    {
+        const auto vertices = MakeSkinnedVertices(static_cast<size_t>(state.range(0)));
+        const auto matrices = MakeSkinMatrices();
+        std::vector<Vector3> positions(vertices.size());
+        std::vector<Vector3> normals(vertices.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < vertices.size(); i++)
+            {
+                const auto& vertex = vertices[i];
+                Mat4x4 blended = matrices[vertex.Joints[0]] * vertex.Weights[0];
+                for (size_t k = 1; k < SkinnedVertexBuffer::MaxInfluences; k++)
+                {
+                    blended = blended + matrices[vertex.Joints[k]] * vertex.Weights[k];
+                }
+                const Vector3& p = vertex.Position;
+                const Vector3& n = vertex.Normal;
+                positions[i] = Vector3(
+                    blended[0] * p.X + blended[4] * p.Y + blended[8] * p.Z + blended[12],
+                    blended[1] * p.X + blended[5] * p.Y + blended[9] * p.Z + blended[13],
+                    blended[2] * p.X + blended[6] * p.Y + blended[10] * p.Z + blended[14]);
+                normals[i] = Vector3::Normalize(Vector3(
+                    blended[0] * n.X + blended[4] * n.Y + blended[8] * n.Z,
+                    blended[1] * n.X + blended[5] * n.Y + blended[9] * n.Z,
+                    blended[2] * n.X + blended[6] * n.Y + blended[10] * n.Z));
+            }
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::DoNotOptimize(normals.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Skin_MatrixBlendLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void SkinnedVertexBuffer_Skin(benchmark::State& state)
+    {
+        const SkinnedVertexBuffer buffer(MakeSkinnedVertices(static_cast<size_t>(state.range(0))));
+        const auto matrices = MakeSkinMatrices();
+        std::vector<Vector3> positions(buffer.Size());
+        std::vector<Vector3> normals(buffer.Size());
+
+        for (auto _ : state)
+        {
+            buffer.Skin(matrices, positions, normals);
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::DoNotOptimize(normals.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(SkinnedVertexBuffer_Skin)->Arg(1 << 10)->Arg(100000);
+
+    static void SkinnedVertexBuffer_SkinThreadPool(benchmark::State& state)
+    {
+        const SkinnedVertexBuffer buffer(MakeSkinnedVertices(static_cast<size_t>(state.range(0))));
+        const auto matrices = MakeSkinMatrices();
+        std::vector<Vector3> positions(buffer.Size());
+        std::vector<Vector3> normals(buffer.Size());
+        ThreadPool pool(4);
+
+        for (auto _ : state)
+        {
+            buffer.Skin(matrices, positions, normals, pool);
+            benchmark::DoNotOptimize(positions.data());
+            benchmark::DoNotOptimize(normals.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(SkinnedVertexBuffer_SkinThreadPool)->Arg(1 << 10)->Arg(100000)->UseRealTime();
+}
@@ -0,0 +1,21 @@
+#include "PCH.h"
+#include "Tbx/Math/ThreadPool.h"
+#include <atomic>
+
+namespace Tbx::Benchmarks
+{
+    // Measures the cost of dispatching work to the pool and waiting for it, with chunks that do almost nothing.
+    static void ThreadPool_ParallelFor(benchmark::State& state)
+    {
+        ThreadPool pool(static_cast<size_t>(state.range(0)));
+        std::atomic<size_t> total = 0;
+
+        for (auto _ : state)
+        {
+            pool.ParallelFor(1024, 64, [&total](size_t begin, size_t end) { total.fetch_add(end - begin, std::memory_order_relaxed); });
+        }
+        benchmark::DoNotOptimize(total.load());
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(ThreadPool_ParallelFor)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+}
@@ -0,0 +1,49 @@
+#include "PCH.h"
+#include "Tbx/Math/TransformBuffer.h"
+
+namespace Tbx::Benchmarks
+{
+    static std::vector<Transform> MakeTransforms(size_t count)
+    {
+        std::vector<Transform> transforms(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i);
+            transforms[i] = Transform(Vector3(f, 0.5f * f, -f), Quaternion::FromEuler(f, 2.0f * f, 3.0f * f), Vector3(1.0f, 2.0f, 3.0f));
+        }
+        return transforms;
+    }
+
+    static void Transform_FromTRSLoop(benchmark::State& state)
+    {
+        const auto transforms = MakeTransforms(static_cast<size_t>(state.range(0)));
+        std::vector<Mat4x4> matrices(transforms.size());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < transforms.size(); i++)
+            {
+                matrices[i] = Mat4x4::FromTRS(transforms[i].Position, transforms[i].Rotation, transforms[i].Scale);
+            }
+            benchmark::DoNotOptimize(matrices.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Transform_FromTRSLoop)->Arg(1 << 10)->Arg(100000);
+
+    static void TransformBuffer_ComputeWorldMatrices(benchmark::State& state)
+    {
+        const TransformBuffer buffer(MakeTransforms(static_cast<size_t>(state.range(0))));
+        std::vector<Mat4x4> matrices(buffer.Size());
+
+        for (auto _ : state)
+        {
+            buffer.ComputeWorldMatrices(matrices);
+            benchmark::DoNotOptimize(matrices.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(TransformBuffer_ComputeWorldMatrices)->Arg(1 << 10)->Arg(100000);
+}
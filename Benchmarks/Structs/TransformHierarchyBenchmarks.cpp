@@ -0,0 +1,99 @@
+#include "PCH.h"
+#include "Tbx/Math/TransformHierarchy.h"
+
+namespace Tbx::Benchmarks
+{
+    /// <summary>
+    /// Builds a scene of roots each with a few levels of children, about 100k nodes in total.
+    /// With underOneRoot the roots are all children of a single scene root at index 0.
+    /// </summary>
+    static TransformHierarchy MakeScene(bool underOneRoot = false)
+    {
+        TransformHierarchy hierarchy;
+        const size_t sceneRoot = underOneRoot ? hierarchy.Add(Transform()) : TransformHierarchy::NoParent;
+        for (int root = 0; root < 4000; root++)
+        {
+            const auto f = static_cast<float>(root);
+            const size_t rootIndex = hierarchy.Add(Transform(Vector3(f, 0.0f, 0.0f), Quaternion::FromEuler(0.0f, f, 0.0f), Vector3(1.0f)), sceneRoot);
+            for (int child = 0; child < 4; child++)
+            {
+                const size_t childIndex = hierarchy.Add(Transform(Vector3(0.0f, 1.0f, 0.0f), Quaternion::FromEuler(f, 0.0f, 0.0f), Vector3(1.0f)), rootIndex);
+                for (int leaf = 0; leaf < 5; leaf++)
+                {
+                    hierarchy.Add(Transform(Vector3(0.0f, 0.0f, 1.0f), Quaternion(), Vector3(0.5f)), childIndex);
+                }
+            }
+        }
+        hierarchy.UpdateAllWorldMatrices();
+        return hierarchy;
+    }
+
+    static void TransformHierarchy_FullRecompute(benchmark::State& state)
+    {
+        TransformHierarchy hierarchy = MakeScene();
+        for (auto _ : state)
+        {
+            hierarchy.UpdateAllWorldMatrices();
+            benchmark::DoNotOptimize(hierarchy.GetWorldMatrices().data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(hierarchy.Size()));
+    }
+    BENCHMARK(TransformHierarchy_FullRecompute);
+
+    /// <summary>
+    /// Moves the given percentage of root nodes each frame, leaving the rest of the scene static.
+    /// </summary>
+    static void TransformHierarchy_Incremental(benchmark::State& state)
+    {
+        TransformHierarchy hierarchy = MakeScene();
+        const auto movingPercent = static_cast<size_t>(state.range(0));
+        size_t frame = 0;
+        for (auto _ : state)
+        {
+            for (size_t root = 0; root < hierarchy.Size(); root += hierarchy.GetDescendantCount(root) + 1)
+            {
+                if ((root + frame) % 100 < movingPercent)
+                {
+                    Transform local = hierarchy.GetLocal(root);
+                    local.Position.Y += 0.01f;
+                    hierarchy.SetLocal(root, local);
+                }
+            }
+            benchmark::DoNotOptimize(hierarchy.UpdateWorldMatrices());
+            frame++;
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(hierarchy.Size()));
+    }
+    BENCHMARK(TransformHierarchy_Incremental)->Arg(1)->Arg(10)->Arg(50);
+
+    static void TransformHierarchy_ParallelFullRecompute(benchmark::State& state)
+    {
+        TransformHierarchy hierarchy = MakeScene();
+        ThreadPool pool(static_cast<size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            hierarchy.UpdateAllWorldMatrices(pool);
+            benchmark::DoNotOptimize(hierarchy.GetWorldMatrices().data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(hierarchy.Size()));
+    }
+    BENCHMARK(TransformHierarchy_ParallelFullRecompute)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
+
+    /// <summary>
+    /// Moves the root every other node hangs from each frame, so the whole scene is one dirty subtree.
+    /// </summary>
+    static void TransformHierarchy_ParallelMovedSceneRoot(benchmark::State& state)
+    {
+        TransformHierarchy hierarchy = MakeScene(true);
+        ThreadPool pool(static_cast<size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            Transform local = hierarchy.GetLocal(0);
+            local.Position.Y += 0.01f;
+            hierarchy.SetLocal(0, local);
+            benchmark::DoNotOptimize(hierarchy.UpdateWorldMatrices(pool));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(hierarchy.Size()));
+    }
+    BENCHMARK(TransformHierarchy_ParallelMovedSceneRoot)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
+}
@@ -0,0 +1,65 @@
+#include "PCH.h"
+#include "ApiBenchmark.h"
+
+namespace Tbx::Benchmarks
+{
+    TBX_API_BENCHMARK(Vector3_Normalize, MakeVector3, [](const Vector3& v) { return Vector3::Normalize(v); });
+    TBX_API_BENCHMARK(Vector3_Add, MakeVector3Pair, [](const auto& in) { return Vector3::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_Subtract, MakeVector3Pair, [](const auto& in) { return Vector3::Subtract(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_Multiply, MakeVector3Pair, [](const auto& in) { return Vector3::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_MultiplyScalar, MakeVector3Scalar, [](const auto& in) { return Vector3::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_Divide, MakeVector3Scalar, [](const auto& in) { return Vector3::Divide(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_Cross, MakeVector3Pair, [](const auto& in) { return Vector3::Cross(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_Dot, MakeVector3Pair, [](const auto& in) { return Vector3::Dot(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3_IsNearlyZero, MakeVector3, [](const Vector3& v) { return v.IsNearlyZero(); });
+    TBX_API_BENCHMARK(Vector3_ToString, MakeVector3, [](const Vector3& v) { return v.ToString(); });
+
+    TBX_API_BENCHMARK(Vector3_AddAssign, MakeVector3Pair, [](auto in) { return in.First += in.Second; });
+    TBX_API_BENCHMARK(Vector3_SubtractAssign, MakeVector3Pair, [](auto in) { return in.First -= in.Second; });
+    TBX_API_BENCHMARK(Vector3_MultiplyAssign, MakeVector3Pair, [](auto in) { return in.First *= in.Second; });
+    TBX_API_BENCHMARK(Vector3_MultiplyAssignScalar, MakeVector3Scalar, [](auto in) { return in.First *= in.Second; });
+
+    // Compare with the Vector3 benchmarks above
+    static Pair<Vector3A, Vector3A> MakeVector3APair(size_t i) { return { MakeVector3(i), MakeVector3(i + 13) }; }
+    static Pair<Vector3A, float> MakeVector3AScalar(size_t i) { return { MakeVector3(i), MakeFloat(i + 5) }; }
+    static Pair<Vector4, Vector4> MakeVector4Pair(size_t i) { return { { MakeVector3(i), 1.0f }, { MakeVector3(i + 13), 0.0f } }; }
+    static Pair<Vector4, float> MakeVector4Scalar(size_t i) { return { { MakeVector3(i), 1.0f }, MakeFloat(i + 5) }; }
+
+    TBX_API_BENCHMARK(Vector3A_Normalize, MakeVector3, [](const Vector3& v) { return Vector3A::Normalize(v); });
+    TBX_API_BENCHMARK(Vector3A_Add, MakeVector3APair, [](const auto& in) { return Vector3A::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3A_Subtract, MakeVector3APair, [](const auto& in) { return Vector3A::Subtract(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3A_Multiply, MakeVector3APair, [](const auto& in) { return Vector3A::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3A_MultiplyScalar, MakeVector3AScalar, [](const auto& in) { return Vector3A::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3A_Cross, MakeVector3APair, [](const auto& in) { return Vector3A::Cross(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3A_Dot, MakeVector3APair, [](const auto& in) { return Vector3A::Dot(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3A_ToString, MakeVector3, [](const Vector3& v) { return Vector3A(v).ToString(); });
+    TBX_API_BENCHMARK(Vector4_Normalize, MakeVector4Pair, [](const auto& in) { return Vector4::Normalize(in.First); });
+    TBX_API_BENCHMARK(Vector4_Add, MakeVector4Pair, [](const auto& in) { return Vector4::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector4_Subtract, MakeVector4Pair, [](const auto& in) { return Vector4::Subtract(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector4_Multiply, MakeVector4Pair, [](const auto& in) { return Vector4::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector4_MultiplyScalar, MakeVector4Scalar, [](const auto& in) { return Vector4::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector4_Divide, MakeVector4Scalar, [](const auto& in) { return Vector4::Divide(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector4_Dot, MakeVector4Pair, [](const auto& in) { return Vector4::Dot(in.First, in.Second); });
+
+    static Pair<Vector2, Vector2> MakeVector2Pair(size_t i) { return { MakeVector3(i), MakeVector3(i + 13) }; }
+    static Pair<Vector2, float> MakeVector2Scalar(size_t i) { return { MakeVector3(i), MakeFloat(i + 5) }; }
+
+    TBX_API_BENCHMARK(Vector2_Normalize, MakeVector2Pair, [](const auto& in) { return Vector2::Normalize(in.First); });
+    TBX_API_BENCHMARK(Vector2_Add, MakeVector2Pair, [](const auto& in) { return Vector2::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector2_Subtract, MakeVector2Pair, [](const auto& in) { return Vector2::Subtract(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector2_Multiply, MakeVector2Pair, [](const auto& in) { return Vector2::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector2_MultiplyScalar, MakeVector2Scalar, [](const auto& in) { return Vector2::Multiply(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector2_Divide, MakeVector2Scalar, [](const auto& in) { return Vector2::Divide(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector2_Dot, MakeVector2Pair, [](const auto& in) { return Vector2::Dot(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector2_ToString, MakeVector3, [](const Vector3& v) { return Vector2(v.X, v.Y).ToString(); });
+    TBX_API_BENCHMARK(Vector2I_FromVector3, MakeVector3, [](const Vector3& v) { return Vector2I(v * 100.0f); });
+    TBX_API_BENCHMARK(Vector2I_ToString, MakeVector3, [](const Vector3& v) { return Vector2I(v * 100.0f).ToString(); });
+
+    // Double precision versions of the Vector3 benchmarks, compiled from the same Vec kernels
+    static Pair<Vector3D, Vector3D> MakeVector3DPair(size_t i) { return { Vector3D(MakeVector3(i)), Vector3D(MakeVector3(i + 13)) }; }
+
+    TBX_API_BENCHMARK(Vector3D_Normalize, MakeVector3, [](const Vector3& v) { return Vector3D::Normalize(Vector3D(v)); });
+    TBX_API_BENCHMARK(Vector3D_Add, MakeVector3DPair, [](const auto& in) { return Vector3D::Add(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3D_Cross, MakeVector3DPair, [](const auto& in) { return Vector3D::Cross(in.First, in.Second); });
+    TBX_API_BENCHMARK(Vector3D_Dot, MakeVector3DPair, [](const auto& in) { return Vector3D::Dot(in.First, in.Second); });
+}
@@ -0,0 +1,39 @@
+project "Glm Maths Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "Off"
+    optimize "Speed"
+
+    pchheader "PCH.h"
+    pchsource "PCH.cpp" -- Full path MUST be specified relative to the premake5.lua (this) script.
+
+    files
+    {
+        "./**.h",
+        "./**.c",
+        "./**.hpp",
+        "./**.cpp",
+        "./**.md",
+        "./**.lua",
+    }
+    includedirs
+    {
+        "./",
+        "../Include",
+        _MAIN_SCRIPT_DIR .. "/Dependencies/glm",
+        "%{Using.googlebenchmark}",
+        "%{Using.googlebenchmark}/include",
+    }
+    links
+    {
+        "googlebenchmark",
+        "Glm Maths"
+    }
+
+    filter "options:tbx-math-inline"
+        defines
+        {
+            "TBX_MATH_INLINE"
+        }
+    filter {}
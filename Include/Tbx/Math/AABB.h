@@ -0,0 +1,69 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Vectors.h"
+#include "Tbx/Math/Mat4x4.h"
+#include <limits>
+#include <string>
+
+namespace Tbx
+{
+    /// <summary>
+    /// An axis aligned bounding box described by its minimum and maximum corners.
+    /// A default constructed box is empty (min is +infinity and max is -infinity), so merging anything into it yields that thing.
+    /// </summary>
+    struct EXPORT AABB
+    {
+    public:
+        AABB() = default;
+        constexpr AABB(const Vector3& min, const Vector3& max)
+            : Min(min), Max(max) {}
+
+        std::string ToString() const;
+
+        Vector3 GetCenter() const;
+        Vector3 GetExtents() const;
+        Vector3 GetSize() const;
+        bool IsEmpty() const;
+
+        /// <summary>
+        /// Creates a box from its center and half size.
+        /// </summary>
+        static AABB FromCenterExtents(const Vector3& center, const Vector3& extents);
+
+        /// <summary>
+        /// Returns the smallest box that encloses both boxes.
+        /// </summary>
+        static AABB Merge(const AABB& lhs, const AABB& rhs);
+
+        /// <summary>
+        /// Returns the smallest box that encloses the box and the point.
+        /// </summary>
+        static AABB Merge(const AABB& box, const Vector3& point);
+
+        /// <summary>
+        /// Returns true if the point is inside or on the surface of the box.
+        /// </summary>
+        static bool Contains(const AABB& box, const Vector3& point);
+
+        /// <summary>
+        /// Returns true if the inner box is entirely inside the outer box.
+        /// </summary>
+        static bool Contains(const AABB& outer, const AABB& inner);
+
+        /// <summary>
+        /// Returns true if the boxes intersect, touching boxes count as overlapping.
+        /// </summary>
+        static bool Overlaps(const AABB& lhs, const AABB& rhs);
+
+        /// <summary>
+        /// Returns the box that encloses the given box after it has been transformed by the matrix.
+        /// Uses Arvo's method: each output axis starts at the translation and adds, for every input axis, the smaller and larger
+        /// of the matrix entry times the box min and max. This gives the same box as transforming all eight corners for a fraction of the work.
+        /// Empty boxes are returned unchanged.
+        /// </summary>
+        static AABB TransformBy(const AABB& box, const Mat4x4& matrix);
+
+        Vector3 Min = std::numeric_limits<float>::infinity();
+        Vector3 Max = -std::numeric_limits<float>::infinity();
+    };
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/AlignedAllocator.h"
+#include "Tbx/Math/AABB.h"
+#include "Tbx/Math/Int.h"
+#include <span>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Stores many axis aligned bounding boxes as a structure of arrays, with every min and max component in its own aligned array.
+    /// This lets the batch operations below test or transform several boxes at a time with SIMD.
+    /// Tests write their results into a bitmask: bit i of the mask (mask[i / 64] >> (i % 64)) is set when box i passes.
+    /// </summary>
+    class EXPORT AABBBuffer
+    {
+    public:
+        using FloatArray = std::vector<float, AlignedAllocator<float>>;
+
+        AABBBuffer() = default;
+        explicit AABBBuffer(std::span<const AABB> boxes);
+
+        /// <summary>
+        /// Adds a box to the end of the buffer and returns its index.
+        /// </summary>
+        size_t Add(const AABB& box);
+
+        /// <summary>
+        /// Removes the box at the given index by moving the last box into its place.
+        /// </summary>
+        void Remove(size_t index);
+
+        /// <summary>
+        /// Get and Set throw std::out_of_range if index is not below Size(), like Remove.
+        /// </summary>
+        AABB Get(size_t index) const;
+        void Set(size_t index, const AABB& box);
+
+        void Reserve(size_t count);
+        void Resize(size_t count);
+        void Clear();
+        size_t Size() const { return _minX.size(); }
+
+        /// <summary>
+        /// Returns the number of 64 bit words a mask needs to hold one bit per box in the buffer.
+        /// </summary>
+        size_t GetMaskWordCount() const { return (Size() + 63) / 64; }
+
+        /// <summary>
+        /// Returns the box that encloses every box in the buffer.
+        /// </summary>
+        AABB ComputeBounds() const;
+
+        /// <summary>
+        /// Sets bit i of the mask if box i contains the point.
+        /// The mask must have at least GetMaskWordCount() words.
+        /// </summary>
+        void Contains(const Vector3& point, std::span<uint64> outMask) const;
+
+        /// <summary>
+        /// Sets bit i of the mask if box i is entirely inside the outer box.
+        /// The mask must have at least GetMaskWordCount() words.
+        /// </summary>
+        void ContainedBy(const AABB& outer, std::span<uint64> outMask) const;
+
+        /// <summary>
+        /// Sets bit i of the mask if box i overlaps the query box.
+        /// The mask must have at least GetMaskWordCount() words.
+        /// </summary>
+        void Overlaps(const AABB& query, std::span<uint64> outMask) const;
+
+        /// <summary>
+        /// Transforms every box by the same matrix using Arvo's method, see AABB::TransformBy.
+        /// Out is resized to match this buffer and may be this buffer.
+        /// </summary>
+        void TransformBy(const Mat4x4& matrix, AABBBuffer& out) const;
+
+        /// <summary>
+        /// Transforms box i by matrices[i] using Arvo's method, see AABB::TransformBy.
+        /// Out is resized to match this buffer and may be this buffer.
+        /// </summary>
+        void TransformBy(std::span<const Mat4x4> matrices, AABBBuffer& out) const;
+
+        /// <summary>
+        /// Merges the boxes pairwise, out[i] = Merge(lhs[i], rhs[i]).
+        /// Out is resized to match the inputs and may be either input.
+        /// </summary>
+        static void Merge(const AABBBuffer& lhs, const AABBBuffer& rhs, AABBBuffer& out);
+
+        /// <summary>
+        /// Views of the min and max component arrays for batch kernels. They have a fixed size, so all six stay in sync.
+        /// </summary>
+        std::span<const float> GetMinX() const { return _minX; }
+        std::span<const float> GetMinY() const { return _minY; }
+        std::span<const float> GetMinZ() const { return _minZ; }
+        std::span<const float> GetMaxX() const { return _maxX; }
+        std::span<const float> GetMaxY() const { return _maxY; }
+        std::span<const float> GetMaxZ() const { return _maxZ; }
+
+        std::span<float> GetMinX() { return _minX; }
+        std::span<float> GetMinY() { return _minY; }
+        std::span<float> GetMinZ() { return _minZ; }
+        std::span<float> GetMaxX() { return _maxX; }
+        std::span<float> GetMaxY() { return _maxY; }
+        std::span<float> GetMaxZ() { return _maxZ; }
+
+    private:
+        FloatArray _minX;
+        FloatArray _minY;
+        FloatArray _minZ;
+        FloatArray _maxX;
+        FloatArray _maxY;
+        FloatArray _maxZ;
+    };
+}
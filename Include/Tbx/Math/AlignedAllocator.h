@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Allocator that aligns allocations to the given alignment, so SIMD kernels can use aligned loads and stores on std::vector storage.
+    /// </summary>
+    template <typename T, std::size_t Alignment = 32>
+    struct AlignedAllocator
+    {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename U>
+        constexpr explicit(false) AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* ptr, std::size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t(Alignment));
+        }
+
+        template <typename U>
+        friend bool operator == (const AlignedAllocator&, const AlignedAllocator<U, Alignment>&) { return true; }
+    };
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/AlignedAllocator.h"
+#include "Tbx/Math/Quaternion.h"
+#include "Tbx/Math/Vectors.h"
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// The keyframes of a skeletal animation, with a position, rotation and scale track for every bone.
+    /// Each track stores its key times and every value component in their own aligned arrays, sorted by time.
+    /// </summary>
+    class EXPORT AnimationClip
+    {
+    public:
+        using FloatArray = std::vector<float, AlignedAllocator<float>>;
+
+        /// <summary>
+        /// The keys of a position or scale track.
+        /// </summary>
+        struct Vector3Track
+        {
+            size_t Size() const { return Times.size(); }
+            Vector3 Get(size_t key) const { return { X[key], Y[key], Z[key] }; }
+
+            FloatArray Times;
+            FloatArray X;
+            FloatArray Y;
+            FloatArray Z;
+        };
+
+        /// <summary>
+        /// The keys of a rotation track.
+        /// </summary>
+        struct QuaternionTrack
+        {
+            size_t Size() const { return Times.size(); }
+            Quaternion Get(size_t key) const { return { X[key], Y[key], Z[key], W[key] }; }
+
+            FloatArray Times;
+            FloatArray X;
+            FloatArray Y;
+            FloatArray Z;
+            FloatArray W;
+        };
+
+        AnimationClip() = default;
+        explicit AnimationClip(size_t boneCount);
+
+        /// <summary>
+        /// Adds a key to a bones position track, keeping the track sorted by time.
+        /// A key at the same time as an existing key replaces it.
+        /// </summary>
+        void AddPositionKey(size_t bone, float time, const Vector3& position);
+
+        /// <summary>
+        /// Adds a key to a bones rotation track, keeping the track sorted by time.
+        /// A key at the same time as an existing key replaces it.
+        /// </summary>
+        void AddRotationKey(size_t bone, float time, const Quaternion& rotation);
+
+        /// <summary>
+        /// Adds a key to a bones scale track, keeping the track sorted by time.
+        /// A key at the same time as an existing key replaces it.
+        /// </summary>
+        void AddScaleKey(size_t bone, float time, const Vector3& scale);
+
+        const Vector3Track& GetPositionTrack(size_t bone) const;
+        const QuaternionTrack& GetRotationTrack(size_t bone) const;
+        const Vector3Track& GetScaleTrack(size_t bone) const;
+        size_t GetBoneCount() const { return _positions.size(); }
+
+        /// <summary>
+        /// Gets the time of the last key of any track.
+        /// </summary>
+        float GetDuration() const { return _duration; }
+
+    private:
+        std::vector<Vector3Track> _positions = {};
+        std::vector<QuaternionTrack> _rotations = {};
+        std::vector<Vector3Track> _scales = {};
+        float _duration = 0.0f;
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/AnimationClip.h"
+#include "Tbx/Math/Int.h"
+#include "Tbx/Math/Transform.h"
+#include "Tbx/Math/TransformBuffer.h"
+#include <span>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Evaluates the pose of an AnimationClip at a given time.
+    /// Every track keeps a cursor to the key it was last sampled at, so playing forward only steps the cursors
+    /// and costs O(1) per track instead of a binary search. Seeking backwards or far ahead falls back to a binary search.
+    /// Each animated instance should own its sampler, the clip must outlive it and must not gain keys while it is sampled.
+    /// </summary>
+    class EXPORT AnimationSampler
+    {
+    public:
+        explicit AnimationSampler(const AnimationClip& clip);
+
+        /// <summary>
+        /// Writes the local transform of every bone at the given time into the pose.
+        /// Positions and scales are lerped and rotations FastSlerped between the surrounding keys, clamped to the first and last key.
+        /// Components whose track has no keys are left unchanged, so a pose can start from the bind pose.
+        /// Throws std::out_of_range if the pose has fewer transforms than the clip has bones.
+        /// </summary>
+        void Sample(float time, std::span<Transform> outPose);
+
+        /// <summary>
+        /// Writes the local transform of every bone at the given time into the pose, see Sample(float, std::span<Transform>).
+        /// </summary>
+        void Sample(float time, TransformBuffer& outPose);
+
+        /// <summary>
+        /// Moves every cursor back to the first key.
+        /// </summary>
+        void Reset();
+
+        const AnimationClip& GetClip() const { return *_clip; }
+
+    private:
+        /// <summary>
+        /// Samples every track with keys into the scratch arrays below.
+        /// </summary>
+        void Evaluate(float time);
+
+        const AnimationClip* _clip = nullptr;
+        std::vector<uint32> _positionCursors = {};
+        std::vector<uint32> _rotationCursors = {};
+        std::vector<uint32> _scaleCursors = {};
+
+        std::vector<Vector3> _positions = {};
+        std::vector<Vector3> _scales = {};
+
+        // The keys around each sampled rotation are gathered so they can be blended in one FastSlerpBatch
+        size_t _rotationCount = 0;
+        std::vector<uint32> _rotationBones = {};
+        std::vector<Quaternion> _rotationFrom = {};
+        std::vector<Quaternion> _rotationTo = {};
+        std::vector<float> _rotationWeights = {};
+        std::vector<Quaternion> _rotations = {};
+    };
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/AABB.h"
+#include "Tbx/Math/AlignedAllocator.h"
+#include "Tbx/Math/Int.h"
+#include <span>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A bounding volume hierarchy over a set of primitive boxes, used to answer ray casts and overlap queries without scanning every primitive.
+    /// The tree is built top down with a binned surface area heuristic and stored as a flat array of 32 byte nodes.
+    /// The root is node 0 and node 1 is left unused, so the two children of every node start on an even index and share one 64 byte cache line.
+    /// Primitives are referred to by their index in the span the hierarchy was built from.
+    /// Empty primitive boxes are kept in a leaf so a refit can give them real bounds, but no query ever returns them.
+    /// </summary>
+    class EXPORT BVH
+    {
+    public:
+        /// <summary>
+        /// A node of the flattened tree. Leaves have a non zero Count and hold the primitives
+        /// GetPrimitiveIndices()[First, First + Count), inner nodes have a Count of zero and their children at First and First + 1.
+        /// </summary>
+        struct alignas(32) Node
+        {
+            Vector3 Min;
+            uint32 First = 0;
+            Vector3 Max;
+            uint32 Count = 0;
+
+            bool IsLeaf() const { return Count != 0; }
+        };
+
+        /// <summary>
+        /// The closest primitive hit by a ray and the distance along the ray to where it enters that primitive's box.
+        /// </summary>
+        struct RayHit
+        {
+            uint32 Primitive = 0;
+            float Distance = 0.0f;
+        };
+
+        /// <summary>
+        /// The largest number of primitives a leaf holds before the builder tries to split it.
+        /// </summary>
+        static constexpr uint32 MaxLeafSize = 4;
+
+        BVH() = default;
+        explicit BVH(std::span<const AABB> primitives);
+
+        /// <summary>
+        /// Rebuilds the hierarchy from scratch over the given primitives.
+        /// </summary>
+        void Build(std::span<const AABB> primitives);
+
+        /// <summary>
+        /// Updates the bounds of every primitive and refits the existing tree bottom up without changing its structure.
+        /// This is much cheaper than a rebuild, but query performance degrades if the primitives move far from where they were built.
+        /// The span must be the same size as the one the hierarchy was built from.
+        /// </summary>
+        void Refit(std::span<const AABB> primitives);
+
+        /// <summary>
+        /// Updates the bounds of a single primitive and grows or shrinks its ancestors, stopping as soon as a node's bounds no longer change.
+        /// </summary>
+        void Refit(uint32 primitive, const AABB& bounds);
+
+        /// <summary>
+        /// Finds the closest primitive whose box the ray hits within maxDistance.
+        /// The direction does not need to be normalized, distances are measured in multiples of it.
+        /// Returns false if nothing was hit.
+        /// </summary>
+        bool RayCast(const Vector3& origin, const Vector3& direction, float maxDistance, RayHit& outHit) const;
+
+        /// <summary>
+        /// Appends the index of every primitive whose box overlaps the sphere to outPrimitives.
+        /// </summary>
+        void QuerySphere(const Vector3& center, float radius, std::vector<uint32>& outPrimitives) const;
+
+        /// <summary>
+        /// Appends the index of every primitive whose box overlaps the query box to outPrimitives.
+        /// </summary>
+        void QueryAABB(const AABB& box, std::vector<uint32>& outPrimitives) const;
+
+        const AABB& GetPrimitiveBounds(uint32 primitive) const { return _primitiveBounds[primitive]; }
+        std::span<const Node> GetNodes() const { return _nodes; }
+        std::span<const uint32> GetPrimitiveIndices() const { return _primitiveIndices; }
+        size_t GetPrimitiveCount() const { return _primitiveBounds.size(); }
+
+    private:
+        static constexpr uint32 NoParent = static_cast<uint32>(-1);
+
+        void UpdateNodeBounds(uint32 node);
+
+        std::vector<Node, AlignedAllocator<Node, 64>> _nodes = {};
+        std::vector<uint32> _parents = {};
+        std::vector<uint32> _primitiveIndices = {};
+        std::vector<uint32> _leafOfPrimitive = {};
+        std::vector<AABB> _primitiveBounds = {};
+        uint32 _depth = 0;
+    };
+}
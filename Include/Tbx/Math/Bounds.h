@@ -7,12 +7,17 @@ namespace Tbx
     struct EXPORT Bounds
     {
     public:
-        Bounds(float left, float right, float top, float bottom) 
+        constexpr Bounds(float left, float right, float top, float bottom)
             : Left(left), Right(right), Top(top), Bottom(bottom) {}
 
         std::string ToString() const;
 
-        static Bounds FromOrthographicProjection(float size, float aspect);
+        static constexpr Bounds FromOrthographicProjection(float size, float aspect)
+        {
+            const float halfWidth = size * aspect;
+            const float halfHeight = size;
+            return { -halfWidth, halfWidth, halfHeight, -halfHeight };
+        }
         static Bounds FromPerspectiveProjection(float fov, float aspectRatio, float zNear);
 
         float Left;
@@ -0,0 +1,82 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Int.h"
+#include "Tbx/Math/Quaternion.h"
+#include "Tbx/Math/Vectors.h"
+#include <array>
+#include <span>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A quaternion packed into 48 bits by QuaternionCodec::Pack48, stored as three 16 bit words so arrays of it stay 6 bytes per element.
+    /// </summary>
+    struct EXPORT PackedQuaternion48
+    {
+        friend constexpr bool operator == (const PackedQuaternion48& lhs, const PackedQuaternion48& rhs) = default;
+
+        std::array<uint16, 3> Bits = {};
+    };
+
+    /// <summary>
+    /// Packs unit quaternions with the smallest three encoding: the index of the largest component in 2 bits, then the other three
+    /// components quantized to [-1/sqrt(2), 1/sqrt(2)], which is the range they are limited to. The largest component is rebuilt
+    /// from the unit length on unpack, and its sign is made positive on pack since q and -q are the same rotation.
+    /// The three stored components are off by at most 0.7072 / (2^bits - 1). Measured maximum rotation errors are
+    /// 0.0044 radians for 32 bits (10 bits per component), 1.4e-4 radians for 48 bits (15 bits) and 5e-6 radians for 64 bits (20 bits).
+    /// Input quaternions must be normalized.
+    /// </summary>
+    struct EXPORT QuaternionCodec
+    {
+    public:
+        static uint32 Pack32(const Quaternion& quaternion);
+        static Quaternion Unpack32(uint32 packed);
+        static PackedQuaternion48 Pack48(const Quaternion& quaternion);
+        static Quaternion Unpack48(const PackedQuaternion48& packed);
+        static uint64 Pack64(const Quaternion& quaternion);
+        static Quaternion Unpack64(uint64 packed);
+
+        /// <summary>
+        /// Packs every quaternion like Pack32, several quaternions per SIMD iteration. Results match Pack32 bit for bit.
+        /// Throws std::out_of_range if out is smaller than quaternions.
+        /// </summary>
+        static void Pack32Batch(std::span<const Quaternion> quaternions, std::span<uint32> out);
+        /// <summary>
+        /// Unpacks every quaternion like Unpack32, several quaternions per SIMD iteration.
+        /// Throws std::out_of_range if out is smaller than packed.
+        /// </summary>
+        static void Unpack32Batch(std::span<const uint32> packed, std::span<Quaternion> out);
+        static void Pack48Batch(std::span<const Quaternion> quaternions, std::span<PackedQuaternion48> out);
+        static void Unpack48Batch(std::span<const PackedQuaternion48> packed, std::span<Quaternion> out);
+        static void Pack64Batch(std::span<const Quaternion> quaternions, std::span<uint64> out);
+        static void Unpack64Batch(std::span<const uint64> packed, std::span<Quaternion> out);
+    };
+
+    /// <summary>
+    /// Encodes unit normals with the octahedral mapping: the normal is projected onto the octahedron |x| + |y| + |z| = 1,
+    /// whose lower half is folded over the upper half, and the resulting square is stored as two signed normalized integers.
+    /// Measured maximum angular errors are 0.0165 radians for 16 bits (8 bits per axis) and 6.5e-5 radians for 32 bits (16 bits per axis).
+    /// A zero vector encodes to (0, 0, 1). Decoded normals are normalized.
+    /// </summary>
+    struct EXPORT NormalCodec
+    {
+    public:
+        static uint16 Encode16(const Vector3& normal);
+        static Vector3 Decode16(uint16 encoded);
+        static uint32 Encode32(const Vector3& normal);
+        static Vector3 Decode32(uint32 encoded);
+
+        /// <summary>
+        /// Encodes every normal like Encode16, several normals per SIMD iteration. Results match Encode16 bit for bit.
+        /// Throws std::out_of_range if out is smaller than normals.
+        /// </summary>
+        static void Encode16Batch(std::span<const Vector3> normals, std::span<uint16> out);
+        /// <summary>
+        /// Decodes every normal like Decode16, several normals per SIMD iteration.
+        /// Throws std::out_of_range if out is smaller than encoded.
+        /// </summary>
+        static void Decode16Batch(std::span<const uint16> encoded, std::span<Vector3> out);
+        static void Encode32Batch(std::span<const Vector3> normals, std::span<uint32> out);
+        static void Decode32Batch(std::span<const uint32> encoded, std::span<Vector3> out);
+    };
+}
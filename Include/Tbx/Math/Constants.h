@@ -9,51 +9,53 @@ namespace Tbx::Constants
 {
     namespace Vector3
     {
-        EXPORT inline const Tbx::Vector3& One = { 1, 1, 1 };
-        EXPORT inline const Tbx::Vector3& Zero = { 0, 0, 0 };
-        EXPORT inline const Tbx::Vector3& Identity = One;
+        EXPORT inline constexpr Tbx::Vector3 One = { 1, 1, 1 };
+        EXPORT inline constexpr Tbx::Vector3 Zero = { 0, 0, 0 };
+        EXPORT inline constexpr Tbx::Vector3 Identity = One;
     }
 
     namespace Vector2
     {
-        EXPORT inline const Tbx::Vector2& One = { 1, 1 };
-        EXPORT inline const Tbx::Vector2& Zero = { 0, 0 };
-        EXPORT inline const Tbx::Vector2& Identity = One;
+        EXPORT inline constexpr Tbx::Vector2 One = { 1, 1 };
+        EXPORT inline constexpr Tbx::Vector2 Zero = { 0, 0 };
+        EXPORT inline constexpr Tbx::Vector2 Identity = One;
     }
 
     namespace Vector2I
     {
-        EXPORT inline const Tbx::Vector2I& One = { 1, 1 };
-        EXPORT inline const Tbx::Vector2I& Zero = { 0, 0 };
-        EXPORT inline const Tbx::Vector2I& Identity = One;
+        EXPORT inline constexpr Tbx::Vector2I One = { 1, 1 };
+        EXPORT inline constexpr Tbx::Vector2I Zero = { 0, 0 };
+        EXPORT inline constexpr Tbx::Vector2I Identity = One;
     }
 
     namespace Quaternion
     {
-        EXPORT inline const Tbx::Quaternion& Identity = { 0, 0, 0, 1 };
+        EXPORT inline constexpr Tbx::Quaternion Identity = { 0, 0, 0, 1 };
     }
 
     namespace Mat4x4
     {
-        EXPORT inline const Tbx::Mat4x4& Zero =
+        EXPORT inline constexpr Tbx::Mat4x4 Zero =
         {
+            ColumnMajor,
             0.0f, 0.0f, 0.0f, 0.0f,
             0.0f, 0.0f, 0.0f, 0.0f,
             0.0f, 0.0f, 0.0f, 0.0f,
             0.0f, 0.0f, 0.0f, 0.0f
         };
 
-        EXPORT inline const Tbx::Mat4x4& Identity =
+        EXPORT inline constexpr Tbx::Mat4x4 Identity =
         {
-            { 1.0f, 0.0f, 0.0f, 0.0f },
-            { 0.0f, 1.0f, 0.0f, 0.0f },
-            { 0.0f, 0.0f, 1.0f, 0.0f },
-            { 0.0f, 0.0f, 0.0f, 1.0f }
+            RowMajor,
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
         };
     }
 
     namespace Bounds
     {
-        EXPORT inline const Tbx::Bounds& Identity = { -1.0f, 1.0f, -1.0f, 1.0f };
+        EXPORT inline constexpr Tbx::Bounds Identity = { -1.0f, 1.0f, -1.0f, 1.0f };
     }
 }
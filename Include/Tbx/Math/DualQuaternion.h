@@ -0,0 +1,126 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Inline.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/Quaternion.h"
+#include "Tbx/Math/Transform.h"
+#include "Tbx/Math/Vectors.h"
+#include <span>
+#include <string>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Represents a rigid transform, a rotation followed by a translation, in 8 floats.
+    /// The real part is the rotation and the dual part is half the translation times the rotation.
+    /// Concatenating two dual quaternions is two quaternion products cheaper than a Mat4x4 multiply, and blending them
+    /// keeps the result rigid, unlike blending matrices. Dual quaternions cannot carry scale.
+    /// </summary>
+    struct EXPORT DualQuaternion
+    {
+    public:
+        DualQuaternion() = default;
+
+        constexpr DualQuaternion(const Quaternion& real, const Quaternion& dual)
+            : Real(real), Dual(dual) {}
+
+        friend TBX_MATH_CONSTEXPR_FN DualQuaternion operator * (const DualQuaternion& lhs, const DualQuaternion& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Vector3 operator * (const DualQuaternion& lhs, const Vector3& rhs) { return TransformPoint(lhs, rhs); }
+
+        std::string ToString() const;
+
+        /// <summary>
+        /// Creates a dual quaternion that rotates and then translates.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN DualQuaternion FromRotationTranslation(const Quaternion& rotation, const Vector3& translation);
+        /// <summary>
+        /// Creates a dual quaternion from the position and rotation of a transform, its scale is dropped.
+        /// </summary>
+        static DualQuaternion FromTransform(const Transform& transform);
+        /// <summary>
+        /// Creates a dual quaternion from the rotation and translation of an affine matrix.
+        /// Any scale is removed by normalizing the basis vectors, so the matrix should not be sheared.
+        /// </summary>
+        static DualQuaternion FromMat4x4(const Mat4x4& matrix);
+        /// <summary>
+        /// Converts a unit dual quaternion to a transform with a scale of one.
+        /// </summary>
+        static Transform ToTransform(const DualQuaternion& dualQuaternion);
+        /// <summary>
+        /// Converts a unit dual quaternion to the matrix that applies the same rotation and translation.
+        /// </summary>
+        static Mat4x4 ToMat4x4(const DualQuaternion& dualQuaternion);
+
+        /// <summary>
+        /// Gets the translation of a unit dual quaternion.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 GetTranslation(const DualQuaternion& dualQuaternion);
+
+        /// <summary>
+        /// Concatenates two transforms, the result applies rhs first and then lhs like Mat4x4 and Quaternion multiplication.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN DualQuaternion Multiply(const DualQuaternion& lhs, const DualQuaternion& rhs);
+        /// <summary>
+        /// Inverts a unit dual quaternion, which is its quaternion conjugate.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN DualQuaternion Inverse(const DualQuaternion& dualQuaternion);
+        /// <summary>
+        /// Scales the dual quaternion to a unit real part and removes the part of the dual that is not orthogonal to it,
+        /// so it is a rigid transform again after blending or accumulated rounding.
+        /// </summary>
+        static TBX_MATH_INLINE_FN DualQuaternion Normalize(const DualQuaternion& dualQuaternion);
+        /// <summary>
+        /// Rotates and then translates a point by a unit dual quaternion.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformPoint(const DualQuaternion& dualQuaternion, const Vector3& point);
+        /// <summary>
+        /// Rotates a direction by a unit dual quaternion, ignoring the translation.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformDirection(const DualQuaternion& dualQuaternion, const Vector3& direction);
+
+        /// <summary>
+        /// Blends two unit dual quaternions with dual quaternion linear blending (DLB), along the shortest rotation.
+        /// The result is normalized so it is always rigid.
+        /// </summary>
+        static TBX_MATH_INLINE_FN DualQuaternion Blend(const DualQuaternion& from, const DualQuaternion& to, float t);
+        /// <summary>
+        /// Blends any number of unit dual quaternions by their weights with DLB, e.g. the joints influencing a skinned vertex.
+        /// Every rotation is flipped onto the hemisphere of the first one before the weighted sum is normalized.
+        /// Throws std::out_of_range if weights is smaller than dualQuaternions.
+        /// </summary>
+        static DualQuaternion Blend(std::span<const DualQuaternion> dualQuaternions, std::span<const float> weights);
+
+        /// <summary>
+        /// Concatenates every pair of dual quaternions like Multiply, several pairs per SIMD iteration.
+        /// Throws std::out_of_range if rhs or out is smaller than lhs.
+        /// </summary>
+        static void MultiplyBatch(std::span<const DualQuaternion> lhs, std::span<const DualQuaternion> rhs, std::span<DualQuaternion> out);
+        /// <summary>
+        /// Blends every pair of dual quaternions by the same t like Blend, several pairs per SIMD iteration.
+        /// Throws std::out_of_range if to or out is smaller than from.
+        /// </summary>
+        static void BlendBatch(std::span<const DualQuaternion> from, std::span<const DualQuaternion> to, float t, std::span<DualQuaternion> out);
+        /// <summary>
+        /// Transforms every point by the same dual quaternion like TransformPoint, several points per SIMD iteration.
+        /// Throws std::out_of_range if out is smaller than points.
+        /// </summary>
+        static void TransformPointBatch(const DualQuaternion& dualQuaternion, std::span<const Vector3> points, std::span<Vector3> out);
+        /// <summary>
+        /// Converts every transform like FromTransform, several transforms per SIMD iteration.
+        /// Throws std::out_of_range if out is smaller than transforms.
+        /// </summary>
+        static void FromTransformBatch(std::span<const Transform> transforms, std::span<DualQuaternion> out);
+        /// <summary>
+        /// Converts every dual quaternion like ToMat4x4, several per SIMD iteration, e.g. to upload a pose for rendering.
+        /// Throws std::out_of_range if out is smaller than dualQuaternions.
+        /// </summary>
+        static void ToMat4x4Batch(std::span<const DualQuaternion> dualQuaternions, std::span<Mat4x4> out);
+
+        Quaternion Real = { 0.0f, 0.0f, 0.0f, 1.0f };
+        Quaternion Dual = { 0.0f, 0.0f, 0.0f, 0.0f };
+    };
+}
+
+#ifdef TBX_MATH_INLINE
+    #include "Tbx/Math/DualQuaternion.inl"
+#endif
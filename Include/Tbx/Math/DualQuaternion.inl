@@ -0,0 +1,105 @@
+#pragma once
+#include "Tbx/Math/DualQuaternion.h"
+#include <cmath>
+
+// Hot DualQuaternion arithmetic.
+// Included by DualQuaternion.h when TBX_MATH_INLINE is defined, otherwise compiled into the library by DualQuaternion.cpp.
+
+namespace Tbx
+{
+    TBX_MATH_CONSTEXPR_FN DualQuaternion DualQuaternion::FromRotationTranslation(const Quaternion& rotation, const Vector3& translation)
+    {
+        const Quaternion dual = Quaternion::Multiply({ translation.X, translation.Y, translation.Z, 0.0f }, rotation);
+        return { rotation, { dual.X * 0.5f, dual.Y * 0.5f, dual.Z * 0.5f, dual.W * 0.5f } };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 DualQuaternion::GetTranslation(const DualQuaternion& dualQuaternion)
+    {
+        // The vector part of 2 * dual * conjugate(real)
+        const Quaternion& real = dualQuaternion.Real;
+        const Quaternion& dual = dualQuaternion.Dual;
+        return
+        {
+            2.0f * (real.W * dual.X - dual.W * real.X + real.Y * dual.Z - real.Z * dual.Y),
+            2.0f * (real.W * dual.Y - dual.W * real.Y + real.Z * dual.X - real.X * dual.Z),
+            2.0f * (real.W * dual.Z - dual.W * real.Z + real.X * dual.Y - real.Y * dual.X)
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN DualQuaternion DualQuaternion::Multiply(const DualQuaternion& lhs, const DualQuaternion& rhs)
+    {
+        return
+        {
+            Quaternion::Multiply(lhs.Real, rhs.Real),
+            Quaternion::Add(Quaternion::Multiply(lhs.Real, rhs.Dual), Quaternion::Multiply(lhs.Dual, rhs.Real))
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN DualQuaternion DualQuaternion::Inverse(const DualQuaternion& dualQuaternion)
+    {
+        const Quaternion& real = dualQuaternion.Real;
+        const Quaternion& dual = dualQuaternion.Dual;
+        return { { -real.X, -real.Y, -real.Z, real.W }, { -dual.X, -dual.Y, -dual.Z, dual.W } };
+    }
+
+    TBX_MATH_INLINE_FN DualQuaternion DualQuaternion::Normalize(const DualQuaternion& dualQuaternion)
+    {
+        const float length = std::sqrt(Quaternion::Dot(dualQuaternion.Real, dualQuaternion.Real));
+        if (length <= 0.0f)
+        {
+            return {};
+        }
+
+        const float invLength = 1.0f / length;
+        const Quaternion real =
+        {
+            dualQuaternion.Real.X * invLength,
+            dualQuaternion.Real.Y * invLength,
+            dualQuaternion.Real.Z * invLength,
+            dualQuaternion.Real.W * invLength
+        };
+        const Quaternion dual =
+        {
+            dualQuaternion.Dual.X * invLength,
+            dualQuaternion.Dual.Y * invLength,
+            dualQuaternion.Dual.Z * invLength,
+            dualQuaternion.Dual.W * invLength
+        };
+
+        // A rigid transform's dual part is orthogonal to its real part
+        const float overlap = Quaternion::Dot(real, dual);
+        return { real, { dual.X - real.X * overlap, dual.Y - real.Y * overlap, dual.Z - real.Z * overlap, dual.W - real.W * overlap } };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 DualQuaternion::TransformPoint(const DualQuaternion& dualQuaternion, const Vector3& point)
+    {
+        return Vector3::Add(Quaternion::Multiply(dualQuaternion.Real, point), GetTranslation(dualQuaternion));
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 DualQuaternion::TransformDirection(const DualQuaternion& dualQuaternion, const Vector3& direction)
+    {
+        return Quaternion::Multiply(dualQuaternion.Real, direction);
+    }
+
+    TBX_MATH_INLINE_FN DualQuaternion DualQuaternion::Blend(const DualQuaternion& from, const DualQuaternion& to, float t)
+    {
+        // q and -q are the same rotation, flip to onto from's hemisphere so the blend takes the shortest path
+        const float fromWeight = 1.0f - t;
+        const float toWeight = Quaternion::Dot(from.Real, to.Real) < 0.0f ? -t : t;
+        return Normalize(
+        {
+            {
+                from.Real.X * fromWeight + to.Real.X * toWeight,
+                from.Real.Y * fromWeight + to.Real.Y * toWeight,
+                from.Real.Z * fromWeight + to.Real.Z * toWeight,
+                from.Real.W * fromWeight + to.Real.W * toWeight
+            },
+            {
+                from.Dual.X * fromWeight + to.Dual.X * toWeight,
+                from.Dual.Y * fromWeight + to.Dual.Y * toWeight,
+                from.Dual.Z * fromWeight + to.Dual.Z * toWeight,
+                from.Dual.W * fromWeight + to.Dual.W * toWeight
+            }
+        });
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Vectors.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/AABB.h"
+#include "Tbx/Math/AABBBuffer.h"
+#include "Tbx/Math/Int.h"
+#include <array>
+#include <span>
+#include <string>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A plane described by a unit normal and a distance, a point p is on the positive side when Dot(Normal, p) + Distance >= 0.
+    /// </summary>
+    struct EXPORT Plane
+    {
+    public:
+        Plane() = default;
+        constexpr Plane(const Vector3& normal, float distance)
+            : Normal(normal), Distance(distance) {}
+
+        std::string ToString() const;
+
+        /// <summary>
+        /// Returns the signed distance from the plane to the point, positive on the side the normal points to.
+        /// </summary>
+        static float GetSignedDistance(const Plane& plane, const Vector3& point);
+
+        /// <summary>
+        /// Scales the plane so its normal is unit length.
+        /// </summary>
+        static Plane Normalize(const Plane& plane);
+
+        Vector3 Normal = { 0.0f, 1.0f, 0.0f };
+        float Distance = 0.0f;
+    };
+
+    /// <summary>
+    /// The six planes bounding the volume visible through a camera, with normals pointing into the volume.
+    /// </summary>
+    struct EXPORT Frustum
+    {
+    public:
+        enum PlaneIndex : size_t
+        {
+            Left,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            PlaneCount
+        };
+
+        Frustum() = default;
+
+        /// <summary>
+        /// Extracts the planes from a view-projection matrix (projection * view) using the Gribb-Hartmann method.
+        /// The matrix is expected to map visible points to a -1..1 clip cube, as the projections in Mat4x4 do.
+        /// Projections with a 0..1 depth range still work, their near plane just ends up conservatively behind the camera.
+        /// </summary>
+        explicit Frustum(const Mat4x4& viewProjection);
+
+        std::string ToString() const;
+
+        /// <summary>
+        /// Returns true if the point is inside the frustum.
+        /// </summary>
+        static bool Contains(const Frustum& frustum, const Vector3& point);
+
+        /// <summary>
+        /// Returns true if the sphere is inside or intersects the frustum.
+        /// Like all plane based culling this is conservative, spheres near a frustum corner may be reported visible when they are not.
+        /// </summary>
+        static bool Intersects(const Frustum& frustum, const Vector3& center, float radius);
+
+        /// <summary>
+        /// Returns true if the box is inside or intersects the frustum, with the same conservative behavior as the sphere test.
+        /// Empty boxes are never visible.
+        /// </summary>
+        static bool Intersects(const Frustum& frustum, const AABB& box);
+
+        /// <summary>
+        /// Tests many spheres, given as component arrays, against the frustum several at a time with SIMD.
+        /// Bit i of the mask (mask[i / 64] >> (i % 64)) is set when sphere i is visible.
+        /// All arrays must be the same size and the mask must hold at least (size + 63) / 64 words.
+        /// </summary>
+        static void CullSpheres(
+            const Frustum& frustum,
+            std::span<const float> centerX,
+            std::span<const float> centerY,
+            std::span<const float> centerZ,
+            std::span<const float> radius,
+            std::span<uint64> outVisibleMask);
+
+        /// <summary>
+        /// Tests every box in the buffer against the frustum several at a time with SIMD.
+        /// Bit i of the mask is set when box i is visible, the mask must hold at least boxes.GetMaskWordCount() words.
+        /// Empty boxes are never visible, like in Intersects.
+        /// </summary>
+        static void CullAABBs(const Frustum& frustum, const AABBBuffer& boxes, std::span<uint64> outVisibleMask);
+
+        std::array<Plane, PlaneCount> Planes = {};
+    };
+}
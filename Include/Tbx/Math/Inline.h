@@ -0,0 +1,17 @@
+#pragma once
+
+#ifdef TBX_MATH_INLINE
+    /// <summary>
+    /// Marks a hot math function that can be evaluated at compile time.
+    /// When TBX_MATH_INLINE is defined the function is defined in the headers so it can be inlined and vectorized at the call site.
+    /// </summary>
+    #define TBX_MATH_CONSTEXPR_FN constexpr
+    /// <summary>
+    /// Marks a hot math function that cannot be evaluated at compile time (i.e. it needs a square root).
+    /// When TBX_MATH_INLINE is defined the function is defined in the headers so it can be inlined and vectorized at the call site.
+    /// </summary>
+    #define TBX_MATH_INLINE_FN inline
+#else
+    #define TBX_MATH_CONSTEXPR_FN
+    #define TBX_MATH_INLINE_FN
+#endif
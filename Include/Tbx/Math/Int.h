@@ -4,6 +4,7 @@
 namespace Tbx
 {
 	using uint = unsigned int;
+	using uint16 = uint16_t;
 	using uint32 = uint32_t;
 	using uint64 = unsigned long long;
 	using int64 = long long;
@@ -0,0 +1,146 @@
+#pragma once
+#include "Tbx/Math/Vec.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/Mat4x4Kernels.h"
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A matrix of R rows and C columns of type T, stored in column major order like Mat4x4.
+    /// Columns that fill whole 16 byte registers (i.e. 4 floats or 2 doubles) are aligned to 16 bytes.
+    /// Float 4x4 products run the same SIMD kernel as Mat4x4, every other size and type uses the generic loops.
+    /// Mat4x4 and Mat3x4 stay the dedicated float types for transforms, a float 4x4 Mat converts to and from Mat4x4 explicitly.
+    /// </summary>
+    template <typename T, size_t R, size_t C>
+    struct Mat
+    {
+    public:
+        static_assert(std::is_arithmetic_v<T>, "Mat elements must be arithmetic.");
+
+        /// <summary>
+        /// Creates a new default matrix. The default value has ones on the diagonal, i.e. the identity for square matrices.
+        /// </summary>
+        constexpr Mat() noexcept
+        {
+            for (size_t i = 0; i < std::min(R, C); i++) At(i, i) = 1;
+        }
+
+        /// <summary>
+        /// Creates a new matrix with the given data, the data must be passed in column major order.
+        /// </summary>
+        constexpr explicit Mat(const std::array<T, R * C>& data) noexcept : Values(data) {}
+
+        /// <summary>
+        /// Creates a new matrix from exactly R * C elements in column major order.
+        /// </summary>
+        template <typename... Elements> requires (sizeof...(Elements) == R * C && (std::is_convertible_v<Elements, T> && ...))
+        constexpr Mat(ColumnMajorTag, Elements... elements) noexcept
+            : Values({ static_cast<T>(elements)... }) {}
+
+        /// <summary>
+        /// Creates a new matrix from exactly R * C elements in row major order, one row per line.
+        /// </summary>
+        template <typename... Elements> requires (sizeof...(Elements) == R * C && (std::is_convertible_v<Elements, T> && ...))
+        constexpr Mat(RowMajorTag, Elements... elements) noexcept
+        {
+            const std::array<T, R * C> rows = { static_cast<T>(elements)... };
+            for (size_t row = 0; row < R; row++)
+            {
+                for (size_t column = 0; column < C; column++)
+                {
+                    At(row, column) = rows[row * C + column];
+                }
+            }
+        }
+
+        constexpr explicit Mat(const Mat4x4& matrix) noexcept requires (std::is_same_v<T, float> && R == 4 && C == 4)
+            : Values(matrix.Values) {}
+
+        constexpr explicit operator Mat4x4() const noexcept requires (std::is_same_v<T, float> && R == 4 && C == 4) { return Values; }
+
+        template <size_t K>
+        friend constexpr Mat<T, R, K> operator * (const Mat& lhs, const Mat<T, C, K>& rhs) { return Multiply(lhs, rhs); }
+        friend constexpr Vec<T, R> operator * (const Mat& lhs, const Vec<T, C>& rhs) { return Multiply(lhs, rhs); }
+        friend constexpr bool operator == (const Mat& lhs, const Mat& rhs) = default;
+
+        constexpr T& At(size_t row, size_t column) { return Values[column * R + row]; }
+        constexpr const T& At(size_t row, size_t column) const { return Values[column * R + row]; }
+
+        template <size_t K>
+        static constexpr Mat<T, R, K> Multiply(const Mat& lhs, const Mat<T, C, K>& rhs);
+        static constexpr Vec<T, R> Multiply(const Mat& lhs, const Vec<T, C>& rhs);
+        static constexpr Mat<T, C, R> Transpose(const Mat& matrix);
+
+        alignas((R * sizeof(T)) % 16 == 0 ? 16 : alignof(T)) std::array<T, R * C> Values = {};
+    };
+
+    template <typename T, size_t R, size_t C>
+    template <size_t K>
+    constexpr Mat<T, R, K> Mat<T, R, C>::Multiply(const Mat& lhs, const Mat<T, C, K>& rhs)
+    {
+        Mat<T, R, K> result(std::array<T, R * K>{});
+        if constexpr (std::is_same_v<T, float> && R == 4 && C == 4 && K == 4)
+        {
+            Simd::Mat4x4Multiply(lhs.Values.data(), rhs.Values.data(), result.Values.data());
+        }
+        else
+        {
+            // Each result column is a sum of lhs columns scaled by one rhs column, so the inner loop runs down contiguous columns
+            // and is summed in a local column that the compiler can keep in registers
+            for (size_t column = 0; column < K; column++)
+            {
+                std::array<T, R> sum = {};
+                for (size_t i = 0; i < C; i++)
+                {
+                    const T scale = rhs.At(i, column);
+                    for (size_t row = 0; row < R; row++)
+                    {
+                        sum[row] += lhs.At(row, i) * scale;
+                    }
+                }
+                for (size_t row = 0; row < R; row++)
+                {
+                    result.At(row, column) = sum[row];
+                }
+            }
+        }
+        return result;
+    }
+
+    template <typename T, size_t R, size_t C>
+    constexpr Vec<T, R> Mat<T, R, C>::Multiply(const Mat& lhs, const Vec<T, C>& rhs)
+    {
+        Vec<T, R> result;
+        for (size_t i = 0; i < C; i++)
+        {
+            for (size_t row = 0; row < R; row++)
+            {
+                result[row] += lhs.At(row, i) * rhs[i];
+            }
+        }
+        return result;
+    }
+
+    template <typename T, size_t R, size_t C>
+    constexpr Mat<T, C, R> Mat<T, R, C>::Transpose(const Mat& matrix)
+    {
+        Mat<T, C, R> result(std::array<T, R * C>{});
+        for (size_t row = 0; row < R; row++)
+        {
+            for (size_t column = 0; column < C; column++)
+            {
+                result.At(column, row) = matrix.At(row, column);
+            }
+        }
+        return result;
+    }
+
+    using Mat2x2 = Mat<float, 2, 2>;
+    using Mat3x3 = Mat<float, 3, 3>;
+    using Mat2x2D = Mat<double, 2, 2>;
+    using Mat3x3D = Mat<double, 3, 3>;
+    using Mat4x4D = Mat<double, 4, 4>;
+}
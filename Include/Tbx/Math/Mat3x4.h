@@ -0,0 +1,108 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Inline.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/Quaternion.h"
+#include "Tbx/Math/Vectors.h"
+#include <array>
+#include <string>
+
+namespace Tbx
+{
+    /// <summary>
+    /// An affine 3x4 matrix, a Mat4x4 whose bottom row is always (0, 0, 0, 1) and so isn't stored.
+    /// Used for world and bone matrices, it takes 48 bytes instead of 64 and its multiply and inverse skip the work the bottom row would need.
+    /// This matrix stores data in column major order like Mat4x4, the last column is the translation.
+    /// </summary>
+    struct EXPORT Mat3x4
+    {
+    public:
+        /// <summary>
+        /// Creates a new default 3x4 matrix. The default value is the identity matrix.
+        /// </summary>
+        constexpr Mat3x4();
+
+        /// <summary>
+        /// Creates a new matrix with the given data, the data must be passed in column major order.
+        /// </summary>
+        constexpr explicit(false) Mat3x4(const std::array<float, 12>& data) : Values(data) {}
+
+        friend TBX_MATH_CONSTEXPR_FN Mat3x4 operator * (const Mat3x4& lhs, const Mat3x4& rhs) { return Multiply(lhs, rhs); }
+        friend constexpr bool operator == (const Mat3x4& lhs, const Mat3x4& rhs) { return lhs.Values == rhs.Values; }
+
+        constexpr float& operator[](int index) { return Values[index]; }
+        constexpr const float& operator[](int index) const { return Values[index]; }
+
+        std::string ToString() const;
+
+        /// <summary>
+        /// Same as Mat4x4::FromTRS without the bottom row. Can be evaluated at compile time.
+        /// </summary>
+        static constexpr Mat3x4 FromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+        /// <summary>
+        /// Drops the bottom row of an affine matrix. Lossless when the bottom row is (0, 0, 0, 1), i.e. not a projection.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Mat3x4 FromMat4x4(const Mat4x4& matrix);
+        /// <summary>
+        /// Expands the matrix to a Mat4x4 with a bottom row of (0, 0, 0, 1).
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 ToMat4x4(const Mat3x4& matrix);
+
+        /// <summary>
+        /// Multiplies two affine matrices, the result applies rhs first and then lhs like Mat4x4::Multiply.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Mat3x4 Multiply(const Mat3x4& lhs, const Mat3x4& rhs);
+        /// <summary>
+        /// Inverts an affine matrix by inverting its 3x3 part and transforming the negated translation by it.
+        /// Works with any scale, the matrix must not be singular.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Mat3x4 Inverse(const Mat3x4& matrix);
+        /// <summary>
+        /// Inverts a rotation and translation only matrix by transposing the rotation, cheaper than Inverse.
+        /// The result is wrong if the matrix has any scale.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Mat3x4 InverseOrthonormal(const Mat3x4& matrix);
+
+        /// <summary>
+        /// Transforms a point, applying the translation.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformPoint(const Mat3x4& matrix, const Vector3& point);
+        /// <summary>
+        /// Transforms a direction or offset, ignoring the translation.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformVector(const Mat3x4& matrix, const Vector3& vector);
+
+        /// <summary>
+        /// The matrix values, stored in a flat array in column major order.
+        /// Aligned to 16 bytes like Mat4x4, which keeps the struct at 48 bytes.
+        /// </summary>
+        alignas(16) std::array<float, 12> Values = {};
+    };
+
+    constexpr Mat3x4::Mat3x4()
+        : Values({
+            1.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 1.0f,
+            0.0f, 0.0f, 0.0f })
+    {
+    }
+
+    constexpr Mat3x4 Mat3x4::FromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+    {
+        // Built from Mat4x4::FromTRS, the unused bottom row folds away
+        const Mat4x4 matrix = Mat4x4::FromTRS(position, rotation, scale);
+        return std::array<float, 12>
+        {
+            matrix[0], matrix[1], matrix[2],
+            matrix[4], matrix[5], matrix[6],
+            matrix[8], matrix[9], matrix[10],
+            matrix[12], matrix[13], matrix[14]
+        };
+    }
+}
+
+#ifdef TBX_MATH_INLINE
+    #include "Tbx/Math/Mat3x4.inl"
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+#include "Tbx/Math/Mat3x4.h"
+#include "Tbx/Math/Mat3x4Kernels.h"
+
+// Hot Mat3x4 arithmetic.
+// Included by Mat3x4.h when TBX_MATH_INLINE is defined, otherwise compiled into the library by Mat3x4.cpp.
+
+namespace Tbx
+{
+    TBX_MATH_CONSTEXPR_FN Mat3x4 Mat3x4::FromMat4x4(const Mat4x4& matrix)
+    {
+        Mat3x4 result;
+        for (int col = 0; col < 4; col++)
+        {
+            for (int row = 0; row < 3; row++)
+            {
+                result[col * 3 + row] = matrix[col * 4 + row];
+            }
+        }
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat3x4::ToMat4x4(const Mat3x4& matrix)
+    {
+        return std::array<float, 16>
+        {
+            matrix[0], matrix[1], matrix[2], 0.0f,
+            matrix[3], matrix[4], matrix[5], 0.0f,
+            matrix[6], matrix[7], matrix[8], 0.0f,
+            matrix[9], matrix[10], matrix[11], 1.0f
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat3x4 Mat3x4::Multiply(const Mat3x4& lhs, const Mat3x4& rhs)
+    {
+        Mat3x4 result;
+        Simd::Mat3x4Multiply(lhs.Values.data(), rhs.Values.data(), result.Values.data());
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat3x4 Mat3x4::Inverse(const Mat3x4& matrix)
+    {
+        Mat3x4 result;
+        Simd::Mat3x4Inverse(matrix.Values.data(), result.Values.data());
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat3x4 Mat3x4::InverseOrthonormal(const Mat3x4& matrix)
+    {
+        // The inverse of a rotation is its transpose, so row i of the inverse is column i of the matrix
+        const Vector3 row0 = { matrix[0], matrix[1], matrix[2] };
+        const Vector3 row1 = { matrix[3], matrix[4], matrix[5] };
+        const Vector3 row2 = { matrix[6], matrix[7], matrix[8] };
+        const Vector3 translation = { matrix[9], matrix[10], matrix[11] };
+        return std::array<float, 12>
+        {
+            row0.X, row1.X, row2.X,
+            row0.Y, row1.Y, row2.Y,
+            row0.Z, row1.Z, row2.Z,
+            -Vector3::Dot(row0, translation), -Vector3::Dot(row1, translation), -Vector3::Dot(row2, translation)
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Mat3x4::TransformPoint(const Mat3x4& matrix, const Vector3& point)
+    {
+        return
+        {
+            matrix[0] * point.X + matrix[3] * point.Y + matrix[6] * point.Z + matrix[9],
+            matrix[1] * point.X + matrix[4] * point.Y + matrix[7] * point.Z + matrix[10],
+            matrix[2] * point.X + matrix[5] * point.Y + matrix[8] * point.Z + matrix[11]
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Mat3x4::TransformVector(const Mat3x4& matrix, const Vector3& vector)
+    {
+        return
+        {
+            matrix[0] * vector.X + matrix[3] * vector.Y + matrix[6] * vector.Z,
+            matrix[1] * vector.X + matrix[4] * vector.Y + matrix[7] * vector.Z,
+            matrix[2] * vector.X + matrix[5] * vector.Y + matrix[8] * vector.Z
+        };
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "Tbx/Math/Mat4x4Kernels.h"
+
+// Column major 3x4 affine matrix kernels working directly on Mat3x4::Values storage.
+// All pointers must point to 12 floats, and the result must not alias an input.
+// Each kernel falls back to scalar code when evaluated at compile time or when no SIMD instruction set is available.
+
+namespace Tbx::Simd
+{
+#ifdef TBX_MATH_SSE2
+    // Loads the four 3 float columns from three 16 byte loads, the last lane of each register is unused
+    inline void Mat3x4LoadColumns(const float* matrix, __m128& col0, __m128& col1, __m128& col2, __m128& col3)
+    {
+        const __m128 block0 = _mm_loadu_ps(matrix);
+        const __m128 block1 = _mm_loadu_ps(matrix + 4);
+        const __m128 block2 = _mm_loadu_ps(matrix + 8);
+        col0 = block0;
+        col1 = Shuffle<0, 2, 1, 1>(Shuffle<3, 3, 0, 0>(block0, block1), block1);
+        col2 = Shuffle<2, 3, 0, 0>(block1, block2);
+        col3 = Swizzle<1, 2, 3, 3>(block2);
+    }
+
+    // Packs the four 3 float columns into three 16 byte stores, overlapping stores would stall a following 16 byte load of the result
+    inline void Mat3x4StoreColumns(float* result, __m128 col0, __m128 col1, __m128 col2, __m128 col3)
+    {
+        _mm_storeu_ps(result, Shuffle<0, 1, 0, 2>(col0, Shuffle<2, 2, 0, 0>(col0, col1)));
+        _mm_storeu_ps(result + 4, Shuffle<1, 2, 0, 1>(col1, col2));
+        _mm_storeu_ps(result + 8, Shuffle<0, 2, 1, 2>(Shuffle<2, 2, 0, 0>(col2, col3), col3));
+    }
+
+    inline __m128 Cross(__m128 lhs, __m128 rhs)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(Swizzle<1, 2, 0, 3>(lhs), Swizzle<2, 0, 1, 3>(rhs)),
+            _mm_mul_ps(Swizzle<2, 0, 1, 3>(lhs), Swizzle<1, 2, 0, 3>(rhs)));
+    }
+#endif
+
+    /// <summary>
+    /// Multiplies two column major affine 3x4 matrices, result = lhs * rhs with an implied bottom row of (0, 0, 0, 1).
+    /// </summary>
+    constexpr void Mat3x4Multiply(const float* lhs, const float* rhs, float* result)
+    {
+#ifdef TBX_MATH_SSE2
+        if (!std::is_constant_evaluated())
+        {
+            __m128 lhs0, lhs1, lhs2, lhs3;
+            __m128 rhs0, rhs1, rhs2, rhs3;
+            Mat3x4LoadColumns(lhs, lhs0, lhs1, lhs2, lhs3);
+            Mat3x4LoadColumns(rhs, rhs0, rhs1, rhs2, rhs3);
+
+            const auto transform = [&](__m128 col)
+            {
+                __m128 sum = _mm_mul_ps(lhs0, Swizzle<0, 0, 0, 0>(col));
+                sum = _mm_add_ps(sum, _mm_mul_ps(lhs1, Swizzle<1, 1, 1, 1>(col)));
+                return _mm_add_ps(sum, _mm_mul_ps(lhs2, Swizzle<2, 2, 2, 2>(col)));
+            };
+            Mat3x4StoreColumns(result, transform(rhs0), transform(rhs1), transform(rhs2), _mm_add_ps(transform(rhs3), lhs3));
+            return;
+        }
+#endif
+        // The bottom rows are (0, 0, 0, 1), so each column only needs the 3x3 part of lhs and only the translation adds lhs's translation
+        for (int col = 0; col < 4; col++)
+        {
+            for (int row = 0; row < 3; row++)
+            {
+                result[col * 3 + row] =
+                    lhs[row] * rhs[col * 3] +
+                    lhs[3 + row] * rhs[col * 3 + 1] +
+                    lhs[6 + row] * rhs[col * 3 + 2] +
+                    (col == 3 ? lhs[9 + row] : 0.0f);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Inverts a column major affine 3x4 matrix. The 3x3 part must be invertible.
+    /// </summary>
+    constexpr void Mat3x4Inverse(const float* matrix, float* result)
+    {
+#ifdef TBX_MATH_SSE2
+        if (!std::is_constant_evaluated())
+        {
+            __m128 x, y, z, translation;
+            Mat3x4LoadColumns(matrix, x, y, z, translation);
+
+            // The rows of the inverse of the 3x3 part are the cross products of its columns divided by the determinant
+            __m128 row0 = Cross(y, z);
+            __m128 row1 = Cross(z, x);
+            __m128 row2 = Cross(x, y);
+            const __m128 products = _mm_mul_ps(x, row0);
+            const __m128 det = _mm_add_ps(_mm_add_ps(Swizzle<0, 0, 0, 0>(products), Swizzle<1, 1, 1, 1>(products)), Swizzle<2, 2, 2, 2>(products));
+            const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+            row0 = _mm_mul_ps(row0, invDet);
+            row1 = _mm_mul_ps(row1, invDet);
+            row2 = _mm_mul_ps(row2, invDet);
+            __m128 unused = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(row0, row1, row2, unused);
+
+            // After the transpose the rows hold the columns of the inverse
+            __m128 inverseTranslation = _mm_mul_ps(row0, Swizzle<0, 0, 0, 0>(translation));
+            inverseTranslation = _mm_add_ps(inverseTranslation, _mm_mul_ps(row1, Swizzle<1, 1, 1, 1>(translation)));
+            inverseTranslation = _mm_add_ps(inverseTranslation, _mm_mul_ps(row2, Swizzle<2, 2, 2, 2>(translation)));
+            Mat3x4StoreColumns(result, row0, row1, row2, _mm_sub_ps(_mm_setzero_ps(), inverseTranslation));
+            return;
+        }
+#endif
+        const float* m = matrix;
+        const float yz[3] = { m[4] * m[8] - m[5] * m[7], m[5] * m[6] - m[3] * m[8], m[3] * m[7] - m[4] * m[6] };
+        const float zx[3] = { m[7] * m[2] - m[8] * m[1], m[8] * m[0] - m[6] * m[2], m[6] * m[1] - m[7] * m[0] };
+        const float xy[3] = { m[1] * m[5] - m[2] * m[4], m[2] * m[3] - m[0] * m[5], m[0] * m[4] - m[1] * m[3] };
+        const float invDet = 1.0f / (m[0] * yz[0] + m[1] * yz[1] + m[2] * yz[2]);
+
+        for (int col = 0; col < 3; col++)
+        {
+            result[col * 3] = yz[col] * invDet;
+            result[col * 3 + 1] = zx[col] * invDet;
+            result[col * 3 + 2] = xy[col] * invDet;
+        }
+        for (int row = 0; row < 3; row++)
+        {
+            result[9 + row] = -(result[row] * m[9] + result[3 + row] * m[10] + result[6 + row] * m[11]);
+        }
+    }
+}
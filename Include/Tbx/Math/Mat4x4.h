@@ -1,12 +1,28 @@
 #pragma once
 #include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Inline.h"
 #include "Tbx/Math/Quaternion.h"
 #include "Tbx/Math/Bounds.h"
+#include "Tbx/Math/Trig.h"
 #include <array>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 
 namespace Tbx
 {
+    class ThreadPool;
+
+    /// <summary>
+    /// Selects the element order of the tagged Mat4x4 constructors.
+    /// RowMajor takes the matrix as it is written on paper, ColumnMajor takes it in the order Mat4x4::Values stores it.
+    /// </summary>
+    struct RowMajorTag { explicit RowMajorTag() = default; };
+    struct ColumnMajorTag { explicit ColumnMajorTag() = default; };
+    inline constexpr RowMajorTag RowMajor{};
+    inline constexpr ColumnMajorTag ColumnMajor{};
+
     /// <summary>
     /// A 4x4 matrix to store data. Most often used for rendering.
     /// This matrix stores data in column major order.
@@ -17,72 +33,326 @@ namespace Tbx
         /// <summary>
         /// Creates a new default 4x4 matrix. The default value is the identity matrix.
         /// </summary>
-        Mat4x4();
+        constexpr Mat4x4() noexcept;
 
         /// <summary>
         /// Creates a new matrix with the given data, the data must be passed in column major order.
         /// </summary>
-        explicit(false) Mat4x4(const std::array<float, 16>& data) : Values(data) {}
+        constexpr explicit(false) Mat4x4(const std::array<float, 16>& data) noexcept : Values(data) {}
+
+        /// <summary>
+        /// Creates a new matrix from exactly 16 elements in column major order, i.e. Mat4x4(ColumnMajor, 1, 0, 0, 0, ...).
+        /// The element count is checked at compile time and the elements are written straight into Values.
+        /// </summary>
+        template <typename... Elements> requires (sizeof...(Elements) == 16 && (std::is_convertible_v<Elements, float> && ...))
+        constexpr Mat4x4(ColumnMajorTag, Elements... elements) noexcept
+            : Values({ static_cast<float>(elements)... }) {}
+
+        /// <summary>
+        /// Creates a new matrix from exactly 16 elements in row major order, i.e. Mat4x4(RowMajor, ...) with one row per line.
+        /// The element count is checked at compile time, the transpose folds away when the elements are constants.
+        /// </summary>
+        template <typename... Elements> requires (sizeof...(Elements) == 16 && (std::is_convertible_v<Elements, float> && ...))
+        constexpr Mat4x4(RowMajorTag, Elements... elements) noexcept
+        {
+            const std::array<float, 16> rows = { static_cast<float>(elements)... };
+            for (int row = 0; row < 4; row++)
+            {
+                for (int col = 0; col < 4; col++)
+                {
+                    Values[col * 4 + row] = rows[row * 4 + col];
+                }
+            }
+        }
 
         /// <summary>
         /// Creates a new matrix with the given data, the data must be passed in column major order.
         /// </summary>
-        explicit(false) Mat4x4(const std::initializer_list<float>& data);
+        constexpr explicit(false) Mat4x4(const std::initializer_list<float>& data);
 
         /// <summary>
         /// Creates a new matrix with the given data represent an upright 4x4 matrix.
+        /// The row and column counts are only known at run time, so they are checked with exceptions. Prefer Mat4x4(RowMajor, ...).
         /// </summary>
-        explicit(false) Mat4x4(const std::initializer_list<std::initializer_list<float>>& data);
+        constexpr explicit(false) Mat4x4(const std::initializer_list<std::initializer_list<float>>& data);
 
         /// <summary>
         /// Creates a new matrix with the given data represent an upright 4x4 matrix.
         /// </summary>
-        explicit(false) Mat4x4(const std::array<std::array<float, 4>, 4>& data);
+        constexpr explicit(false) Mat4x4(const std::array<std::array<float, 4>, 4>& data) noexcept;
 
-        friend Mat4x4 operator * (float lhs, const Mat4x4& rhs) { return Multiply(lhs, rhs); }
-        friend Mat4x4 operator * (const Mat4x4& lhs, float rhs) { return Multiply(lhs, rhs); }
-        friend Mat4x4 operator * (const Mat4x4& lhs, const Mat4x4& rhs) { return Multiply(lhs, rhs); }
-        friend Mat4x4 operator + (const Mat4x4& lhs, const Mat4x4& rhs) { return Add(lhs, rhs); }
-        friend Mat4x4 operator - (const Mat4x4& lhs, const Mat4x4& rhs) { return Subtract(lhs, rhs); }
-        friend bool operator == (const Mat4x4& lhs, const Mat4x4& rhs) { return lhs.Values == rhs.Values; }
+        friend TBX_MATH_CONSTEXPR_FN Mat4x4 operator * (float lhs, const Mat4x4& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Mat4x4 operator * (const Mat4x4& lhs, float rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Mat4x4 operator * (const Mat4x4& lhs, const Mat4x4& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Mat4x4 operator + (const Mat4x4& lhs, const Mat4x4& rhs) { return Add(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Mat4x4 operator - (const Mat4x4& lhs, const Mat4x4& rhs) { return Subtract(lhs, rhs); }
+        friend constexpr bool operator == (const Mat4x4& lhs, const Mat4x4& rhs) { return lhs.Values == rhs.Values; }
 
-        float& operator[](int index) { return Values[index]; }
-        const float& operator[](int index) const { return Values[index]; }
+        constexpr float& operator[](int index) { return Values[index]; }
+        constexpr const float& operator[](int index) const { return Values[index]; }
 
-        float& operator()(int row, int col) { return Values[row * 4 + col]; }
-        const float& operator()(int row, int col) const { return Values[row * 4 + col];}
+        constexpr float& operator()(int row, int col) { return Values[row * 4 + col]; }
+        constexpr const float& operator()(int row, int col) const { return Values[row * 4 + col];}
 
         explicit(false) operator std::array<float, 16>() const { return Values; }
 
         std::string ToString() const;
 
-        static Mat4x4 FromPosition(const Vector3& position);
-        static Mat4x4 FromRotation(const Quaternion& rotation);
-        static Mat4x4 FromScale(const Vector3& scale);
-        static Mat4x4 FromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+        /// <summary>
+        /// The builders below can be evaluated at compile time, i.e. to bake fixed camera matrices into constexpr tables.
+        /// </summary>
+        static constexpr Mat4x4 FromPosition(const Vector3& position);
+        static constexpr Mat4x4 FromRotation(const Quaternion& rotation);
+        static constexpr Mat4x4 FromScale(const Vector3& scale);
+        static constexpr Mat4x4 FromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+        static constexpr Mat4x4 LookAt(const Vector3& from, const Vector3& target, const Vector3& up);
+        static constexpr Mat4x4 OrthographicProjection(const Bounds& bounds, float zNear, float zFar);
+        static constexpr Mat4x4 PerspectiveProjection(float fov, float aspect, float zNear, float zFar);
 
-        static Mat4x4 LookAt(const Vector3& from, const Vector3& target, const Vector3& up);
-        static Mat4x4 OrthographicProjection(const Bounds& bounds, float zNear, float zFar);
-        static Mat4x4 PerspectiveProjection(float fov, float aspect, float zNear, float zFar);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Inverse(const Mat4x4& matrix);
 
-        static Mat4x4 Inverse(const Mat4x4& matrix);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Transpose(const Mat4x4& matrix);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Translate(const Mat4x4& matrix, const Vector3& translate);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Rotate(const Mat4x4& matrix, float angle, const Vector3& axis);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Scale(const Mat4x4& matrix, const Vector3& scale);
 
-        static Mat4x4 Transpose(const Mat4x4& matrix);
-        static Mat4x4 Translate(const Mat4x4& matrix, const Vector3& translate);
-        static Mat4x4 Rotate(const Mat4x4& matrix, float angle, const Vector3& axis);
-        static Mat4x4 Scale(const Mat4x4& matrix, const Vector3& scale);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Add(const Mat4x4& lhs, const Mat4x4& rhs);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Subtract(const Mat4x4& lhs, const Mat4x4& rhs);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Multiply(const Mat4x4& lhs, const Mat4x4& rhs);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Multiply(float lhs, const Mat4x4& rhs);
+        static TBX_MATH_CONSTEXPR_FN Mat4x4 Multiply(const Mat4x4& lhs, float rhs);
 
-        static Mat4x4 Add(const Mat4x4& lhs, const Mat4x4& rhs);
-        static Mat4x4 Subtract(const Mat4x4& lhs, const Mat4x4& rhs);
-        static Mat4x4 Multiply(const Mat4x4& lhs, const Mat4x4& rhs);
-        static Mat4x4 Multiply(float lhs, const Mat4x4& rhs);
-        static Mat4x4 Multiply(const Mat4x4& lhs, float rhs);
+        /// <summary>
+        /// Multiplies each matrix in lhs by rhs, out[i] = lhs[i] * rhs.
+        /// Out must be at least as large as lhs and must not overlap the inputs.
+        /// </summary>
+        static void MultiplyBatch(std::span<const Mat4x4> lhs, const Mat4x4& rhs, std::span<Mat4x4> out);
+        /// <summary>
+        /// Multiplies lhs by each matrix in rhs, out[i] = lhs * rhs[i]. I.e. view projection * model matrices.
+        /// Out must be at least as large as rhs and must not overlap the inputs.
+        /// </summary>
+        static void MultiplyBatch(const Mat4x4& lhs, std::span<const Mat4x4> rhs, std::span<Mat4x4> out);
+        /// <summary>
+        /// Multiplies the matrices pairwise, out[i] = lhs[i] * rhs[i].
+        /// Lhs and rhs must be the same size, out must be at least as large and must not overlap the inputs.
+        /// </summary>
+        static void MultiplyBatch(std::span<const Mat4x4> lhs, std::span<const Mat4x4> rhs, std::span<Mat4x4> out);
+
+        /// <summary>
+        /// Transforms a point by the matrix, including its translation. The bottom row is assumed to be (0, 0, 0, 1).
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformPoint(const Mat4x4& matrix, const Vector3& point);
+        /// <summary>
+        /// Transforms a direction by the upper 3x3 of the matrix, ignoring its translation.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformDirection(const Mat4x4& matrix, const Vector3& direction);
+        /// <summary>
+        /// Transforms a point by the full matrix and divides by the resulting w, i.e. to go from view space to normalized device coordinates.
+        /// </summary>
+        static TBX_MATH_CONSTEXPR_FN Vector3 TransformPointProjective(const Mat4x4& matrix, const Vector3& point);
+
+        /// <summary>
+        /// Transforms every point like TransformPoint, several points per SIMD iteration.
+        /// Out may be the same span as points. Throws std::out_of_range if out is smaller than points.
+        /// </summary>
+        static void TransformPoints(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out);
+        /// <summary>
+        /// Transforms every point like TransformPoints, spreading chunks of points across the pools threads.
+        /// </summary>
+        static void TransformPoints(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out, ThreadPool& pool);
+        /// <summary>
+        /// Transforms every direction like TransformDirection, several directions per SIMD iteration.
+        /// Out may be the same span as directions. Throws std::out_of_range if out is smaller than directions.
+        /// </summary>
+        static void TransformDirections(const Mat4x4& matrix, std::span<const Vector3> directions, std::span<Vector3> out);
+        /// <summary>
+        /// Transforms every direction like TransformDirections, spreading chunks of directions across the pools threads.
+        /// </summary>
+        static void TransformDirections(const Mat4x4& matrix, std::span<const Vector3> directions, std::span<Vector3> out, ThreadPool& pool);
+        /// <summary>
+        /// Transforms every point like TransformPointProjective, several points per SIMD iteration.
+        /// Out may be the same span as points. Throws std::out_of_range if out is smaller than points.
+        /// </summary>
+        static void TransformPointsProjective(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out);
+        /// <summary>
+        /// Transforms every point like TransformPointsProjective, spreading chunks of points across the pools threads.
+        /// </summary>
+        static void TransformPointsProjective(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out, ThreadPool& pool);
 
         static bool IsEqual(const Mat4x4& lhs, float rhs);
 
         /// <summary>
         /// The matrix values, stored in a flat array in row major order.
+        /// Aligned to 16 bytes so the SIMD kernels can use aligned loads and stores.
         /// </summary>
-        std::array<float, 16> Values = {};
+        alignas(16) std::array<float, 16> Values = {};
     };
+
+    constexpr Mat4x4::Mat4x4() noexcept
+        : Values({
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f })
+    {
+    }
+
+    constexpr Mat4x4::Mat4x4(const std::initializer_list<float>& data)
+    {
+        int index = 0;
+        for (float value : data)
+        {
+            Values[index++] = value;
+        }
+    }
+
+    constexpr Mat4x4::Mat4x4(const std::initializer_list<std::initializer_list<float>>& data)
+    {
+        // Copy init list to dest val
+        size_t row = 0;
+        std::array<std::array<float, 4>, 4> vals = {};
+        for (const auto& rowList : data)
+        {
+            size_t col = 0;
+            for (float val : rowList)
+            {
+                if (row < 4 && col < 4)
+                {
+                    vals[row][col] = val;
+                    col++;
+                }
+                else throw std::out_of_range("Initializer list has more elements than the destination array.");
+            }
+
+            if (col != 4 && row < 4)  throw std::out_of_range("Initializer list row has fewer elements than the destination array row.");
+            row++;
+        }
+        if (row != 4)  throw std::out_of_range("Initializer list has fewer rows than the destination array.");
+
+        // Copy result to values
+        Values =
+        {
+            vals[0][0], vals[1][0], vals[2][0], vals[3][0],
+            vals[0][1], vals[1][1], vals[2][1], vals[3][1],
+            vals[0][2], vals[1][2], vals[2][2], vals[3][2],
+            vals[0][3], vals[1][3], vals[2][3], vals[3][3]
+        };
+    }
+
+    constexpr Mat4x4::Mat4x4(const std::array<std::array<float, 4>, 4>& data) noexcept
+        : Values({
+            data[0][0], data[1][0], data[2][0], data[3][0],
+            data[0][1], data[1][1], data[2][1], data[3][1],
+            data[0][2], data[1][2], data[2][2], data[3][2],
+            data[0][3], data[1][3], data[2][3], data[3][3] })
+    {
+    }
+
+    constexpr Mat4x4 Mat4x4::FromPosition(const Vector3& position)
+    {
+        return std::array<float, 16>
+        {
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            position.X, position.Y, position.Z, 1.0f
+        };
+    }
+
+    constexpr Mat4x4 Mat4x4::FromRotation(const Quaternion& rotation)
+    {
+        return FromTRS(Vector3(0.0f), rotation, Vector3(1.0f));
+    }
+
+    constexpr Mat4x4 Mat4x4::FromScale(const Vector3& scale)
+    {
+        return std::array<float, 16>
+        {
+            scale.X, 0.0f, 0.0f, 0.0f,
+            0.0f, scale.Y, 0.0f, 0.0f,
+            0.0f, 0.0f, scale.Z, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+    }
+
+    constexpr Mat4x4 Mat4x4::FromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+    {
+        // Scales the columns of the rotation matrix and writes the translation, equivalent to T * R * S
+        const float xx = rotation.X * rotation.X;
+        const float yy = rotation.Y * rotation.Y;
+        const float zz = rotation.Z * rotation.Z;
+        const float xy = rotation.X * rotation.Y;
+        const float xz = rotation.X * rotation.Z;
+        const float yz = rotation.Y * rotation.Z;
+        const float wx = rotation.W * rotation.X;
+        const float wy = rotation.W * rotation.Y;
+        const float wz = rotation.W * rotation.Z;
+
+        return std::array<float, 16>
+        {
+            (1.0f - 2.0f * (yy + zz)) * scale.X, 2.0f * (xy + wz) * scale.X, 2.0f * (xz - wy) * scale.X, 0.0f,
+            2.0f * (xy - wz) * scale.Y, (1.0f - 2.0f * (xx + zz)) * scale.Y, 2.0f * (yz + wx) * scale.Y, 0.0f,
+            2.0f * (xz + wy) * scale.Z, 2.0f * (yz - wx) * scale.Z, (1.0f - 2.0f * (xx + yy)) * scale.Z, 0.0f,
+            position.X, position.Y, position.Z, 1.0f
+        };
+    }
+
+    constexpr Mat4x4 Mat4x4::LookAt(const Vector3& from, const Vector3& target, const Vector3& up)
+    {
+        // Same as glm::lookAtLH
+        constexpr auto normalize = [](const Vector3& v)
+        {
+            const float invLength = 1.0f / Math::ConstexprSqrt(v.X * v.X + v.Y * v.Y + v.Z * v.Z);
+            return Vector3(v.X * invLength, v.Y * invLength, v.Z * invLength);
+        };
+        constexpr auto cross = [](const Vector3& lhs, const Vector3& rhs)
+        {
+            return Vector3(lhs.Y * rhs.Z - rhs.Y * lhs.Z, lhs.Z * rhs.X - rhs.Z * lhs.X, lhs.X * rhs.Y - rhs.X * lhs.Y);
+        };
+        constexpr auto dot = [](const Vector3& lhs, const Vector3& rhs) { return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z; };
+
+        const Vector3 forward = normalize(Vector3(target.X - from.X, target.Y - from.Y, target.Z - from.Z));
+        const Vector3 right = normalize(cross(up, forward));
+        const Vector3 localUp = cross(forward, right);
+        return std::array<float, 16>
+        {
+            right.X, localUp.X, forward.X, 0.0f,
+            right.Y, localUp.Y, forward.Y, 0.0f,
+            right.Z, localUp.Z, forward.Z, 0.0f,
+            -dot(right, from), -dot(localUp, from), -dot(forward, from), 1.0f
+        };
+    }
+
+    constexpr Mat4x4 Mat4x4::OrthographicProjection(const Bounds& bounds, float zNear, float zFar)
+    {
+        // Same as glm::orthoLH_NO with the near plane moved to 0, which maps [0, zFar - zNear] to [-1, 1]
+        const float width = bounds.Right - bounds.Left;
+        const float height = bounds.Top - bounds.Bottom;
+        const float depth = zFar - zNear;
+        return std::array<float, 16>
+        {
+            2.0f / width, 0.0f, 0.0f, 0.0f,
+            0.0f, 2.0f / height, 0.0f, 0.0f,
+            0.0f, 0.0f, 2.0f / depth, 0.0f,
+            -(bounds.Right + bounds.Left) / width, -(bounds.Top + bounds.Bottom) / height, -depth / depth, 1.0f
+        };
+    }
+
+    constexpr Mat4x4 Mat4x4::PerspectiveProjection(float fov, float aspect, float zNear, float zFar)
+    {
+        // Same as glm::perspectiveLH_NO
+        const float tanHalfFov = Math::ConstexprTan(fov / 2.0f);
+        return std::array<float, 16>
+        {
+            1.0f / (aspect * tanHalfFov), 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f / tanHalfFov, 0.0f, 0.0f,
+            0.0f, 0.0f, (zFar + zNear) / (zFar - zNear), 1.0f,
+            0.0f, 0.0f, -(2.0f * zFar * zNear) / (zFar - zNear), 0.0f
+        };
+    }
 }
+
+#ifdef TBX_MATH_INLINE
+    #include "Tbx/Math/Mat4x4.inl"
+#endif
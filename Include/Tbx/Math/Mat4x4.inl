@@ -0,0 +1,127 @@
+#pragma once
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/Mat4x4Kernels.h"
+
+// Hot Mat4x4 arithmetic.
+// Included by Mat4x4.h when TBX_MATH_INLINE is defined, otherwise compiled into the library by Mat4x4.cpp.
+
+namespace Tbx
+{
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Inverse(const Mat4x4& matrix)
+    {
+        Mat4x4 result;
+        Simd::Mat4x4Inverse(matrix.Values.data(), result.Values.data());
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Transpose(const Mat4x4& matrix)
+    {
+        Mat4x4 result;
+        Simd::Mat4x4Transpose(matrix.Values.data(), result.Values.data());
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Translate(const Mat4x4& matrix, const Vector3& translate)
+    {
+        auto result = matrix;
+        for (int row = 0; row < 4; row++)
+        {
+            result[12 + row] =
+                matrix[row] * translate.X +
+                matrix[4 + row] * translate.Y +
+                matrix[8 + row] * translate.Z +
+                matrix[12 + row];
+        }
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Rotate(const Mat4x4& matrix, float angle, const Vector3& axis)
+    {
+        // Same as glm::rotate, the rotation is applied before the existing transform
+        return Multiply(matrix, FromRotation(Quaternion::FromAxisAngle(axis, angle)));
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Scale(const Mat4x4& matrix, const Vector3& scale)
+    {
+        auto result = matrix;
+
+        result[0]  *= scale.X; // scale along the x-axis
+        result[5]  *= scale.Y; // scale along the y-axis
+        result[10] *= scale.Z; // scale along the z-axis
+
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Add(const Mat4x4& lhs, const Mat4x4& rhs)
+    {
+        std::array<float, 16> result = {};
+        for (int i = 0; i < 16; i++)
+        {
+            result[i] = lhs.Values[i] + rhs.Values[i];
+        }
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Subtract(const Mat4x4& lhs, const Mat4x4& rhs)
+    {
+        std::array<float, 16> result = {};
+        for (int i = 0; i < 16; i++)
+        {
+            result[i] = lhs.Values[i] - rhs.Values[i];
+        }
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Multiply(const Mat4x4& lhs, const Mat4x4& rhs)
+    {
+        Mat4x4 result;
+        Simd::Mat4x4Multiply(lhs.Values.data(), rhs.Values.data(), result.Values.data());
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Multiply(float lhs, const Mat4x4& rhs)
+    {
+        std::array<float, 16> result = {};
+        for (int i = 0; i < 16; i++)
+        {
+            result[i] = lhs * rhs.Values[i];
+        }
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Mat4x4 Mat4x4::Multiply(const Mat4x4& lhs, float rhs)
+    {
+        std::array<float, 16> result = {};
+        for (int i = 0; i < 16; i++)
+        {
+            result[i] = lhs.Values[i] * rhs;
+        }
+        return result;
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Mat4x4::TransformPoint(const Mat4x4& matrix, const Vector3& point)
+    {
+        return
+        {
+            matrix[0] * point.X + matrix[4] * point.Y + matrix[8] * point.Z + matrix[12],
+            matrix[1] * point.X + matrix[5] * point.Y + matrix[9] * point.Z + matrix[13],
+            matrix[2] * point.X + matrix[6] * point.Y + matrix[10] * point.Z + matrix[14]
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Mat4x4::TransformDirection(const Mat4x4& matrix, const Vector3& direction)
+    {
+        return
+        {
+            matrix[0] * direction.X + matrix[4] * direction.Y + matrix[8] * direction.Z,
+            matrix[1] * direction.X + matrix[5] * direction.Y + matrix[9] * direction.Z,
+            matrix[2] * direction.X + matrix[6] * direction.Y + matrix[10] * direction.Z
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Mat4x4::TransformPointProjective(const Mat4x4& matrix, const Vector3& point)
+    {
+        const float invW = 1.0f / (matrix[3] * point.X + matrix[7] * point.Y + matrix[11] * point.Z + matrix[15]);
+        return TransformPoint(matrix, point) * invW;
+    }
+}
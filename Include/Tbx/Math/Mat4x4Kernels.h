@@ -0,0 +1,253 @@
+#pragma once
+#include "Tbx/Math/Simd.h"
+#include <type_traits>
+
+// Column major 4x4 matrix kernels working directly on Mat4x4::Values storage.
+// All pointers must point to 16 floats aligned to 16 bytes, and the result must not alias an input.
+// Each kernel falls back to scalar code when evaluated at compile time or when no SIMD instruction set is available.
+
+namespace Tbx::Simd
+{
+#ifdef TBX_MATH_SSE2
+    // Immediate operand selecting elements x, y, z and w for _mm_shuffle_ps and friends, same as _MM_SHUFFLE(w, z, y, x)
+    constexpr int ShuffleMask(int x, int y, int z, int w)
+    {
+        return x | (y << 2) | (z << 4) | (w << 6);
+    }
+
+    template <int X, int Y, int Z, int W>
+    inline __m128 Swizzle(__m128 vec)
+    {
+        constexpr int mask = ShuffleMask(X, Y, Z, W);
+        return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(vec), mask));
+    }
+
+    template <int X, int Y, int Z, int W>
+    inline __m128 Shuffle(__m128 lhs, __m128 rhs)
+    {
+        constexpr int mask = ShuffleMask(X, Y, Z, W);
+        return _mm_shuffle_ps(lhs, rhs, mask);
+    }
+
+    // 2x2 matrix multiply A * B, with each 2x2 matrix packed into one register
+    inline __m128 Mat2Multiply(__m128 a, __m128 b)
+    {
+        return _mm_add_ps(
+            _mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+            _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+    }
+
+    // 2x2 matrix adjugate multiply adj(A) * B
+    inline __m128 Mat2AdjugateMultiply(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+            _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+    }
+
+    // 2x2 matrix multiply adjugate A * adj(B)
+    inline __m128 Mat2MultiplyAdjugate(__m128 a, __m128 b)
+    {
+        return _mm_sub_ps(
+            _mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+            _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+    }
+
+    /// <summary>
+    /// Multiplies two column major 4x4 matrices one result column at a time, result = lhs * rhs.
+    /// With Stream the columns are written with non temporal stores, which the caller must follow with an _mm_sfence.
+    /// </summary>
+    template <bool Stream>
+    inline void Mat4x4MultiplyColumns(const float* lhs, const float* rhs, float* result)
+    {
+        const __m128 col0 = _mm_load_ps(lhs);
+        const __m128 col1 = _mm_load_ps(lhs + 4);
+        const __m128 col2 = _mm_load_ps(lhs + 8);
+        const __m128 col3 = _mm_load_ps(lhs + 12);
+        for (int col = 0; col < 4; col++)
+        {
+            const __m128 other = _mm_load_ps(rhs + col * 4);
+            __m128 sum = _mm_mul_ps(col0, Swizzle<0, 0, 0, 0>(other));
+            sum = _mm_add_ps(sum, _mm_mul_ps(col1, Swizzle<1, 1, 1, 1>(other)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(col2, Swizzle<2, 2, 2, 2>(other)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(col3, Swizzle<3, 3, 3, 3>(other)));
+            if constexpr (Stream) _mm_stream_ps(result + col * 4, sum);
+            else _mm_store_ps(result + col * 4, sum);
+        }
+    }
+#endif
+
+    /// <summary>
+    /// Multiplies two column major 4x4 matrices, result = lhs * rhs.
+    /// </summary>
+    constexpr void Mat4x4Multiply(const float* lhs, const float* rhs, float* result)
+    {
+#if defined(TBX_MATH_AVX2)
+        if (!std::is_constant_evaluated())
+        {
+            // Two result columns per iteration, each 128 bit lane holds one column
+            constexpr int broadcastX = ShuffleMask(0, 0, 0, 0);
+            constexpr int broadcastY = ShuffleMask(1, 1, 1, 1);
+            constexpr int broadcastZ = ShuffleMask(2, 2, 2, 2);
+            constexpr int broadcastW = ShuffleMask(3, 3, 3, 3);
+            const __m256 col0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs));
+            const __m256 col1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+            const __m256 col2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+            const __m256 col3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+            for (int col = 0; col < 4; col += 2)
+            {
+                const __m256 other = _mm256_loadu_ps(rhs + col * 4);
+                __m256 sum = _mm256_mul_ps(col0, _mm256_permute_ps(other, broadcastX));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(col1, _mm256_permute_ps(other, broadcastY)));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(col2, _mm256_permute_ps(other, broadcastZ)));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(col3, _mm256_permute_ps(other, broadcastW)));
+                _mm256_storeu_ps(result + col * 4, sum);
+            }
+            return;
+        }
+#elif defined(TBX_MATH_SSE2)
+        if (!std::is_constant_evaluated())
+        {
+            Mat4x4MultiplyColumns<false>(lhs, rhs, result);
+            return;
+        }
+#endif
+        for (int col = 0; col < 4; col++)
+        {
+            for (int row = 0; row < 4; row++)
+            {
+                result[col * 4 + row] =
+                    lhs[row] * rhs[col * 4] +
+                    lhs[4 + row] * rhs[col * 4 + 1] +
+                    lhs[8 + row] * rhs[col * 4 + 2] +
+                    lhs[12 + row] * rhs[col * 4 + 3];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Transposes a 4x4 matrix.
+    /// </summary>
+    constexpr void Mat4x4Transpose(const float* matrix, float* result)
+    {
+#ifdef TBX_MATH_SSE2
+        if (!std::is_constant_evaluated())
+        {
+            __m128 col0 = _mm_load_ps(matrix);
+            __m128 col1 = _mm_load_ps(matrix + 4);
+            __m128 col2 = _mm_load_ps(matrix + 8);
+            __m128 col3 = _mm_load_ps(matrix + 12);
+            _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+            _mm_store_ps(result, col0);
+            _mm_store_ps(result + 4, col1);
+            _mm_store_ps(result + 8, col2);
+            _mm_store_ps(result + 12, col3);
+            return;
+        }
+#endif
+        for (int col = 0; col < 4; col++)
+        {
+            for (int row = 0; row < 4; row++)
+            {
+                result[col * 4 + row] = matrix[row * 4 + col];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Inverts a 4x4 matrix. The matrix must be invertible.
+    /// </summary>
+    constexpr void Mat4x4Inverse(const float* matrix, float* result)
+    {
+#ifdef TBX_MATH_SSE2
+        if (!std::is_constant_evaluated())
+        {
+            // Block matrix inverse, the matrix is split into the 2x2 blocks | A B |
+            //                                                              | C D |
+            const __m128 col0 = _mm_load_ps(matrix);
+            const __m128 col1 = _mm_load_ps(matrix + 4);
+            const __m128 col2 = _mm_load_ps(matrix + 8);
+            const __m128 col3 = _mm_load_ps(matrix + 12);
+
+            const __m128 a = _mm_movelh_ps(col0, col1);
+            const __m128 b = _mm_movehl_ps(col1, col0);
+            const __m128 c = _mm_movelh_ps(col2, col3);
+            const __m128 d = _mm_movehl_ps(col3, col2);
+
+            // Determinants of each block as (|A|, |B|, |C|, |D|)
+            const __m128 blockDets = _mm_sub_ps(
+                _mm_mul_ps(Shuffle<0, 2, 0, 2>(col0, col2), Shuffle<1, 3, 1, 3>(col1, col3)),
+                _mm_mul_ps(Shuffle<1, 3, 1, 3>(col0, col2), Shuffle<0, 2, 0, 2>(col1, col3)));
+            const __m128 detA = Swizzle<0, 0, 0, 0>(blockDets);
+            const __m128 detB = Swizzle<1, 1, 1, 1>(blockDets);
+            const __m128 detC = Swizzle<2, 2, 2, 2>(blockDets);
+            const __m128 detD = Swizzle<3, 3, 3, 3>(blockDets);
+
+            const __m128 dc = Mat2AdjugateMultiply(d, c);
+            const __m128 ab = Mat2AdjugateMultiply(a, b);
+
+            __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Multiply(b, dc));
+            __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Multiply(c, ab));
+            __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MultiplyAdjugate(d, ab));
+            __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MultiplyAdjugate(a, dc));
+
+            // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+            __m128 trace = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+            trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+            trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+            const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+            const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+            x = _mm_mul_ps(x, invDet);
+            y = _mm_mul_ps(y, invDet);
+            z = _mm_mul_ps(z, invDet);
+            w = _mm_mul_ps(w, invDet);
+
+            // Apply the adjugate shuffle while storing
+            _mm_store_ps(result, Shuffle<3, 1, 3, 1>(x, y));
+            _mm_store_ps(result + 4, Shuffle<2, 0, 2, 0>(x, y));
+            _mm_store_ps(result + 8, Shuffle<3, 1, 3, 1>(z, w));
+            _mm_store_ps(result + 12, Shuffle<2, 0, 2, 0>(z, w));
+            return;
+        }
+#endif
+        const float* m = matrix;
+
+        // 2x2 sub-determinants of the lower and upper two rows
+        const float s0 = m[0] * m[5] - m[4] * m[1];
+        const float s1 = m[0] * m[6] - m[4] * m[2];
+        const float s2 = m[0] * m[7] - m[4] * m[3];
+        const float s3 = m[1] * m[6] - m[5] * m[2];
+        const float s4 = m[1] * m[7] - m[5] * m[3];
+        const float s5 = m[2] * m[7] - m[6] * m[3];
+
+        const float c5 = m[10] * m[15] - m[14] * m[11];
+        const float c4 = m[9] * m[15] - m[13] * m[11];
+        const float c3 = m[9] * m[14] - m[13] * m[10];
+        const float c2 = m[8] * m[15] - m[12] * m[11];
+        const float c1 = m[8] * m[14] - m[12] * m[10];
+        const float c0 = m[8] * m[13] - m[12] * m[9];
+
+        const float invDet = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+        result[0] = ( m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+        result[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+        result[2] = ( m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+        result[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+        result[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+        result[5] = ( m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+        result[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+        result[7] = ( m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+        result[8] = ( m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+        result[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+        result[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+        result[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+        result[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+        result[13] = ( m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+        result[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+        result[15] = ( m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+    }
+}
@@ -5,7 +5,23 @@
 #include "Quaternion.h"
 #include "Mat4x4.h"
 #include "Vectors.h"
+#include "Vec.h"
+#include "Mat.h"
 #include "Size.h"
 #include "Bounds.h"
 #include "Int.h"
 #include "Transform.h"
+#include "AABB.h"
+#include "AABBBuffer.h"
+#include "Frustum.h"
+#include "BVH.h"
+#include "TransformBuffer.h"
+#include "TransformHierarchy.h"
+#include "ThreadPool.h"
+#include "AnimationClip.h"
+#include "AnimationSampler.h"
+#include "SkinnedVertexBuffer.h"
+#include "DualQuaternion.h"
+#include "Mat3x4.h"
+#include "Codecs.h"
+#include "PackedVectors.h"
@@ -0,0 +1,72 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Int.h"
+#include "Tbx/Math/Vectors.h"
+#include "Tbx/Math/AABB.h"
+#include <span>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A Vector3 stored as three IEEE half precision floats, 6 bytes instead of 12.
+    /// Halves keep 11 significant bits, so the relative error is at most 2^-11 (about 0.05%), and they overflow to infinity past 65504.
+    /// Conversions round to nearest even, the same as the F16C instructions the batch versions use when available.
+    /// </summary>
+    struct EXPORT Vector3H
+    {
+    public:
+        Vector3H() = default;
+        explicit Vector3H(const Vector3& vector);
+
+        friend constexpr bool operator == (const Vector3H& lhs, const Vector3H& rhs) = default;
+
+        Vector3 ToVector3() const;
+
+        static uint16 FloatToHalf(float value);
+        static float HalfToFloat(uint16 half);
+
+        /// <summary>
+        /// Converts every vector to half precision, matching the Vector3H constructor bit for bit.
+        /// Throws std::out_of_range if out is smaller than vectors.
+        /// </summary>
+        static void FromVector3Batch(std::span<const Vector3> vectors, std::span<Vector3H> out);
+        /// <summary>
+        /// Converts every half precision vector back to full precision, like ToVector3.
+        /// Throws std::out_of_range if out is smaller than vectors.
+        /// </summary>
+        static void ToVector3Batch(std::span<const Vector3H> vectors, std::span<Vector3> out);
+
+        uint16 X = 0;
+        uint16 Y = 0;
+        uint16 Z = 0;
+    };
+
+    /// <summary>
+    /// A position stored as three 16 bit fixed point values relative to a bounding box, 6 bytes instead of 12.
+    /// Unlike Vector3H the precision is uniform across the box: each axis is off by at most size / 131070 for points inside it.
+    /// Points outside the box are clamped to it. The box isn't stored, so the same box must be used to quantize and dequantize.
+    /// </summary>
+    struct EXPORT Vector3Q16
+    {
+    public:
+        friend constexpr bool operator == (const Vector3Q16& lhs, const Vector3Q16& rhs) = default;
+
+        static Vector3Q16 Quantize(const Vector3& position, const AABB& bounds);
+        static Vector3 Dequantize(const Vector3Q16& position, const AABB& bounds);
+
+        /// <summary>
+        /// Quantizes every position against the same box, several positions per SIMD iteration. Results match Quantize bit for bit.
+        /// Throws std::out_of_range if out is smaller than positions.
+        /// </summary>
+        static void QuantizeBatch(std::span<const Vector3> positions, const AABB& bounds, std::span<Vector3Q16> out);
+        /// <summary>
+        /// Dequantizes every position against the same box, several positions per SIMD iteration.
+        /// Throws std::out_of_range if out is smaller than positions.
+        /// </summary>
+        static void DequantizeBatch(std::span<const Vector3Q16> positions, const AABB& bounds, std::span<Vector3> out);
+
+        uint16 X = 0;
+        uint16 Y = 0;
+        uint16 Z = 0;
+    };
+}
@@ -1,6 +1,9 @@
 ﻿#pragma once
 #include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Inline.h"
+#include "Tbx/Math/Trig.h"
 #include "Tbx/Math/Vectors.h"
+#include <span>
 
 namespace Tbx
 {
@@ -12,53 +15,163 @@ namespace Tbx
     public:
         Quaternion() = default;
 
-        Quaternion(float x, float y, float z, float w)
+        constexpr Quaternion(float x, float y, float z, float w)
             : X(x), Y(y), Z(z), W(w) {}
 
-        explicit(false) Quaternion(const Vector3& euler) 
-        { 
-            const auto& q = FromEuler(euler); 
-            X = q.X; Y = q.Y; Z = q.Z; W = q.W; 
-        }
+        constexpr explicit(false) Quaternion(const Vector3& euler)
+            : Quaternion(FromEuler(euler)) {}
 
-        friend Quaternion operator + (const Quaternion& lhs, const Quaternion& rhs) { return Add(lhs, rhs); }
-        friend Quaternion operator - (const Quaternion& lhs, const Quaternion& rhs) { return Subtract(lhs, rhs); }
-        friend Quaternion operator * (const Quaternion& lhs, const Quaternion& rhs) { return Multiply(lhs, rhs); }
-        friend Vector3 operator * (const Quaternion& lhs, const Vector3& rhs) { return Multiply(lhs, rhs); }
-        friend Vector3 operator * (const Vector3& lhs, const Quaternion& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Quaternion operator + (const Quaternion& lhs, const Quaternion& rhs) { return Add(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Quaternion operator - (const Quaternion& lhs, const Quaternion& rhs) { return Subtract(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Quaternion operator * (const Quaternion& lhs, const Quaternion& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Vector3 operator * (const Quaternion& lhs, const Vector3& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Vector3 operator * (const Vector3& lhs, const Quaternion& rhs) { return Multiply(lhs, rhs); }
 
         std::string ToString() const;
 
-        static Quaternion Normalize(const Quaternion& quaternion);
-        static Quaternion Add(const Quaternion& lhs, const Quaternion& rhs);
-        static Quaternion Subtract(const Quaternion& lhs, const Quaternion& rhs);
-        static Quaternion Multiply(const Quaternion& lhs, const Quaternion& rhs);
-        static Vector3 Multiply(const Quaternion& lhs, const Vector3& rhs);
-        static Vector3 Multiply(const Vector3& lhs, const Quaternion& rhs);
+        static TBX_MATH_INLINE_FN Quaternion Normalize(const Quaternion& quaternion);
+        static TBX_MATH_CONSTEXPR_FN Quaternion Add(const Quaternion& lhs, const Quaternion& rhs);
+        static TBX_MATH_CONSTEXPR_FN Quaternion Subtract(const Quaternion& lhs, const Quaternion& rhs);
+        static TBX_MATH_CONSTEXPR_FN Quaternion Multiply(const Quaternion& lhs, const Quaternion& rhs);
+        static TBX_MATH_CONSTEXPR_FN Vector3 Multiply(const Quaternion& lhs, const Vector3& rhs);
+        static TBX_MATH_CONSTEXPR_FN Vector3 Multiply(const Vector3& lhs, const Quaternion& rhs);
+        static TBX_MATH_CONSTEXPR_FN float Dot(const Quaternion& lhs, const Quaternion& rhs);
 
         /// <summary>
         /// Gets the local right from a rotation.
         /// </summary>
-        static Vector3 GetRight(const Quaternion& rot);
+        static TBX_MATH_INLINE_FN Vector3 GetRight(const Quaternion& rot);
         /// <summary>
         /// Gets the local forward from a rotation.
         /// </summary>
-        static Vector3 GetForward(const Quaternion& rot);
+        static TBX_MATH_INLINE_FN Vector3 GetForward(const Quaternion& rot);
         /// <summary>
         /// Gets the local forward from a rotation.
         /// </summary>
-        static Vector3 GetUp(const Quaternion& rot);
+        static TBX_MATH_INLINE_FN Vector3 GetUp(const Quaternion& rot);
 
-        static Quaternion FromAxisAngle(const Vector3& axis, float angle);
-        static Quaternion FromEuler(const Vector3& euler) { return FromEuler(euler.X, euler.Y, euler.Z); }
-        static Quaternion FromEuler(float x, float y, float z);
+        /// <summary>
+        /// Creates a rotation of angle degrees around axis, which doesn't need to be normalized.
+        /// Can be evaluated at compile time.
+        /// </summary>
+        static constexpr Quaternion FromAxisAngle(const Vector3& axis, float angle);
+        /// <summary>
+        /// Creates a rotation from euler angles in degrees. Can be evaluated at compile time.
+        /// </summary>
+        static constexpr Quaternion FromEuler(const Vector3& euler) { return FromEuler(euler.X, euler.Y, euler.Z); }
+        static constexpr Quaternion FromEuler(float x, float y, float z);
         static Vector3 ToEuler(const Quaternion& quaternion);
+        /// <summary>
+        /// Converts every euler rotation (in degrees) to a quaternion, like FromEuler, several rotations per SIMD iteration.
+        /// Uses the polynomial SinCos from Trig.h, so results can differ from FromEuler by about 1e-7.
+        /// Throws std::out_of_range if out is smaller than euler.
+        /// </summary>
+        static void FromEulerBatch(std::span<const Vector3> euler, std::span<Quaternion> out);
+        /// <summary>
+        /// Converts every quaternion to euler angles in degrees, like ToEuler, several rotations per SIMD iteration.
+        /// Throws std::out_of_range if out is smaller than quaternions.
+        /// </summary>
+        static void ToEulerBatch(std::span<const Quaternion> quaternions, std::span<Vector3> out);
+
+        /// <summary>
+        /// Spherically interpolates between two unit rotations at a constant angular speed, along the shortest path.
+        /// </summary>
+        static TBX_MATH_INLINE_FN Quaternion Slerp(const Quaternion& from, const Quaternion& to, float t);
+        /// <summary>
+        /// Linearly interpolates between two unit rotations along the shortest path and normalizes the result.
+        /// Cheaper than Slerp but the angular speed is not constant, it drifts by up to 0.14 radians halfway between opposite rotations.
+        /// </summary>
+        static TBX_MATH_INLINE_FN Quaternion Nlerp(const Quaternion& from, const Quaternion& to, float t);
+        /// <summary>
+        /// Nlerp with t corrected by a polynomial fit of the slerp angle, which stays within 1e-3 radians of Slerp at nearly the cost of Nlerp.
+        /// </summary>
+        static TBX_MATH_INLINE_FN Quaternion FastSlerp(const Quaternion& from, const Quaternion& to, float t);
+
+        /// <summary>
+        /// Slerps every pair of rotations by the same t, several rotations per SIMD iteration.
+        /// Uses the polynomial trig from Trig.h, so results can differ from Slerp by about 1e-6.
+        /// Throws std::out_of_range if to or out is smaller than from.
+        /// </summary>
+        static void SlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out);
+        /// <summary>
+        /// Slerps every pair of rotations by its own t.
+        /// Throws std::out_of_range if to, t or out is smaller than from.
+        /// </summary>
+        static void SlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out);
+        /// <summary>
+        /// Nlerps every pair of rotations by the same t, several rotations per SIMD iteration.
+        /// Throws std::out_of_range if to or out is smaller than from.
+        /// </summary>
+        static void NlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out);
+        /// <summary>
+        /// Nlerps every pair of rotations by its own t.
+        /// Throws std::out_of_range if to, t or out is smaller than from.
+        /// </summary>
+        static void NlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out);
+        /// <summary>
+        /// FastSlerps every pair of rotations by the same t, several rotations per SIMD iteration.
+        /// Throws std::out_of_range if to or out is smaller than from.
+        /// </summary>
+        static void FastSlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out);
+        /// <summary>
+        /// FastSlerps every pair of rotations by its own t.
+        /// Throws std::out_of_range if to, t or out is smaller than from.
+        /// </summary>
+        static void FastSlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out);
+
+        /// <summary>
+        /// Rotates every vector by the same rotation, like Multiply(rotation, vector), several vectors per SIMD iteration.
+        /// Out may be the same span as vectors. Throws std::out_of_range if out is smaller than vectors.
+        /// </summary>
+        static void RotateBatch(const Quaternion& rotation, std::span<const Vector3> vectors, std::span<Vector3> out);
+        /// <summary>
+        /// Rotates every vector by its own rotation.
+        /// Out may be the same span as vectors. Throws std::out_of_range if rotations or out is smaller than vectors.
+        /// </summary>
+        static void RotateBatch(std::span<const Quaternion> rotations, std::span<const Vector3> vectors, std::span<Vector3> out);
 
         static bool IsEqualOrEquivalent(const Quaternion& lhs, const Quaternion& rhs, float epsilon = 1e-5f);
 
-        float X = 0;
+        /// <summary>
+        /// Aligned to 16 bytes so the batch kernels can load a whole quaternion with one aligned load.
+        /// </summary>
+        alignas(16) float X = 0;
         float Y = 0;
         float Z = 0;
         float W = 1;
     };
-}
\ No newline at end of file
+
+    constexpr Quaternion Quaternion::FromAxisAngle(const Vector3& axis, float angle)
+    {
+        // Same as glm::angleAxis with a normalized axis
+        const float invLength = 1.0f / Math::ConstexprSqrt(axis.X * axis.X + axis.Y * axis.Y + axis.Z * axis.Z);
+        const float halfAngle = Math::DegreesToRadians(angle) * 0.5f;
+        const float s = Math::ConstexprSin(halfAngle);
+        return { axis.X * invLength * s, axis.Y * invLength * s, axis.Z * invLength * s, Math::ConstexprCos(halfAngle) };
+    }
+
+    constexpr Quaternion Quaternion::FromEuler(float x, float y, float z)
+    {
+        // Same composition as glm's quat(vec3) constructor, with Z negated
+        const float halfX = Math::DegreesToRadians(x) * 0.5f;
+        const float halfY = Math::DegreesToRadians(y) * 0.5f;
+        const float halfZ = Math::DegreesToRadians(z) * 0.5f;
+        const float sx = Math::ConstexprSin(halfX);
+        const float cx = Math::ConstexprCos(halfX);
+        const float sy = Math::ConstexprSin(halfY);
+        const float cy = Math::ConstexprCos(halfY);
+        const float sz = Math::ConstexprSin(halfZ);
+        const float cz = Math::ConstexprCos(halfZ);
+        return
+        {
+            sx * cy * cz - cx * sy * sz,
+            cx * sy * cz + sx * cy * sz,
+            -(cx * cy * sz - sx * sy * cz),
+            cx * cy * cz + sx * sy * sz
+        };
+    }
+}
+
+#ifdef TBX_MATH_INLINE
+    #include "Tbx/Math/Quaternion.inl"
+#endif
@@ -0,0 +1,131 @@
+#pragma once
+#include "Tbx/Math/Quaternion.h"
+#include <cmath>
+
+// Hot Quaternion arithmetic.
+// Included by Quaternion.h when TBX_MATH_INLINE is defined, otherwise compiled into the library by Quaternion.cpp.
+
+namespace Tbx
+{
+    TBX_MATH_INLINE_FN Vector3 Quaternion::GetForward(const Quaternion& rot)
+    {
+        return Vector3::Normalize(Multiply(rot, Vector3(0.0f, 0.0f, 1.0f)));
+    }
+
+    TBX_MATH_INLINE_FN Vector3 Quaternion::GetRight(const Quaternion& rot)
+    {
+        return Vector3::Normalize(Multiply(rot, Vector3(-1.0f, 0.0f, 0.0f)));
+    }
+
+    TBX_MATH_INLINE_FN Vector3 Quaternion::GetUp(const Quaternion& rot)
+    {
+        return Vector3::Normalize(Multiply(rot, Vector3(0.0f, 1.0f, 0.0f)));
+    }
+
+    TBX_MATH_INLINE_FN Quaternion Quaternion::Normalize(const Quaternion& quaternion)
+    {
+        const float length = std::sqrt(
+            quaternion.X * quaternion.X +
+            quaternion.Y * quaternion.Y +
+            quaternion.Z * quaternion.Z +
+            quaternion.W * quaternion.W);
+        if (length <= 0.0f)
+        {
+            return { 0.0f, 0.0f, 0.0f, 1.0f };
+        }
+
+        const float invLength = 1.0f / length;
+        return { quaternion.X * invLength, quaternion.Y * invLength, quaternion.Z * invLength, quaternion.W * invLength };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Quaternion Quaternion::Add(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        return { lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z, lhs.W + rhs.W };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Quaternion Quaternion::Subtract(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        return { lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z, lhs.W - rhs.W };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Quaternion Quaternion::Multiply(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        return
+        {
+            lhs.W * rhs.X + lhs.X * rhs.W + lhs.Y * rhs.Z - lhs.Z * rhs.Y,
+            lhs.W * rhs.Y + lhs.Y * rhs.W + lhs.Z * rhs.X - lhs.X * rhs.Z,
+            lhs.W * rhs.Z + lhs.Z * rhs.W + lhs.X * rhs.Y - lhs.Y * rhs.X,
+            lhs.W * rhs.W - lhs.X * rhs.X - lhs.Y * rhs.Y - lhs.Z * rhs.Z
+        };
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Quaternion::Multiply(const Quaternion& lhs, const Vector3& rhs)
+    {
+        // v + 2w(q x v) + 2q x (q x v)
+        const Vector3 axis = { lhs.X, lhs.Y, lhs.Z };
+        const Vector3 uv = Vector3::Cross(axis, rhs);
+        const Vector3 uuv = Vector3::Cross(axis, uv);
+        return Vector3::Add(rhs, Vector3::Multiply(Vector3::Add(Vector3::Multiply(uv, lhs.W), uuv), 2.0f));
+    }
+
+    TBX_MATH_CONSTEXPR_FN Vector3 Quaternion::Multiply(const Vector3& lhs, const Quaternion& rhs)
+    {
+        // Rotates by the inverse of the quaternion
+        const float invLengthSq = 1.0f / (rhs.X * rhs.X + rhs.Y * rhs.Y + rhs.Z * rhs.Z + rhs.W * rhs.W);
+        const Quaternion inverse = { -rhs.X * invLengthSq, -rhs.Y * invLengthSq, -rhs.Z * invLengthSq, rhs.W * invLengthSq };
+        return Multiply(inverse, lhs);
+    }
+
+    TBX_MATH_CONSTEXPR_FN float Quaternion::Dot(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z + lhs.W * rhs.W;
+    }
+
+    TBX_MATH_INLINE_FN Quaternion Quaternion::Nlerp(const Quaternion& from, const Quaternion& to, float t)
+    {
+        // q and -q are the same rotation, flip to onto from's hemisphere so the blend takes the shortest path
+        const float toSign = Dot(from, to) < 0.0f ? -1.0f : 1.0f;
+        return Normalize(
+        {
+            from.X + (to.X * toSign - from.X) * t,
+            from.Y + (to.Y * toSign - from.Y) * t,
+            from.Z + (to.Z * toSign - from.Z) * t,
+            from.W + (to.W * toSign - from.W) * t
+        });
+    }
+
+    TBX_MATH_INLINE_FN Quaternion Quaternion::Slerp(const Quaternion& from, const Quaternion& to, float t)
+    {
+        const float dot = Dot(from, to);
+        const float toSign = dot < 0.0f ? -1.0f : 1.0f;
+        const float cosTheta = dot * toSign;
+
+        // sin(theta) vanishes for nearly equal rotations, where nlerp is indistinguishable from slerp
+        if (cosTheta > 0.9995f)
+        {
+            return Nlerp(from, to, t);
+        }
+
+        const float theta = std::acos(cosTheta);
+        const float invSinTheta = 1.0f / std::sin(theta);
+        const float fromWeight = std::sin((1.0f - t) * theta) * invSinTheta;
+        const float toWeight = std::sin(t * theta) * invSinTheta * toSign;
+        return
+        {
+            from.X * fromWeight + to.X * toWeight,
+            from.Y * fromWeight + to.Y * toWeight,
+            from.Z * fromWeight + to.Z * toWeight,
+            from.W * fromWeight + to.W * toWeight
+        };
+    }
+
+    TBX_MATH_INLINE_FN Quaternion Quaternion::FastSlerp(const Quaternion& from, const Quaternion& to, float t)
+    {
+        // Arseny Kapoulkine's fit of the slerp angle as a function of t and |cos(theta)|, applied to nlerp's t
+        const float d = std::abs(Dot(from, to));
+        const float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+        const float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+        const float k = a * (t - 0.5f) * (t - 0.5f) + b;
+        return Nlerp(from, to, t + t * (t - 0.5f) * (t - 1.0f) * k);
+    }
+}
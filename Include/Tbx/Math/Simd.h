@@ -0,0 +1,31 @@
+#pragma once
+
+// Selects the SIMD instruction set used by the math kernels at compile time.
+// Define TBX_MATH_NO_SIMD to force the scalar fallbacks.
+
+#ifndef TBX_MATH_NO_SIMD
+    #if defined(__AVX2__)
+        /// <summary>
+        /// Defined when the math kernels can use AVX2 (8 wide) instructions.
+        /// </summary>
+        #define TBX_MATH_AVX2
+    #endif
+    #if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        /// <summary>
+        /// Defined when the math kernels can use SSE2 (4 wide) instructions.
+        /// </summary>
+        #define TBX_MATH_SSE2
+    #endif
+    #if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+        /// <summary>
+        /// Defined when the math kernels can use the F16C half precision conversion instructions.
+        /// </summary>
+        #define TBX_MATH_F16C
+    #endif
+#endif
+
+#if defined(TBX_MATH_AVX2) || defined(TBX_MATH_F16C)
+    #include <immintrin.h>
+#elif defined(TBX_MATH_SSE2)
+    #include <emmintrin.h>
+#endif
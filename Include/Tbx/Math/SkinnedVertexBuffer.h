@@ -0,0 +1,108 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/AlignedAllocator.h"
+#include "Tbx/Math/Int.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/ThreadPool.h"
+#include "Tbx/Math/Vectors.h"
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Stores the vertices of a skinned mesh as a structure of arrays, with up to four joint influences per vertex.
+    /// Skinning blends the skin matrices of each vertex's joints by their weights and transforms the vertex by the blend,
+    /// several vertices at a time with SIMD.
+    /// </summary>
+    class EXPORT SkinnedVertexBuffer
+    {
+    public:
+        using FloatArray = std::vector<float, AlignedAllocator<float>>;
+        using IndexArray = std::vector<uint32, AlignedAllocator<uint32>>;
+
+        /// <summary>
+        /// The number of joints that can influence a vertex.
+        /// </summary>
+        static constexpr size_t MaxInfluences = 4;
+
+        /// <summary>
+        /// One vertex with its joint influences. Weights should sum to one, unused influences have a weight of zero.
+        /// </summary>
+        struct Vertex
+        {
+            Vector3 Position = {};
+            Vector3 Normal = {};
+            std::array<uint32, MaxInfluences> Joints = {};
+            std::array<float, MaxInfluences> Weights = { 1.0f, 0.0f, 0.0f, 0.0f };
+        };
+
+        SkinnedVertexBuffer() = default;
+        explicit SkinnedVertexBuffer(std::span<const Vertex> vertices);
+
+        /// <summary>
+        /// Adds a vertex to the end of the buffer and returns its index.
+        /// </summary>
+        size_t Add(const Vertex& vertex);
+
+        Vertex Get(size_t index) const;
+        void Set(size_t index, const Vertex& vertex);
+
+        void Reserve(size_t count);
+        void Clear();
+        size_t Size() const { return _positionX.size(); }
+
+        /// <summary>
+        /// Skins every vertex, writing the blended position and the blended, renormalized normal.
+        /// Normals are transformed by the blended skin matrix itself rather than its inverse transpose, which is only correct
+        /// when the skin matrices have no non-uniform scale. Non-uniformly scaled joints tilt the normals towards the stretched axis.
+        /// The skin matrix of a joint is its world matrix times its inverse bind matrix, see Mat4x4::MultiplyBatch.
+        /// Throws std::out_of_range if an output span is smaller than the buffer or a joint has no skin matrix.
+        /// </summary>
+        void Skin(std::span<const Mat4x4> skinMatrices, std::span<Vector3> outPositions, std::span<Vector3> outNormals) const;
+
+        /// <summary>
+        /// Skins every vertex like Skin, spreading chunks of vertices across the pools threads.
+        /// The result is identical to the single threaded skinning.
+        /// </summary>
+        void Skin(std::span<const Mat4x4> skinMatrices, std::span<Vector3> outPositions, std::span<Vector3> outNormals, ThreadPool& pool) const;
+
+        /// <summary>
+        /// Fixed size views of the vertex components for batch kernels. Joints can only be read, changing them has to go
+        /// through Add or Set so the largest joint Skin checks against stays up to date.
+        /// </summary>
+        std::span<const float> GetPositionX() const { return _positionX; }
+        std::span<const float> GetPositionY() const { return _positionY; }
+        std::span<const float> GetPositionZ() const { return _positionZ; }
+        std::span<const float> GetNormalX() const { return _normalX; }
+        std::span<const float> GetNormalY() const { return _normalY; }
+        std::span<const float> GetNormalZ() const { return _normalZ; }
+        std::span<const uint32> GetJoints(size_t influence) const { return _joints[influence]; }
+        std::span<const float> GetWeights(size_t influence) const { return _weights[influence]; }
+
+        std::span<float> GetPositionX() { return _positionX; }
+        std::span<float> GetPositionY() { return _positionY; }
+        std::span<float> GetPositionZ() { return _positionZ; }
+        std::span<float> GetNormalX() { return _normalX; }
+        std::span<float> GetNormalY() { return _normalY; }
+        std::span<float> GetNormalZ() { return _normalZ; }
+        std::span<float> GetWeights(size_t influence) { return _weights[influence]; }
+
+    private:
+        void ValidateSkin(std::span<const Mat4x4> skinMatrices, std::span<Vector3> outPositions, std::span<Vector3> outNormals) const;
+        void SkinRange(const Mat4x4* skinMatrices, size_t begin, size_t end, Vector3* outPositions, Vector3* outNormals) const;
+
+        FloatArray _positionX;
+        FloatArray _positionY;
+        FloatArray _positionZ;
+        FloatArray _normalX;
+        FloatArray _normalY;
+        FloatArray _normalZ;
+        std::array<IndexArray, MaxInfluences> _joints;
+        std::array<FloatArray, MaxInfluences> _weights;
+
+        // The largest joint index of any influence, so Skin can check the skin matrices without reading every joint
+        uint32 _maxJoint = 0;
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A small pool of worker threads used to run batch math kernels across cores.
+    /// Work is split into chunks that idle threads claim from a shared counter, so faster threads pick up the slack of slower ones.
+    /// </summary>
+    class EXPORT ThreadPool
+    {
+    public:
+        /// <summary>
+        /// Creates a pool using the given number of threads in total, including the thread calling ParallelFor.
+        /// </summary>
+        explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator = (const ThreadPool&) = delete;
+
+        size_t GetThreadCount() const { return _workers.size() + 1; }
+
+        /// <summary>
+        /// Calls work(begin, end) for consecutive chunks of at most grainSize items until [0, count) is covered, and waits for all chunks to finish.
+        /// The calling thread works on chunks too. Work must not throw or call ParallelFor on the same pool.
+        /// Calls from several threads at once are safe, they take turns and each waits for the ones before it to finish.
+        /// </summary>
+        void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& work);
+
+    private:
+        void WorkerLoop();
+        void RunChunks();
+
+        std::vector<std::thread> _workers = {};
+        // Held for a whole ParallelFor, so concurrent callers can't replace the work the workers are running
+        std::mutex _dispatchMutex = {};
+        std::mutex _mutex = {};
+        std::condition_variable _wake = {};
+        std::condition_variable _done = {};
+
+        const std::function<void(size_t, size_t)>* _work = nullptr;
+        size_t _count = 0;
+        size_t _grainSize = 1;
+        std::atomic<size_t> _nextIndex = 0;
+        size_t _busyWorkers = 0;
+        uint64_t _generation = 0;
+        bool _stopping = false;
+    };
+}
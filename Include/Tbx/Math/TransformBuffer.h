@@ -0,0 +1,92 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/AlignedAllocator.h"
+#include "Tbx/Math/Transform.h"
+#include "Tbx/Math/Mat4x4.h"
+#include <span>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Stores many transforms as a structure of arrays, with every position, rotation and scale component in its own aligned array.
+    /// This lets the world matrices of all transforms be computed several transforms at a time with SIMD.
+    /// </summary>
+    class EXPORT TransformBuffer
+    {
+    public:
+        using FloatArray = std::vector<float, AlignedAllocator<float>>;
+
+        TransformBuffer() = default;
+        explicit TransformBuffer(std::span<const Transform> transforms);
+
+        /// <summary>
+        /// Adds a transform to the end of the buffer and returns its index.
+        /// </summary>
+        size_t Add(const Transform& transform);
+
+        /// <summary>
+        /// Removes the transform at the given index by moving the last transform into its place.
+        /// </summary>
+        void Remove(size_t index);
+
+        /// <summary>
+        /// Get and the setters throw std::out_of_range if index is not below Size(), like Remove.
+        /// </summary>
+        Transform Get(size_t index) const;
+        void Set(size_t index, const Transform& transform);
+
+        void SetPosition(size_t index, const Vector3& position);
+        void SetRotation(size_t index, const Quaternion& rotation);
+        void SetScale(size_t index, const Vector3& scale);
+
+        void Reserve(size_t count);
+        void Clear();
+        size_t Size() const { return _positionX.size(); }
+
+        /// <summary>
+        /// Computes the TRS matrix of every transform, out[i] = T * R * S of transform i.
+        /// The matrices are composed directly from the components, without any intermediate matrix multiplies.
+        /// Out must be at least as large as the buffer.
+        /// </summary>
+        void ComputeWorldMatrices(std::span<Mat4x4> out) const;
+
+        /// <summary>
+        /// The component arrays, so batch kernels can read and write them directly. The spans can't be resized, which keeps
+        /// every array the same size.
+        /// </summary>
+        std::span<const float> GetPositionX() const { return _positionX; }
+        std::span<const float> GetPositionY() const { return _positionY; }
+        std::span<const float> GetPositionZ() const { return _positionZ; }
+        std::span<const float> GetRotationX() const { return _rotationX; }
+        std::span<const float> GetRotationY() const { return _rotationY; }
+        std::span<const float> GetRotationZ() const { return _rotationZ; }
+        std::span<const float> GetRotationW() const { return _rotationW; }
+        std::span<const float> GetScaleX() const { return _scaleX; }
+        std::span<const float> GetScaleY() const { return _scaleY; }
+        std::span<const float> GetScaleZ() const { return _scaleZ; }
+
+        std::span<float> GetPositionX() { return _positionX; }
+        std::span<float> GetPositionY() { return _positionY; }
+        std::span<float> GetPositionZ() { return _positionZ; }
+        std::span<float> GetRotationX() { return _rotationX; }
+        std::span<float> GetRotationY() { return _rotationY; }
+        std::span<float> GetRotationZ() { return _rotationZ; }
+        std::span<float> GetRotationW() { return _rotationW; }
+        std::span<float> GetScaleX() { return _scaleX; }
+        std::span<float> GetScaleY() { return _scaleY; }
+        std::span<float> GetScaleZ() { return _scaleZ; }
+
+    private:
+        FloatArray _positionX;
+        FloatArray _positionY;
+        FloatArray _positionZ;
+        FloatArray _rotationX;
+        FloatArray _rotationY;
+        FloatArray _rotationZ;
+        FloatArray _rotationW;
+        FloatArray _scaleX;
+        FloatArray _scaleY;
+        FloatArray _scaleZ;
+    };
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Transform.h"
+#include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/ThreadPool.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Tbx
+{
+    /// <summary>
+    /// A hierarchy of transforms stored in a flat depth-first order, so every parent comes before its children
+    /// and every subtree is a contiguous range of nodes.
+    /// Changing a local transform marks its subtree dirty, and only dirty subtrees have their world matrices recomputed.
+    /// Adding or removing a node shifts the indices of all nodes stored after it.
+    /// </summary>
+    class EXPORT TransformHierarchy
+    {
+    public:
+        /// <summary>
+        /// The parent index of root nodes.
+        /// </summary>
+        static constexpr size_t NoParent = static_cast<size_t>(-1);
+
+        /// <summary>
+        /// The size from which a dirty subtree is split across threads by depth level instead of being updated by one thread.
+        /// </summary>
+        static constexpr size_t LargeSubtreeSize = 4096;
+
+        TransformHierarchy() = default;
+
+        /// <summary>
+        /// Adds a node as the last child of the given parent, or as a new root, and returns its index.
+        /// </summary>
+        size_t Add(const Transform& local, size_t parent = NoParent);
+
+        /// <summary>
+        /// Removes a node and all of its descendants.
+        /// </summary>
+        void Remove(size_t index);
+
+        /// <summary>
+        /// The per node accessors throw std::out_of_range if index is not below Size(), like Add and Remove.
+        /// </summary>
+        const Transform& GetLocal(size_t index) const;
+        void SetLocal(size_t index, const Transform& local);
+
+        size_t GetParent(size_t index) const;
+        size_t GetDescendantCount(size_t index) const;
+        size_t GetDepth(size_t index) const;
+        bool IsDirty(size_t index) const;
+        size_t Size() const { return _locals.size(); }
+
+        /// <summary>
+        /// Gets the world matrix of a node as of the last update.
+        /// </summary>
+        const Mat4x4& GetWorld(size_t index) const;
+        std::span<const Mat4x4> GetWorldMatrices() const { return _worlds; }
+
+        /// <summary>
+        /// Recomputes the world matrices of every dirty subtree and returns the number of nodes that were updated.
+        /// </summary>
+        size_t UpdateWorldMatrices();
+
+        /// <summary>
+        /// Recomputes the world matrix of every node, dirty or not.
+        /// </summary>
+        void UpdateAllWorldMatrices();
+
+        /// <summary>
+        /// Recomputes the world matrices of every dirty subtree, spreading the subtrees across the pools threads.
+        /// Subtrees of LargeSubtreeSize nodes or more, such as a whole scene under one moved root, are instead updated
+        /// one depth level at a time like UpdateAllWorldMatrices(pool), so a single dirty root still uses every thread.
+        /// Returns the number of nodes that were updated. The result is identical to the single threaded update.
+        /// </summary>
+        size_t UpdateWorldMatrices(ThreadPool& pool);
+
+        /// <summary>
+        /// Recomputes the world matrix of every node one depth level at a time, spreading each level across the pools threads.
+        /// The result is identical to the single threaded update.
+        /// </summary>
+        void UpdateAllWorldMatrices(ThreadPool& pool);
+
+    private:
+        void UpdateNode(size_t index);
+        void UpdateRange(size_t begin, size_t end);
+        void UpdateRangeByLevel(ThreadPool& pool, size_t begin, size_t end);
+        void RebuildLevels();
+
+        std::vector<Transform> _locals = {};
+        std::vector<Mat4x4> _worlds = {};
+        std::vector<size_t> _parents = {};
+        std::vector<size_t> _descendantCounts = {};
+        std::vector<size_t> _depths = {};
+        std::vector<uint8_t> _dirty = {};
+
+        /// <summary>
+        /// Node indices grouped by depth, rebuilt lazily after nodes are added or removed.
+        /// </summary>
+        std::vector<std::vector<size_t>> _levels = {};
+        bool _levelsDirty = true;
+    };
+}
@@ -1,13 +1,81 @@
 #pragma once
 #include "Tbx/Math/DllExport.h"
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
 
 namespace Tbx::Math
 {
     EXPORT constexpr float PI = 3.14159265358979323846264338327950288f;
 
-    EXPORT float DegreesToRadians(float degrees);
-    EXPORT float RadiansToDegrees(float radians);
+    EXPORT constexpr float DegreesToRadians(float degrees) { return degrees * 0.01745329251994329576923690768489f; }
+    EXPORT constexpr float RadiansToDegrees(float radians) { return radians * 57.295779513082320876798154814105f; }
 
+    /// <summary>
+    /// Taylor series of sin (or cos when cosine is set) after reducing x to [-pi, pi].
+    /// </summary>
+    constexpr double ConstexprSinCosSeries(double x, bool cosine)
+    {
+        constexpr double twoPi = 6.283185307179586476925286766559;
+        const double turns = x / twoPi;
+        x -= static_cast<double>(static_cast<long long>(turns < 0.0 ? turns - 0.5 : turns + 0.5)) * twoPi;
+
+        // 20 terms put the truncation error of pi^41 / 41! far below a double ulp
+        double term = cosine ? 1.0 : x;
+        double sum = term;
+        for (int n = cosine ? 1 : 2; n < 42; n += 2)
+        {
+            term *= -x * x / (n * (n + 1.0));
+            sum += term;
+        }
+        return sum;
+    }
+
+    /// <summary>
+    /// Sine, cosine, tangent and square root for the constexpr builders.
+    /// At compile time they evaluate a series (or Newton's method) in double precision, which rounds to within an ulp of the standard library.
+    /// At run time they call the standard library, so a builder gives the same result whether it was folded or not.
+    /// </summary>
+    EXPORT constexpr float ConstexprSin(float x)
+    {
+        if (!std::is_constant_evaluated()) return std::sin(x);
+        return static_cast<float>(ConstexprSinCosSeries(x, false));
+    }
+
+    EXPORT constexpr float ConstexprCos(float x)
+    {
+        if (!std::is_constant_evaluated()) return std::cos(x);
+        return static_cast<float>(ConstexprSinCosSeries(x, true));
+    }
+
+    EXPORT constexpr float ConstexprTan(float x)
+    {
+        if (!std::is_constant_evaluated()) return std::tan(x);
+        return static_cast<float>(ConstexprSinCosSeries(x, false) / ConstexprSinCosSeries(x, true));
+    }
+
+    EXPORT constexpr float ConstexprSqrt(float x)
+    {
+        if (!std::is_constant_evaluated()) return std::sqrt(x);
+        if (x < 0.0f) return std::numeric_limits<float>::quiet_NaN();
+        if (x == 0.0f || x == std::numeric_limits<float>::infinity()) return x;
+
+        // Newton's method converges from above once the guess is at least the root
+        double root = x < 1.0f ? 1.0 : static_cast<double>(x);
+        for (int i = 0; i < 200; i++)
+        {
+            const double next = 0.5 * (root + x / root);
+            if (next >= root) break;
+            root = next;
+        }
+        return static_cast<float>(root);
+    }
+
+    /// <summary>
+    /// The trig functions below use the standard library by default.
+    /// When built with TBX_MATH_FAST_TRIG they use the Fast polynomial approximations instead.
+    /// </summary>
     EXPORT float Cos(float x);
     EXPORT float Sin(float x);
     EXPORT float Tan(float x);
@@ -15,5 +83,36 @@ namespace Tbx::Math
     EXPORT float ASin(float x);
     EXPORT float ATan(float x);
 
+    /// <summary>
+    /// Computes the sine and cosine of x together, which is cheaper than calling Sin and Cos separately in the fast mode.
+    /// </summary>
+    EXPORT void SinCos(float x, float& outSin, float& outCos);
+
     EXPORT float Dot(float a, float b);
+
+    /// <summary>
+    /// Minimax polynomial approximations, branch free and vectorizable.
+    /// Measured max absolute errors against double precision:
+    /// FastSin and FastCos 1e-7 for |x| <= 8192 (the error grows beyond that as the range reduction loses precision,
+    /// and from 2^24 on, including infinities and NaN, they fall back to std::sin and std::cos),
+    /// FastTan 2.5e-7 relative where |cos(x)| > 0.01, FastATan 1.5e-7, FastATan2 3e-7, FastASin 2e-7 and FastACos 3e-7.
+    /// FastATan2 gives the same results as std::atan2 for signed zeros and infinities.
+    /// </summary>
+    EXPORT float FastSin(float x);
+    EXPORT float FastCos(float x);
+    EXPORT float FastTan(float x);
+    EXPORT float FastASin(float x);
+    EXPORT float FastACos(float x);
+    EXPORT float FastATan(float x);
+    EXPORT float FastATan2(float y, float x);
+    EXPORT void FastSinCos(float x, float& outSin, float& outCos);
+
+    /// <summary>
+    /// Computes the sine or cosine of every value with SIMD, several values at a time.
+    /// These always use the Fast polynomial approximations. Out must be at least as large as values.
+    /// Like the scalar functions they fall back to std::sin and std::cos from 2^24 on, wherever the value is in the span.
+    /// </summary>
+    EXPORT void SinBatch(std::span<const float> values, std::span<float> out);
+    EXPORT void CosBatch(std::span<const float> values, std::span<float> out);
+    EXPORT void SinCosBatch(std::span<const float> values, std::span<float> outSin, std::span<float> outCos);
 }
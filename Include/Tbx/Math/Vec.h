@@ -0,0 +1,357 @@
+#pragma once
+#include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Inline.h"
+#include "Tbx/Math/VecKernels.h"
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <type_traits>
+
+namespace Tbx
+{
+    /// <summary>
+    /// Component storage for Vec. Vectors of 2, 3 and 4 components have named X, Y, Z, W members and no padding, so arrays of them
+    /// can be read as flat arrays of components. 4 component vectors are aligned to their size, 16 bytes for floats and ints and
+    /// 32 bytes for doubles, so they can be loaded with one aligned SIMD load. Longer vectors store their components in Values.
+    /// 3 component vectors stored in 4 lanes get the same alignment plus one padding component that is always zero.
+    /// </summary>
+    template <typename T, size_t N, size_t Lanes>
+    struct VecStorage
+    {
+        constexpr T& operator[](size_t index) { return Values[index]; }
+        constexpr const T& operator[](size_t index) const { return Values[index]; }
+
+        friend constexpr bool operator == (const VecStorage& lhs, const VecStorage& rhs) = default;
+
+        std::array<T, N> Values = {};
+    };
+
+    template <typename T>
+    struct VecStorage<T, 2, 2>
+    {
+        constexpr T& operator[](size_t index) { return index == 0 ? X : Y; }
+        constexpr const T& operator[](size_t index) const { return index == 0 ? X : Y; }
+
+        friend constexpr bool operator == (const VecStorage& lhs, const VecStorage& rhs) = default;
+
+        T X = 0;
+        T Y = 0;
+    };
+
+    template <typename T>
+    struct VecStorage<T, 3, 3>
+    {
+        constexpr T& operator[](size_t index) { return index == 0 ? X : index == 1 ? Y : Z; }
+        constexpr const T& operator[](size_t index) const { return index == 0 ? X : index == 1 ? Y : Z; }
+
+        friend constexpr bool operator == (const VecStorage& lhs, const VecStorage& rhs) = default;
+
+        T X = 0;
+        T Y = 0;
+        T Z = 0;
+    };
+
+    template <typename T>
+    struct VecStorage<T, 4, 4>
+    {
+        constexpr T& operator[](size_t index) { return index == 0 ? X : index == 1 ? Y : index == 2 ? Z : W; }
+        constexpr const T& operator[](size_t index) const { return index == 0 ? X : index == 1 ? Y : index == 2 ? Z : W; }
+
+        friend constexpr bool operator == (const VecStorage& lhs, const VecStorage& rhs) = default;
+
+        alignas(4 * sizeof(T)) T X = 0;
+        T Y = 0;
+        T Z = 0;
+        T W = 0;
+    };
+
+    template <typename T>
+    struct VecStorage<T, 3, 4>
+    {
+        constexpr T& operator[](size_t index) { return index == 0 ? X : index == 1 ? Y : Z; }
+        constexpr const T& operator[](size_t index) const { return index == 0 ? X : index == 1 ? Y : Z; }
+
+        friend constexpr bool operator == (const VecStorage& lhs, const VecStorage& rhs) = default;
+
+        alignas(4 * sizeof(T)) T X = 0;
+        T Y = 0;
+        T Z = 0;
+
+    private:
+        T _padding = 0;
+    };
+
+    /// <summary>
+    /// A vector of N components of type T, i.e. a position, scale, or direction, stored in Lanes components.
+    /// Vector2, Vector3, Vector4 and Vector2I are aliases of it, Vector2D, Vector3D and Vector4D are their double precision versions,
+    /// and Vector3A is a Vector3 padded to 4 lanes.
+    /// Vectors that fill one 16 byte register (4 lanes of float or int) run the kernels in Simd::VecRegister, every other size and
+    /// type uses the component loops, which unroll into straight line code. Both fall back to the loops at compile time.
+    /// </summary>
+    template <typename T, size_t N, size_t Lanes = N>
+    struct Vec : VecStorage<T, N, Lanes>
+    {
+    public:
+        static_assert(std::is_arithmetic_v<T>, "Vec components must be arithmetic.");
+        static_assert(N >= 2, "Vec must have at least two components.");
+        static_assert(Lanes == N || (N == 3 && Lanes == 4), "Only 3 component vectors can be padded, to 4 lanes.");
+
+        Vec() = default;
+
+        constexpr explicit(false) Vec(T all)
+        {
+            for (size_t i = 0; i < N; i++) (*this)[i] = all;
+        }
+
+        /// <summary>
+        /// Creates a vector from exactly N components, i.e. Vector3(x, y, z).
+        /// </summary>
+        template <typename... Components> requires (sizeof...(Components) == N && (std::is_convertible_v<Components, T> && ...))
+        constexpr Vec(Components... components)
+        {
+            const T values[N] = { static_cast<T>(components)... };
+            for (size_t i = 0; i < N; i++) (*this)[i] = values[i];
+        }
+
+        /// <summary>
+        /// Extends a vector by one component, i.e. Vector4(position, 1) for a homogeneous position.
+        /// </summary>
+        constexpr Vec(const Vec<T, N - 1>& vector, T last) requires (N >= 3)
+        {
+            for (size_t i = 0; i < N - 1; i++) (*this)[i] = vector[i];
+            (*this)[N - 1] = last;
+        }
+
+        /// <summary>
+        /// Converts the first N components of a vector of another type, a longer vector, or a vector with other padding.
+        /// Dropping to 2d is implicit, i.e. Vector2I from a Vector3 screen position, and so is padding, i.e. Vector3A from a Vector3.
+        /// Every other conversion is explicit, so mixed Vector3 and Vector3A arithmetic isn't ambiguous.
+        /// </summary>
+        template <typename U, size_t M, size_t ML> requires (M >= N && (M != N || !std::is_same_v<T, U> || ML != Lanes))
+        constexpr explicit(N != 2 && !(M == N && std::is_same_v<T, U> && Lanes > ML)) Vec(const Vec<U, M, ML>& vector)
+        {
+            for (size_t i = 0; i < N; i++) (*this)[i] = static_cast<T>(vector[i]);
+        }
+
+        friend TBX_MATH_CONSTEXPR_FN Vec operator + (const Vec& lhs, const Vec& rhs) { return Add(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Vec operator - (const Vec& lhs, const Vec& rhs) { return Subtract(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Vec operator * (const Vec& lhs, const Vec& rhs) { return Multiply(lhs, rhs); }
+        friend TBX_MATH_CONSTEXPR_FN Vec operator * (const Vec& lhs, T scalar) { return Multiply(lhs, scalar); }
+        friend TBX_MATH_CONSTEXPR_FN Vec operator * (T scalar, const Vec& rhs) { return Multiply(rhs, scalar); }
+        friend TBX_MATH_CONSTEXPR_FN Vec operator / (const Vec& lhs, T scalar) { return Divide(lhs, scalar); }
+        friend TBX_MATH_CONSTEXPR_FN Vec operator - (const Vec& vector) { return Multiply(vector, T(-1)); }
+        friend constexpr bool operator == (const Vec& lhs, const Vec& rhs) = default;
+
+        TBX_MATH_CONSTEXPR_FN Vec& operator += (const Vec& other);
+        TBX_MATH_CONSTEXPR_FN Vec& operator -= (const Vec& other);
+        TBX_MATH_CONSTEXPR_FN Vec& operator *= (const Vec& other);
+        TBX_MATH_CONSTEXPR_FN Vec& operator *= (T other);
+
+        std::string ToString() const;
+
+        /// <summary>
+        /// Returns true if the vector is nearly zero in all components
+        /// </summary>
+        TBX_MATH_CONSTEXPR_FN bool IsNearlyZero(T tolerance = T(1e-6)) const requires std::floating_point<T>;
+
+        Vec Normalize() const requires std::floating_point<T> { return Normalize(*this); }
+        TBX_MATH_CONSTEXPR_FN Vec Add(const Vec& rhs) const { return Add(*this, rhs); }
+        TBX_MATH_CONSTEXPR_FN Vec Subtract(const Vec& rhs) const { return Subtract(*this, rhs); }
+        TBX_MATH_CONSTEXPR_FN Vec Multiply(const Vec& rhs) const { return Multiply(*this, rhs); }
+        TBX_MATH_CONSTEXPR_FN Vec Multiply(T scalar) const { return Multiply(*this, scalar); }
+        TBX_MATH_CONSTEXPR_FN Vec Cross(const Vec& rhs) const requires (N == 3) { return Cross(*this, rhs); }
+        TBX_MATH_CONSTEXPR_FN T Dot(const Vec& rhs) const { return Dot(*this, rhs); }
+
+        static TBX_MATH_INLINE_FN Vec Normalize(const Vec& vector) requires std::floating_point<T>;
+        static TBX_MATH_CONSTEXPR_FN Vec Add(const Vec& lhs, const Vec& rhs);
+        static TBX_MATH_CONSTEXPR_FN Vec Subtract(const Vec& lhs, const Vec& rhs);
+        static TBX_MATH_CONSTEXPR_FN Vec Multiply(const Vec& lhs, const Vec& rhs);
+        static TBX_MATH_CONSTEXPR_FN Vec Multiply(const Vec& lhs, T scalar);
+        static TBX_MATH_CONSTEXPR_FN Vec Divide(const Vec& lhs, T scalar);
+        static TBX_MATH_CONSTEXPR_FN Vec Cross(const Vec& lhs, const Vec& rhs) requires (N == 3);
+        static TBX_MATH_CONSTEXPR_FN T Dot(const Vec& lhs, const Vec& rhs);
+
+    private:
+        using Register = Simd::VecRegister<T, Lanes>;
+
+        // Wrapped in a constexpr function since the kernels are only constexpr with TBX_MATH_INLINE, where they need the loops
+        // at compile time. Without it the kernels always run at run time and this is always false.
+        static constexpr bool IsConstantEvaluated() { return std::is_constant_evaluated(); }
+
+        static auto LoadRegister(const Vec& vector) requires Register::IsSupported { return Register::Load(&vector[0]); }
+        static Vec StoreRegister(const auto& value) requires Register::IsSupported
+        {
+            Vec result;
+            Register::Store(&result[0], value);
+            return result;
+        }
+    };
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes>& Vec<T, N, Lanes>::operator+=(const Vec& other)
+    {
+        *this = Add(*this, other);
+        return *this;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes>& Vec<T, N, Lanes>::operator-=(const Vec& other)
+    {
+        *this = Subtract(*this, other);
+        return *this;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes>& Vec<T, N, Lanes>::operator*=(const Vec& other)
+    {
+        *this = Multiply(*this, other);
+        return *this;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes>& Vec<T, N, Lanes>::operator*=(T other)
+    {
+        *this = Multiply(*this, other);
+        return *this;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    std::string Vec<T, N, Lanes>::ToString() const
+    {
+        std::string result = std::format("({}", (*this)[0]);
+        for (size_t i = 1; i < N; i++)
+        {
+            result += std::format(", {}", (*this)[i]);
+        }
+        return result + ")";
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN bool Vec<T, N, Lanes>::IsNearlyZero(T tolerance) const requires std::floating_point<T>
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            const T value = (*this)[i];
+            if (!((value < 0 ? -value : value) < tolerance)) return false;
+        }
+        return true;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_INLINE_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Normalize(const Vec& vector) requires std::floating_point<T>
+    {
+        return Multiply(vector, T(1) / std::sqrt(Dot(vector, vector)));
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Add(const Vec& lhs, const Vec& rhs)
+    {
+        if constexpr (Register::IsSupported)
+        {
+            if (!IsConstantEvaluated()) return StoreRegister(Register::Add(LoadRegister(lhs), LoadRegister(rhs)));
+        }
+
+        Vec result;
+        for (size_t i = 0; i < N; i++) result[i] = lhs[i] + rhs[i];
+        return result;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Subtract(const Vec& lhs, const Vec& rhs)
+    {
+        if constexpr (Register::IsSupported)
+        {
+            if (!IsConstantEvaluated()) return StoreRegister(Register::Subtract(LoadRegister(lhs), LoadRegister(rhs)));
+        }
+
+        Vec result;
+        for (size_t i = 0; i < N; i++) result[i] = lhs[i] - rhs[i];
+        return result;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Multiply(const Vec& lhs, const Vec& rhs)
+    {
+        if constexpr (Register::IsSupported)
+        {
+            if (!IsConstantEvaluated()) return StoreRegister(Register::Multiply(LoadRegister(lhs), LoadRegister(rhs)));
+        }
+
+        Vec result;
+        for (size_t i = 0; i < N; i++) result[i] = lhs[i] * rhs[i];
+        return result;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Multiply(const Vec& lhs, T scalar)
+    {
+        if constexpr (Register::IsSupported)
+        {
+            // The padding lane is scaled by zero, so an infinite or NaN scalar can't make it nonzero
+            if (!IsConstantEvaluated()) return StoreRegister(Register::Multiply(LoadRegister(lhs), Register::Set(scalar, N == Lanes ? scalar : T(0))));
+        }
+
+        Vec result;
+        for (size_t i = 0; i < N; i++) result[i] = lhs[i] * scalar;
+        return result;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Divide(const Vec& lhs, T scalar)
+    {
+        // Ints have no SIMD division, they keep the loop
+        if constexpr (Register::IsSupported && std::is_floating_point_v<T>)
+        {
+            // The padding lane is divided by one, so dividing by zero can't make it NaN
+            if (!IsConstantEvaluated()) return StoreRegister(Register::Divide(LoadRegister(lhs), Register::Set(scalar, N == Lanes ? scalar : T(1))));
+        }
+
+        Vec result;
+        for (size_t i = 0; i < N; i++) result[i] = lhs[i] / scalar;
+        return result;
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN Vec<T, N, Lanes> Vec<T, N, Lanes>::Cross(const Vec& lhs, const Vec& rhs) requires (N == 3)
+    {
+        if constexpr (Register::IsSupported)
+        {
+            if (!IsConstantEvaluated()) return StoreRegister(Register::Cross(LoadRegister(lhs), LoadRegister(rhs)));
+        }
+
+        return
+        {
+            lhs.Y * rhs.Z - rhs.Y * lhs.Z,
+            lhs.Z * rhs.X - rhs.Z * lhs.X,
+            lhs.X * rhs.Y - rhs.X * lhs.Y
+        };
+    }
+
+    template <typename T, size_t N, size_t Lanes>
+    TBX_MATH_CONSTEXPR_FN T Vec<T, N, Lanes>::Dot(const Vec& lhs, const Vec& rhs)
+    {
+        if constexpr (Register::IsSupported)
+        {
+            // Zero padding adds nothing to the sum
+            if (!IsConstantEvaluated()) return Register::Dot(LoadRegister(lhs), LoadRegister(rhs));
+        }
+
+        T result = lhs[0] * rhs[0];
+        for (size_t i = 1; i < N; i++) result += lhs[i] * rhs[i];
+        return result;
+    }
+
+#ifndef TBX_MATH_INLINE
+    // The float and int vectors used across the library are compiled once into it by Vectors.cpp, like the other hot math.
+    // Other instantiations, i.e. the double precision vectors, are compiled at their call sites.
+    extern template struct EXPORT Vec<float, 2>;
+    extern template struct EXPORT Vec<float, 3>;
+    extern template struct EXPORT Vec<float, 4>;
+    extern template struct EXPORT Vec<float, 3, 4>;
+    extern template struct EXPORT Vec<int, 2>;
+    extern template struct EXPORT Vec<int, 4>;
+#endif
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "Tbx/Math/Simd.h"
+#include <cstddef>
+
+// Kernels for the Vec sizes that fill exactly one 16 byte register, 4 floats or 4 ints, including the padded 3 component vectors.
+// Loads and stores are aligned, Vec aligns these sizes to 16 bytes. Padding lanes must be zero on input and are kept zero.
+
+namespace Tbx::Simd
+{
+    /// <summary>
+    /// Register kernels for a Vec of T with Lanes stored components. Only specialized for the sizes that fill one SIMD register,
+    /// Vec uses its component loops whenever IsSupported is false.
+    /// </summary>
+    template <typename T, size_t Lanes>
+    struct VecRegister
+    {
+        static constexpr bool IsSupported = false;
+    };
+
+#ifdef TBX_MATH_SSE2
+    template <>
+    struct VecRegister<float, 4>
+    {
+        static constexpr bool IsSupported = true;
+
+        static __m128 Load(const float* ptr) { return _mm_load_ps(ptr); }
+        static void Store(float* ptr, __m128 value) { _mm_store_ps(ptr, value); }
+        // The last lane is set separately so padded vectors can keep their padding zero
+        static __m128 Set(float value, float last) { return _mm_setr_ps(value, value, value, last); }
+
+        static __m128 Add(__m128 lhs, __m128 rhs) { return _mm_add_ps(lhs, rhs); }
+        static __m128 Subtract(__m128 lhs, __m128 rhs) { return _mm_sub_ps(lhs, rhs); }
+        static __m128 Multiply(__m128 lhs, __m128 rhs) { return _mm_mul_ps(lhs, rhs); }
+        static __m128 Divide(__m128 lhs, __m128 rhs) { return _mm_div_ps(lhs, rhs); }
+
+        static float Dot(__m128 lhs, __m128 rhs)
+        {
+            const __m128 products = _mm_mul_ps(lhs, rhs);
+            const __m128 pairs = _mm_add_ps(products, _mm_movehl_ps(products, products));
+            return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+        }
+
+        // Cross of the first three lanes, the fourth lane is w * w - w * w so zero padding stays zero
+        static __m128 Cross(__m128 lhs, __m128 rhs)
+        {
+            const __m128 lhsYZX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 rhsYZX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 result = _mm_sub_ps(_mm_mul_ps(lhs, rhsYZX), _mm_mul_ps(lhsYZX, rhs));
+            return _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+    };
+
+    template <>
+    struct VecRegister<int, 4>
+    {
+        static_assert(sizeof(int) == 4, "Int vectors are loaded as four 32 bit lanes.");
+
+        static constexpr bool IsSupported = true;
+
+        static __m128i Load(const int* ptr) { return _mm_load_si128(reinterpret_cast<const __m128i*>(ptr)); }
+        static void Store(int* ptr, __m128i value) { _mm_store_si128(reinterpret_cast<__m128i*>(ptr), value); }
+        static __m128i Set(int value, int last) { return _mm_setr_epi32(value, value, value, last); }
+
+        static __m128i Add(__m128i lhs, __m128i rhs) { return _mm_add_epi32(lhs, rhs); }
+        static __m128i Subtract(__m128i lhs, __m128i rhs) { return _mm_sub_epi32(lhs, rhs); }
+
+        static __m128i Multiply(__m128i lhs, __m128i rhs)
+        {
+#ifdef TBX_MATH_AVX2
+            return _mm_mullo_epi32(lhs, rhs);
+#else
+            // SSE2 only multiplies the even lanes, so the odd lanes are shifted down and multiplied separately
+            const __m128i even = _mm_mul_epu32(lhs, rhs);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_si128(lhs, 4), _mm_srli_si128(rhs, 4));
+            return _mm_unpacklo_epi32(
+                _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+        }
+
+        static int Dot(__m128i lhs, __m128i rhs)
+        {
+            const __m128i products = Multiply(lhs, rhs);
+            const __m128i pairs = _mm_add_epi32(products, _mm_shuffle_epi32(products, _MM_SHUFFLE(1, 0, 3, 2)));
+            return _mm_cvtsi128_si32(_mm_add_epi32(pairs, _mm_shuffle_epi32(pairs, _MM_SHUFFLE(2, 3, 0, 1))));
+        }
+
+        static __m128i Cross(__m128i lhs, __m128i rhs)
+        {
+            const __m128i lhsYZX = _mm_shuffle_epi32(lhs, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128i rhsYZX = _mm_shuffle_epi32(rhs, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128i result = _mm_sub_epi32(Multiply(lhs, rhsYZX), Multiply(lhsYZX, rhs));
+            return _mm_shuffle_epi32(result, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+    };
+#endif
+}
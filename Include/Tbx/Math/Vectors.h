@@ -1,89 +1,37 @@
 #pragma once
 #include "Tbx/Math/DllExport.h"
+#include "Tbx/Math/Inline.h"
+#include "Tbx/Math/Vec.h"
 
 namespace Tbx
 {
     /// <summary>
     /// Represents a position, scale, or direction in 3d space. X, Y, Z are stored as euler angles.
     /// </summary>
-    struct EXPORT Vector3
-    {
-    public:
-        Vector3() = default;
-        explicit(false) Vector3(float all) : X(all), Y(all), Z(all) {}
-        Vector3(float x, float y, float z) : X(x), Y(y), Z(z) {}
-
-        friend Vector3 operator + (const Vector3& lhs, const Vector3& rhs) { return Add(lhs, rhs); }
-        friend Vector3 operator - (const Vector3& lhs, const Vector3& rhs) { return Subtract(lhs, rhs); }
-        friend Vector3 operator * (const Vector3& lhs, const Vector3& rhs) { return Multiply(lhs, rhs); }
-        friend Vector3 operator * (const Vector3& lhs, float scalar) { return Multiply(lhs, scalar); }
-
-        Vector3& operator += (const Vector3& other);
-        Vector3& operator -= (const Vector3& other);
-        Vector3& operator *= (const Vector3& other);
-        Vector3& operator *= (float other);
-
-        std::string ToString() const;
-
-        /// <summary>
-        /// Returns true if the vector is nearly zero in all components
-        /// </summary>
-        bool IsNearlyZero(float tolerance = 1e-6f) const;
-
-        Vector3 Normalize() const { return Normalize(*this); }
-        Vector3 Add(const Vector3& rhs) const { return Add(*this, rhs); }
-        Vector3 Subtract(const Vector3& rhs) const { return Subtract(*this, rhs); }
-        Vector3 Multiply(const Vector3& rhs) const { return Multiply(*this, rhs); }
-        Vector3 Multiply(float scalar) const { return Multiply(*this, scalar); }
-        Vector3 Cross(const Vector3& rhs) const { return Cross(*this, rhs); }
-        float Dot(const Vector3& rhs) const { return Dot(*this, rhs); }
-
-        static Vector3 Normalize(const Vector3& vector);
-        static Vector3 Add(const Vector3& lhs, const Vector3& rhs);
-        static Vector3 Subtract(const Vector3& lhs, const Vector3& rhs);
-        static Vector3 Multiply(const Vector3& lhs, const Vector3& rhs);
-        static Vector3 Multiply(const Vector3& lhs, float scalar);
-        static Vector3 Cross(const Vector3& lhs, const Vector3& rhs);
-        static float Dot(const Vector3& lhs, const Vector3& rhs);
-
-        float X = 0;
-        float Y = 0;
-        float Z = 0;
-    };
+    using Vector3 = Vec<float, 3>;
+    using Vector3D = Vec<double, 3>;
+    using Vector3I = Vec<int, 3>;
 
     /// <summary>
-    /// Represents a position, scale, or direction in 2d space. X, Y are stored as euler angles.
+    /// A Vector3 padded to 16 bytes and aligned to 16 bytes, so arrays of it can be read and written with aligned SIMD loads and stores.
+    /// Use it for storage that batch kernels work on, Vector3 stays 12 bytes for everything else.
+    /// The padding is always zero, so the Vec kernels run on it as one SIMD register like they do for Vector4.
     /// </summary>
-    struct EXPORT Vector2
-    {
-    public:
-        Vector2() = default;
-        explicit(false) Vector2(float x) : X(x), Y(x) {}
-        Vector2(float x, float y) : X(x), Y(y) {}
-        explicit(false) Vector2(const Vector3& vector) : X(vector.X), Y(vector.Y) {}
+    using Vector3A = Vec<float, 3, 4>;
 
-        std::string ToString() const;
-
-        float X = 0;
-        float Y = 0;
-    };
+    /// <summary>
+    /// Represents a 4 component vector, i.e. a homogeneous position or a color, aligned to 16 bytes for SIMD loads and stores.
+    /// </summary>
+    using Vector4 = Vec<float, 4>;
+    using Vector4D = Vec<double, 4>;
+    using Vector4I = Vec<int, 4>;
 
     /// <summary>
     /// Represents a position, scale, or direction in 2d space. X, Y are stored as euler angles.
     /// </summary>
-    struct EXPORT Vector2I
-    {
-    public:
-        Vector2I() = default;
-        explicit(false) Vector2I(int x) : X(x), Y(x) {}
-        explicit(false) Vector2I(const Vector3& vector) : X(static_cast<int>(vector.X)), Y(static_cast<int>(vector.Y)) {}
-        Vector2I(int x, int y) : X(x), Y(y) {}
-
-        std::string ToString() const;
-
-        int X = 0;
-        int Y = 0;
-    };
+    using Vector2 = Vec<float, 2>;
+    using Vector2D = Vec<double, 2>;
+    using Vector2I = Vec<int, 2>;
 
     namespace WorldSpace
     {
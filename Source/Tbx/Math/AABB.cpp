@@ -0,0 +1,101 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/AABB.h"
+
+namespace Tbx
+{
+    std::string AABB::ToString() const { return std::format("[Min: {}, Max: {}]", Min.ToString(), Max.ToString()); }
+
+    Vector3 AABB::GetCenter() const
+    {
+        return { (Min.X + Max.X) * 0.5f, (Min.Y + Max.Y) * 0.5f, (Min.Z + Max.Z) * 0.5f };
+    }
+
+    Vector3 AABB::GetExtents() const
+    {
+        return { (Max.X - Min.X) * 0.5f, (Max.Y - Min.Y) * 0.5f, (Max.Z - Min.Z) * 0.5f };
+    }
+
+    Vector3 AABB::GetSize() const
+    {
+        return { Max.X - Min.X, Max.Y - Min.Y, Max.Z - Min.Z };
+    }
+
+    bool AABB::IsEmpty() const
+    {
+        return Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z;
+    }
+
+    AABB AABB::FromCenterExtents(const Vector3& center, const Vector3& extents)
+    {
+        return
+        {
+            { center.X - extents.X, center.Y - extents.Y, center.Z - extents.Z },
+            { center.X + extents.X, center.Y + extents.Y, center.Z + extents.Z }
+        };
+    }
+
+    AABB AABB::Merge(const AABB& lhs, const AABB& rhs)
+    {
+        return
+        {
+            { std::min(lhs.Min.X, rhs.Min.X), std::min(lhs.Min.Y, rhs.Min.Y), std::min(lhs.Min.Z, rhs.Min.Z) },
+            { std::max(lhs.Max.X, rhs.Max.X), std::max(lhs.Max.Y, rhs.Max.Y), std::max(lhs.Max.Z, rhs.Max.Z) }
+        };
+    }
+
+    AABB AABB::Merge(const AABB& box, const Vector3& point)
+    {
+        return Merge(box, AABB(point, point));
+    }
+
+    bool AABB::Contains(const AABB& box, const Vector3& point)
+    {
+        return
+            point.X >= box.Min.X && point.X <= box.Max.X &&
+            point.Y >= box.Min.Y && point.Y <= box.Max.Y &&
+            point.Z >= box.Min.Z && point.Z <= box.Max.Z;
+    }
+
+    bool AABB::Contains(const AABB& outer, const AABB& inner)
+    {
+        return
+            inner.Min.X >= outer.Min.X && inner.Max.X <= outer.Max.X &&
+            inner.Min.Y >= outer.Min.Y && inner.Max.Y <= outer.Max.Y &&
+            inner.Min.Z >= outer.Min.Z && inner.Max.Z <= outer.Max.Z;
+    }
+
+    bool AABB::Overlaps(const AABB& lhs, const AABB& rhs)
+    {
+        return
+            lhs.Min.X <= rhs.Max.X && lhs.Max.X >= rhs.Min.X &&
+            lhs.Min.Y <= rhs.Max.Y && lhs.Max.Y >= rhs.Min.Y &&
+            lhs.Min.Z <= rhs.Max.Z && lhs.Max.Z >= rhs.Min.Z;
+    }
+
+    AABB AABB::TransformBy(const AABB& box, const Mat4x4& matrix)
+    {
+        if (box.IsEmpty()) return box;
+
+        const float min[3] = { box.Min.X, box.Min.Y, box.Min.Z };
+        const float max[3] = { box.Max.X, box.Max.Y, box.Max.Z };
+        float newMin[3];
+        float newMax[3];
+
+        // Start from the translation, then for each output axis add the smaller and larger of
+        // the two candidate contributions of every input axis (Arvo, Graphics Gems 1990).
+        for (int row = 0; row < 3; row++)
+        {
+            newMin[row] = newMax[row] = matrix.Values[12 + row];
+            for (int col = 0; col < 3; col++)
+            {
+                const float m = matrix.Values[col * 4 + row];
+                const float a = m * min[col];
+                const float b = m * max[col];
+                newMin[row] += std::min(a, b);
+                newMax[row] += std::max(a, b);
+            }
+        }
+
+        return { { newMin[0], newMin[1], newMin[2] }, { newMax[0], newMax[1], newMax[2] } };
+    }
+}
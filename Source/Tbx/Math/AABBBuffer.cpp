@@ -0,0 +1,247 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/AABBBuffer.h"
+#include "Tbx/Math/SimdLanes.h"
+
+namespace Tbx
+{
+    /// <summary>
+    /// Distance in floats between the same element of two consecutive matrices in a span.
+    /// </summary>
+    static constexpr size_t MatrixStride = sizeof(Mat4x4) / sizeof(float);
+    static_assert(MatrixStride == 16, "Gathering matrix elements assumes tightly packed matrices.");
+
+    /// <summary>
+    /// Transforms Lanes::Width boxes starting at index using Arvo's method. Empty boxes are passed through unchanged like AABB::TransformBy,
+    /// the infinite bounds would otherwise turn into NaNs.
+    /// LoadElement returns the lanes for one element of the matrix of each box, given the element's index in Mat4x4::Values.
+    /// </summary>
+    template <typename Lanes, typename LoadElement>
+    static void TransformBoxes(const AABBBuffer& in, size_t index, LoadElement&& loadElement, AABBBuffer& out)
+    {
+        const Lanes min[3] = { Lanes::Load(in.GetMinX().data() + index), Lanes::Load(in.GetMinY().data() + index), Lanes::Load(in.GetMinZ().data() + index) };
+        const Lanes max[3] = { Lanes::Load(in.GetMaxX().data() + index), Lanes::Load(in.GetMaxY().data() + index), Lanes::Load(in.GetMaxZ().data() + index) };
+        float* outMin[3] = { out.GetMinX().data() + index, out.GetMinY().data() + index, out.GetMinZ().data() + index };
+        float* outMax[3] = { out.GetMaxX().data() + index, out.GetMaxY().data() + index, out.GetMaxZ().data() + index };
+        const Lanes empty = Simd::Greater(min[0], max[0]) | Simd::Greater(min[1], max[1]) | Simd::Greater(min[2], max[2]);
+
+        for (int row = 0; row < 3; row++)
+        {
+            Lanes newMin = loadElement(Lanes(), 12 + row);
+            Lanes newMax = newMin;
+            for (int col = 0; col < 3; col++)
+            {
+                const Lanes m = loadElement(Lanes(), col * 4 + row);
+                const Lanes a = m * min[col];
+                const Lanes b = m * max[col];
+                newMin = newMin + Simd::Min(a, b);
+                newMax = newMax + Simd::Max(a, b);
+            }
+            Simd::Select(empty, min[row], newMin).Store(outMin[row]);
+            Simd::Select(empty, max[row], newMax).Store(outMax[row]);
+        }
+    }
+
+    AABBBuffer::AABBBuffer(std::span<const AABB> boxes)
+    {
+        Reserve(boxes.size());
+        for (const auto& box : boxes)
+        {
+            Add(box);
+        }
+    }
+
+    size_t AABBBuffer::Add(const AABB& box)
+    {
+        // Every array gets room before any of them grows, so a failed allocation throws while they are still the same size
+        const size_t size = Size();
+        for (FloatArray* array : { &_minX, &_minY, &_minZ, &_maxX, &_maxY, &_maxZ })
+        {
+            if (array->capacity() == size) array->reserve(std::max<size_t>(size * 2, 16));
+        }
+
+        _minX.push_back(box.Min.X);
+        _minY.push_back(box.Min.Y);
+        _minZ.push_back(box.Min.Z);
+        _maxX.push_back(box.Max.X);
+        _maxY.push_back(box.Max.Y);
+        _maxZ.push_back(box.Max.Z);
+        return Size() - 1;
+    }
+
+    void AABBBuffer::Remove(size_t index)
+    {
+        if (index >= Size()) throw std::out_of_range("Box index is out of range.");
+
+        const size_t last = Size() - 1;
+        for (FloatArray* array : { &_minX, &_minY, &_minZ, &_maxX, &_maxY, &_maxZ })
+        {
+            (*array)[index] = (*array)[last];
+            array->pop_back();
+        }
+    }
+
+    AABB AABBBuffer::Get(size_t index) const
+    {
+        if (index >= Size()) throw std::out_of_range("Box index is out of range.");
+        return { { _minX[index], _minY[index], _minZ[index] }, { _maxX[index], _maxY[index], _maxZ[index] } };
+    }
+
+    void AABBBuffer::Set(size_t index, const AABB& box)
+    {
+        if (index >= Size()) throw std::out_of_range("Box index is out of range.");
+
+        _minX[index] = box.Min.X;
+        _minY[index] = box.Min.Y;
+        _minZ[index] = box.Min.Z;
+        _maxX[index] = box.Max.X;
+        _maxY[index] = box.Max.Y;
+        _maxZ[index] = box.Max.Z;
+    }
+
+    void AABBBuffer::Reserve(size_t count)
+    {
+        for (FloatArray* array : { &_minX, &_minY, &_minZ, &_maxX, &_maxY, &_maxZ })
+        {
+            array->reserve(count);
+        }
+    }
+
+    void AABBBuffer::Resize(size_t count)
+    {
+        for (FloatArray* array : { &_minX, &_minY, &_minZ, &_maxX, &_maxY, &_maxZ })
+        {
+            array->resize(count);
+        }
+    }
+
+    void AABBBuffer::Clear()
+    {
+        for (FloatArray* array : { &_minX, &_minY, &_minZ, &_maxX, &_maxY, &_maxZ })
+        {
+            array->clear();
+        }
+    }
+
+    AABB AABBBuffer::ComputeBounds() const
+    {
+        const size_t count = Size();
+        const float infinity = std::numeric_limits<float>::infinity();
+
+        auto reduce = [this, count, infinity]<typename Lanes>(Lanes, size_t& index, AABB& bounds)
+        {
+            Lanes minX = Lanes::Set(infinity), minY = minX, minZ = minX;
+            Lanes maxX = Lanes::Set(-infinity), maxY = maxX, maxZ = maxX;
+            for (; index + Lanes::Width <= count; index += Lanes::Width)
+            {
+                minX = Simd::Min(minX, Lanes::Load(_minX.data() + index));
+                minY = Simd::Min(minY, Lanes::Load(_minY.data() + index));
+                minZ = Simd::Min(minZ, Lanes::Load(_minZ.data() + index));
+                maxX = Simd::Max(maxX, Lanes::Load(_maxX.data() + index));
+                maxY = Simd::Max(maxY, Lanes::Load(_maxY.data() + index));
+                maxZ = Simd::Max(maxZ, Lanes::Load(_maxZ.data() + index));
+            }
+
+            float lanes[6][Lanes::Width];
+            minX.Store(lanes[0]);
+            minY.Store(lanes[1]);
+            minZ.Store(lanes[2]);
+            maxX.Store(lanes[3]);
+            maxY.Store(lanes[4]);
+            maxZ.Store(lanes[5]);
+            for (size_t lane = 0; lane < Lanes::Width; lane++)
+            {
+                bounds = AABB::Merge(bounds, AABB({ lanes[0][lane], lanes[1][lane], lanes[2][lane] }, { lanes[3][lane], lanes[4][lane], lanes[5][lane] }));
+            }
+        };
+
+        AABB bounds;
+        size_t index = 0;
+        reduce(Simd::FloatN(), index, bounds);
+        reduce(Simd::Float1(), index, bounds);
+        return bounds;
+    }
+
+    void AABBBuffer::Contains(const Vector3& point, std::span<uint64> outMask) const
+    {
+        if (outMask.size() < GetMaskWordCount()) throw std::out_of_range("Output mask is smaller than the box buffer.");
+
+        Simd::WriteBitMask(Size(), outMask.data(), [this, &point]<typename Lanes>(Lanes, size_t index)
+        {
+            const Lanes x = Lanes::Set(point.X);
+            const Lanes y = Lanes::Set(point.Y);
+            const Lanes z = Lanes::Set(point.Z);
+            return
+                Simd::LessEqual(Lanes::Load(_minX.data() + index), x) & Simd::GreaterEqual(Lanes::Load(_maxX.data() + index), x) &
+                Simd::LessEqual(Lanes::Load(_minY.data() + index), y) & Simd::GreaterEqual(Lanes::Load(_maxY.data() + index), y) &
+                Simd::LessEqual(Lanes::Load(_minZ.data() + index), z) & Simd::GreaterEqual(Lanes::Load(_maxZ.data() + index), z);
+        });
+    }
+
+    void AABBBuffer::ContainedBy(const AABB& outer, std::span<uint64> outMask) const
+    {
+        if (outMask.size() < GetMaskWordCount()) throw std::out_of_range("Output mask is smaller than the box buffer.");
+
+        Simd::WriteBitMask(Size(), outMask.data(), [this, &outer]<typename Lanes>(Lanes, size_t index)
+        {
+            return
+                Simd::GreaterEqual(Lanes::Load(_minX.data() + index), Lanes::Set(outer.Min.X)) & Simd::LessEqual(Lanes::Load(_maxX.data() + index), Lanes::Set(outer.Max.X)) &
+                Simd::GreaterEqual(Lanes::Load(_minY.data() + index), Lanes::Set(outer.Min.Y)) & Simd::LessEqual(Lanes::Load(_maxY.data() + index), Lanes::Set(outer.Max.Y)) &
+                Simd::GreaterEqual(Lanes::Load(_minZ.data() + index), Lanes::Set(outer.Min.Z)) & Simd::LessEqual(Lanes::Load(_maxZ.data() + index), Lanes::Set(outer.Max.Z));
+        });
+    }
+
+    void AABBBuffer::Overlaps(const AABB& query, std::span<uint64> outMask) const
+    {
+        if (outMask.size() < GetMaskWordCount()) throw std::out_of_range("Output mask is smaller than the box buffer.");
+
+        Simd::WriteBitMask(Size(), outMask.data(), [this, &query]<typename Lanes>(Lanes, size_t index)
+        {
+            return
+                Simd::LessEqual(Lanes::Load(_minX.data() + index), Lanes::Set(query.Max.X)) & Simd::GreaterEqual(Lanes::Load(_maxX.data() + index), Lanes::Set(query.Min.X)) &
+                Simd::LessEqual(Lanes::Load(_minY.data() + index), Lanes::Set(query.Max.Y)) & Simd::GreaterEqual(Lanes::Load(_maxY.data() + index), Lanes::Set(query.Min.Y)) &
+                Simd::LessEqual(Lanes::Load(_minZ.data() + index), Lanes::Set(query.Max.Z)) & Simd::GreaterEqual(Lanes::Load(_maxZ.data() + index), Lanes::Set(query.Min.Z));
+        });
+    }
+
+    void AABBBuffer::TransformBy(const Mat4x4& matrix, AABBBuffer& out) const
+    {
+        const size_t count = Size();
+        out.Resize(count);
+
+        auto broadcast = [&matrix]<typename Lanes>(Lanes, int element) { return Lanes::Set(matrix.Values[element]); };
+        Simd::ForEachLane(count, [&]<typename Lanes>(Lanes, size_t index)
+        {
+            TransformBoxes<Lanes>(*this, index, broadcast, out);
+        });
+    }
+
+    void AABBBuffer::TransformBy(std::span<const Mat4x4> matrices, AABBBuffer& out) const
+    {
+        const size_t count = Size();
+        if (matrices.size() < count) throw std::out_of_range("Matrix span is smaller than the box buffer.");
+        out.Resize(count);
+
+        Simd::ForEachLane(count, [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const float* base = matrices[index].Values.data();
+            TransformBoxes<Lanes>(*this, index, [base](Lanes, int element) { return Lanes::Gather(base + element, MatrixStride); }, out);
+        });
+    }
+
+    void AABBBuffer::Merge(const AABBBuffer& lhs, const AABBBuffer& rhs, AABBBuffer& out)
+    {
+        const size_t count = lhs.Size();
+        if (rhs.Size() != count) throw std::out_of_range("Box buffers must be the same size.");
+        out.Resize(count);
+
+        Simd::ForEachLane(count, [&]<typename Lanes>(Lanes, size_t index)
+        {
+            Simd::Min(Lanes::Load(lhs.GetMinX().data() + index), Lanes::Load(rhs.GetMinX().data() + index)).Store(out.GetMinX().data() + index);
+            Simd::Min(Lanes::Load(lhs.GetMinY().data() + index), Lanes::Load(rhs.GetMinY().data() + index)).Store(out.GetMinY().data() + index);
+            Simd::Min(Lanes::Load(lhs.GetMinZ().data() + index), Lanes::Load(rhs.GetMinZ().data() + index)).Store(out.GetMinZ().data() + index);
+            Simd::Max(Lanes::Load(lhs.GetMaxX().data() + index), Lanes::Load(rhs.GetMaxX().data() + index)).Store(out.GetMaxX().data() + index);
+            Simd::Max(Lanes::Load(lhs.GetMaxY().data() + index), Lanes::Load(rhs.GetMaxY().data() + index)).Store(out.GetMaxY().data() + index);
+            Simd::Max(Lanes::Load(lhs.GetMaxZ().data() + index), Lanes::Load(rhs.GetMaxZ().data() + index)).Store(out.GetMaxZ().data() + index);
+        });
+    }
+}
@@ -0,0 +1,89 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/AnimationClip.h"
+
+namespace Tbx
+{
+    /// <summary>
+    /// Returns the index of the key at the given time, inserting a key there first if the track has none.
+    /// </summary>
+    static size_t FindOrInsertKey(AnimationClip::FloatArray& times, std::initializer_list<AnimationClip::FloatArray*> components, float time)
+    {
+        const auto slot = std::lower_bound(times.begin(), times.end(), time);
+        const auto index = static_cast<size_t>(slot - times.begin());
+        if (slot == times.end() || *slot != time)
+        {
+            times.insert(slot, time);
+            for (AnimationClip::FloatArray* component : components)
+            {
+                component->insert(component->begin() + index, 0.0f);
+            }
+        }
+        return index;
+    }
+
+    static void SetKey(AnimationClip::Vector3Track& track, float time, const Vector3& value)
+    {
+        const size_t key = FindOrInsertKey(track.Times, { &track.X, &track.Y, &track.Z }, time);
+        track.X[key] = value.X;
+        track.Y[key] = value.Y;
+        track.Z[key] = value.Z;
+    }
+
+    static void SetKey(AnimationClip::QuaternionTrack& track, float time, const Quaternion& value)
+    {
+        const size_t key = FindOrInsertKey(track.Times, { &track.X, &track.Y, &track.Z, &track.W }, time);
+        track.X[key] = value.X;
+        track.Y[key] = value.Y;
+        track.Z[key] = value.Z;
+        track.W[key] = value.W;
+    }
+
+    AnimationClip::AnimationClip(size_t boneCount)
+        : _positions(boneCount)
+        , _rotations(boneCount)
+        , _scales(boneCount)
+    {
+    }
+
+    void AnimationClip::AddPositionKey(size_t bone, float time, const Vector3& position)
+    {
+        if (bone >= GetBoneCount()) throw std::out_of_range("Bone index is out of range.");
+
+        SetKey(_positions[bone], time, position);
+        _duration = std::max(_duration, time);
+    }
+
+    void AnimationClip::AddRotationKey(size_t bone, float time, const Quaternion& rotation)
+    {
+        if (bone >= GetBoneCount()) throw std::out_of_range("Bone index is out of range.");
+
+        SetKey(_rotations[bone], time, rotation);
+        _duration = std::max(_duration, time);
+    }
+
+    void AnimationClip::AddScaleKey(size_t bone, float time, const Vector3& scale)
+    {
+        if (bone >= GetBoneCount()) throw std::out_of_range("Bone index is out of range.");
+
+        SetKey(_scales[bone], time, scale);
+        _duration = std::max(_duration, time);
+    }
+
+    const AnimationClip::Vector3Track& AnimationClip::GetPositionTrack(size_t bone) const
+    {
+        if (bone >= GetBoneCount()) throw std::out_of_range("Bone index is out of range.");
+        return _positions[bone];
+    }
+
+    const AnimationClip::QuaternionTrack& AnimationClip::GetRotationTrack(size_t bone) const
+    {
+        if (bone >= GetBoneCount()) throw std::out_of_range("Bone index is out of range.");
+        return _rotations[bone];
+    }
+
+    const AnimationClip::Vector3Track& AnimationClip::GetScaleTrack(size_t bone) const
+    {
+        if (bone >= GetBoneCount()) throw std::out_of_range("Bone index is out of range.");
+        return _scales[bone];
+    }
+}
@@ -0,0 +1,157 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/AnimationSampler.h"
+
+namespace Tbx
+{
+    /// <summary>
+    /// How many keys a cursor steps forward before the sample counts as a seek and uses a binary search instead.
+    /// </summary>
+    static constexpr size_t MaxCursorSteps = 4;
+
+    /// <summary>
+    /// Moves the cursor to the last key at or before time (or the first key) and returns the blend weight towards the key after it.
+    /// </summary>
+    static float SeekKey(const AnimationClip::FloatArray& times, float time, uint32& cursor)
+    {
+        const size_t count = times.size();
+        size_t key = cursor;
+        if (key >= count || time < times[key])
+        {
+            const auto next = std::upper_bound(times.begin(), times.end(), time);
+            key = next == times.begin() ? 0 : static_cast<size_t>(next - times.begin()) - 1;
+        }
+        else
+        {
+            size_t steps = 0;
+            while (key + 1 < count && times[key + 1] <= time)
+            {
+                if (++steps > MaxCursorSteps)
+                {
+                    key = static_cast<size_t>(std::upper_bound(times.begin() + key + 1, times.end(), time) - times.begin()) - 1;
+                    break;
+                }
+                key++;
+            }
+        }
+        cursor = static_cast<uint32>(key);
+
+        if (key + 1 >= count || time <= times[key]) return 0.0f;
+        return (time - times[key]) / (times[key + 1] - times[key]);
+    }
+
+    static Vector3 SampleTrack(const AnimationClip::Vector3Track& track, float time, uint32& cursor)
+    {
+        const float weight = SeekKey(track.Times, time, cursor);
+        const size_t next = std::min<size_t>(cursor + 1, track.Size() - 1);
+        return
+        {
+            track.X[cursor] + (track.X[next] - track.X[cursor]) * weight,
+            track.Y[cursor] + (track.Y[next] - track.Y[cursor]) * weight,
+            track.Z[cursor] + (track.Z[next] - track.Z[cursor]) * weight
+        };
+    }
+
+    AnimationSampler::AnimationSampler(const AnimationClip& clip)
+        : _clip(&clip)
+    {
+        const size_t boneCount = clip.GetBoneCount();
+        _positionCursors.resize(boneCount);
+        _rotationCursors.resize(boneCount);
+        _scaleCursors.resize(boneCount);
+        _positions.resize(boneCount);
+        _scales.resize(boneCount);
+        _rotationBones.resize(boneCount);
+        _rotationFrom.resize(boneCount);
+        _rotationTo.resize(boneCount);
+        _rotationWeights.resize(boneCount);
+        _rotations.resize(boneCount);
+    }
+
+    void AnimationSampler::Reset()
+    {
+        std::fill(_positionCursors.begin(), _positionCursors.end(), 0u);
+        std::fill(_rotationCursors.begin(), _rotationCursors.end(), 0u);
+        std::fill(_scaleCursors.begin(), _scaleCursors.end(), 0u);
+    }
+
+    void AnimationSampler::Evaluate(float time)
+    {
+        const size_t boneCount = _clip->GetBoneCount();
+        _rotationCount = 0;
+        for (size_t bone = 0; bone < boneCount; bone++)
+        {
+            const auto& positions = _clip->GetPositionTrack(bone);
+            if (positions.Size() != 0)
+            {
+                _positions[bone] = SampleTrack(positions, time, _positionCursors[bone]);
+            }
+
+            const auto& scales = _clip->GetScaleTrack(bone);
+            if (scales.Size() != 0)
+            {
+                _scales[bone] = SampleTrack(scales, time, _scaleCursors[bone]);
+            }
+
+            const auto& rotations = _clip->GetRotationTrack(bone);
+            if (rotations.Size() != 0)
+            {
+                uint32& cursor = _rotationCursors[bone];
+                const float weight = SeekKey(rotations.Times, time, cursor);
+                _rotationBones[_rotationCount] = static_cast<uint32>(bone);
+                _rotationFrom[_rotationCount] = rotations.Get(cursor);
+                _rotationTo[_rotationCount] = rotations.Get(std::min<size_t>(cursor + 1, rotations.Size() - 1));
+                _rotationWeights[_rotationCount] = weight;
+                _rotationCount++;
+            }
+        }
+
+        Quaternion::FastSlerpBatch(
+            std::span(_rotationFrom).first(_rotationCount),
+            std::span(_rotationTo).first(_rotationCount),
+            std::span(_rotationWeights).first(_rotationCount),
+            std::span(_rotations).first(_rotationCount));
+    }
+
+    void AnimationSampler::Sample(float time, std::span<Transform> outPose)
+    {
+        const size_t boneCount = _clip->GetBoneCount();
+        if (outPose.size() < boneCount) throw std::out_of_range("Pose has fewer transforms than the clip has bones.");
+
+        Evaluate(time);
+        for (size_t bone = 0; bone < boneCount; bone++)
+        {
+            if (_clip->GetPositionTrack(bone).Size() != 0) outPose[bone].Position = _positions[bone];
+            if (_clip->GetScaleTrack(bone).Size() != 0) outPose[bone].Scale = _scales[bone];
+        }
+        for (size_t i = 0; i < _rotationCount; i++)
+        {
+            outPose[_rotationBones[i]].Rotation = _rotations[i];
+        }
+    }
+
+    void AnimationSampler::Sample(float time, TransformBuffer& outPose)
+    {
+        const size_t boneCount = _clip->GetBoneCount();
+        if (outPose.Size() < boneCount) throw std::out_of_range("Pose has fewer transforms than the clip has bones.");
+
+        Evaluate(time);
+
+        // Each bone is written with one Set, which checks its index once, instead of a checked setter per component.
+        // Evaluate gathers the rotations in bone order, so they are walked alongside the bones.
+        size_t rotation = 0;
+        for (size_t bone = 0; bone < boneCount; bone++)
+        {
+            const bool hasPosition = _clip->GetPositionTrack(bone).Size() != 0;
+            const bool hasScale = _clip->GetScaleTrack(bone).Size() != 0;
+            const bool hasRotation = rotation < _rotationCount && _rotationBones[rotation] == bone;
+            if (!hasPosition && !hasScale && !hasRotation) continue;
+
+            // Only bones missing a track need the current transform, to leave that component unchanged
+            Transform transform = hasPosition && hasScale && hasRotation ? Transform() : outPose.Get(bone);
+            if (hasPosition) transform.Position = _positions[bone];
+            if (hasScale) transform.Scale = _scales[bone];
+            if (hasRotation) transform.Rotation = _rotations[rotation++];
+            outPose.Set(bone, transform);
+        }
+    }
+}
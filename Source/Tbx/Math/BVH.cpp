@@ -0,0 +1,446 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/BVH.h"
+#include <numeric>
+
+namespace Tbx
+{
+    static_assert(sizeof(BVH::Node) == 32, "BVH nodes are expected to be 32 bytes so a pair of children fills one cache line.");
+
+    /// <summary>
+    /// The number of buckets primitive centroids are sorted into along each axis when looking for the cheapest split.
+    /// </summary>
+    static constexpr uint32 BinCount = 16;
+
+    /// <summary>
+    /// Traversal keeps pending nodes on a fixed stack when the tree is shallow enough, otherwise it falls back to the heap.
+    /// </summary>
+    static constexpr uint32 TraversalStackSize = 64;
+
+    /// <summary>
+    /// Returns true if the box has min above max on any axis, like AABB::IsEmpty. Nodes and primitives store their bounds as two corners.
+    /// </summary>
+    static bool IsEmpty(const Vector3& min, const Vector3& max)
+    {
+        return min.X > max.X || min.Y > max.Y || min.Z > max.Z;
+    }
+
+    /// <summary>
+    /// Returns half the surface area of the box, which is all the surface area heuristic needs to compare splits.
+    /// </summary>
+    static float GetHalfArea(const Vector3& min, const Vector3& max)
+    {
+        if (IsEmpty(min, max)) return 0.0f;
+
+        const float x = max.X - min.X;
+        const float y = max.Y - min.Y;
+        const float z = max.Z - min.Z;
+        return x * y + y * z + z * x;
+    }
+
+    static float GetAxis(const Vector3& vector, int axis)
+    {
+        return axis == 0 ? vector.X : axis == 1 ? vector.Y : vector.Z;
+    }
+
+    /// <summary>
+    /// Narrows [entry, exit] to where the ray is between the two planes of one slab, given the distances t1 and t2 to those planes.
+    /// A ray parallel to the slab that lies exactly in one of its planes gives 0 * inf = NaN for that plane.
+    /// Such a ray stays on the face for its whole length, so like a ray between the planes the slab doesn't narrow it.
+    /// </summary>
+    static void ClipToSlab(float t1, float t2, float& entry, float& exit)
+    {
+        if (std::isnan(t1) || std::isnan(t2)) return;
+
+        entry = std::max(entry, std::min(t1, t2));
+        exit = std::min(exit, std::max(t1, t2));
+    }
+
+    /// <summary>
+    /// Returns the distance along the ray to where it enters the box, or infinity if it misses the box or enters it beyond maxDistance.
+    /// Empty boxes are never hit.
+    /// </summary>
+    static float IntersectRay(const Vector3& min, const Vector3& max, const Vector3& origin, const Vector3& inverseDirection, float maxDistance)
+    {
+        // The slabs of an empty box are inside out and would give an entry of 0 and an exit of infinity
+        if (IsEmpty(min, max)) return std::numeric_limits<float>::infinity();
+
+        float entry = 0.0f;
+        float exit = std::numeric_limits<float>::infinity();
+        ClipToSlab((min.X - origin.X) * inverseDirection.X, (max.X - origin.X) * inverseDirection.X, entry, exit);
+        ClipToSlab((min.Y - origin.Y) * inverseDirection.Y, (max.Y - origin.Y) * inverseDirection.Y, entry, exit);
+        ClipToSlab((min.Z - origin.Z) * inverseDirection.Z, (max.Z - origin.Z) * inverseDirection.Z, entry, exit);
+        return exit >= entry && entry <= maxDistance ? entry : std::numeric_limits<float>::infinity();
+    }
+
+    static bool OverlapsSphere(const Vector3& min, const Vector3& max, const Vector3& center, float radius)
+    {
+        // std::clamp needs min <= max, and an empty box overlaps nothing
+        if (IsEmpty(min, max)) return false;
+
+        // Distance from the center to the closest point of the box
+        const float x = center.X - std::clamp(center.X, min.X, max.X);
+        const float y = center.Y - std::clamp(center.Y, min.Y, max.Y);
+        const float z = center.Z - std::clamp(center.Z, min.Z, max.Z);
+        return x * x + y * y + z * z <= radius * radius;
+    }
+
+    static bool OverlapsBox(const Vector3& min, const Vector3& max, const AABB& box)
+    {
+        // AABB::Overlaps only compares opposite corners, which a box empty along a single axis can still pass
+        return !IsEmpty(min, max) && AABB::Overlaps(AABB(min, max), box);
+    }
+
+    /// <summary>
+    /// Visits every primitive in every node the test accepts, depth first.
+    /// </summary>
+    template <typename Test, typename Visit>
+    static void Traverse(std::span<const BVH::Node> nodes, std::span<const uint32> primitiveIndices, uint32 depth, Test&& test, Visit&& visit)
+    {
+        if (nodes.empty() || !test(nodes[0].Min, nodes[0].Max)) return;
+
+        uint32 stackBuffer[TraversalStackSize];
+        std::vector<uint32> heapStack;
+        uint32* stack = stackBuffer;
+        if (depth >= TraversalStackSize)
+        {
+            heapStack.resize(depth + 1);
+            stack = heapStack.data();
+        }
+
+        uint32 stackSize = 0;
+        uint32 index = 0;
+        while (true)
+        {
+            const BVH::Node& node = nodes[index];
+            if (node.IsLeaf())
+            {
+                for (uint32 i = node.First; i < node.First + node.Count; i++)
+                {
+                    visit(primitiveIndices[i]);
+                }
+            }
+            else
+            {
+                const bool hitFirst = test(nodes[node.First].Min, nodes[node.First].Max);
+                const bool hitSecond = test(nodes[node.First + 1].Min, nodes[node.First + 1].Max);
+                if (hitFirst && hitSecond)
+                {
+                    stack[stackSize++] = node.First + 1;
+                    index = node.First;
+                    continue;
+                }
+                if (hitFirst || hitSecond)
+                {
+                    index = hitFirst ? node.First : node.First + 1;
+                    continue;
+                }
+            }
+
+            if (stackSize == 0) break;
+            index = stack[--stackSize];
+        }
+    }
+
+    BVH::BVH(std::span<const AABB> primitives)
+    {
+        Build(primitives);
+    }
+
+    void BVH::Build(std::span<const AABB> primitives)
+    {
+        const auto count = static_cast<uint32>(primitives.size());
+        _primitiveBounds.assign(primitives.begin(), primitives.end());
+        _primitiveIndices.resize(count);
+        std::iota(_primitiveIndices.begin(), _primitiveIndices.end(), 0u);
+        _leafOfPrimitive.assign(count, 0);
+        _nodes.clear();
+        _parents.clear();
+        _depth = 0;
+        if (count == 0) return;
+
+        // The center of an empty box is NaN, so empty primitives are left out of the centroid bounds and always go to the first bin.
+        // They still get a leaf, so a later Refit can give them real bounds.
+        std::vector<Vector3> centroids(count);
+        std::vector<uint8_t> empty(count);
+        for (uint32 i = 0; i < count; i++)
+        {
+            empty[i] = primitives[i].IsEmpty();
+            centroids[i] = empty[i] ? Vector3() : primitives[i].GetCenter();
+        }
+        const auto getBin = [&](uint32 primitive, int axis, float axisMin, float scale)
+        {
+            if (empty[primitive]) return 0u;
+            return std::min(BinCount - 1, static_cast<uint32>((GetAxis(centroids[primitive], axis) - axisMin) * scale));
+        };
+
+        // A binary tree with one primitive per leaf has 2n - 1 nodes, plus the unused node 1
+        _nodes.resize(2 * static_cast<size_t>(count));
+        _parents.assign(_nodes.size(), NoParent);
+        _nodes[0].First = 0;
+        _nodes[0].Count = count;
+        UpdateNodeBounds(0);
+        uint32 nodesUsed = 2;
+
+        std::vector<std::pair<uint32, uint32>> pending = { { 0u, 0u } };
+        while (!pending.empty())
+        {
+            const auto [index, depth] = pending.back();
+            pending.pop_back();
+            _depth = std::max(_depth, depth);
+
+            Node& node = _nodes[index];
+            if (node.Count <= MaxLeafSize) continue;
+
+            Vector3 centroidMin = std::numeric_limits<float>::infinity();
+            Vector3 centroidMax = -std::numeric_limits<float>::infinity();
+            for (uint32 i = node.First; i < node.First + node.Count; i++)
+            {
+                if (empty[_primitiveIndices[i]]) continue;
+
+                const Vector3& centroid = centroids[_primitiveIndices[i]];
+                centroidMin = { std::min(centroidMin.X, centroid.X), std::min(centroidMin.Y, centroid.Y), std::min(centroidMin.Z, centroid.Z) };
+                centroidMax = { std::max(centroidMax.X, centroid.X), std::max(centroidMax.Y, centroid.Y), std::max(centroidMax.Z, centroid.Z) };
+            }
+
+            // Find the cheapest split plane between bins on any axis
+            int bestAxis = -1;
+            uint32 bestSplit = 0;
+            float bestCost = static_cast<float>(node.Count) * GetHalfArea(node.Min, node.Max);
+            for (int axis = 0; axis < 3; axis++)
+            {
+                const float axisMin = GetAxis(centroidMin, axis);
+                const float extent = GetAxis(centroidMax, axis) - axisMin;
+
+                // Also skips NaN, and nodes with fewer than two non empty primitives where the extent is -inf
+                if (!(extent > 0.0f)) continue;
+
+                AABB binBounds[BinCount];
+                uint32 binCounts[BinCount] = {};
+                const float scale = static_cast<float>(BinCount) / extent;
+                for (uint32 i = node.First; i < node.First + node.Count; i++)
+                {
+                    const uint32 primitive = _primitiveIndices[i];
+                    const uint32 bin = getBin(primitive, axis, axisMin, scale);
+                    binCounts[bin]++;
+                    binBounds[bin] = AABB::Merge(binBounds[bin], _primitiveBounds[primitive]);
+                }
+
+                // Sweep from both ends so every split is evaluated in one pass
+                float leftAreas[BinCount - 1];
+                uint32 leftCounts[BinCount - 1];
+                AABB left;
+                uint32 leftCount = 0;
+                for (uint32 bin = 0; bin < BinCount - 1; bin++)
+                {
+                    left = AABB::Merge(left, binBounds[bin]);
+                    leftCount += binCounts[bin];
+                    leftAreas[bin] = GetHalfArea(left.Min, left.Max);
+                    leftCounts[bin] = leftCount;
+                }
+
+                AABB right;
+                uint32 rightCount = 0;
+                for (uint32 bin = BinCount - 1; bin > 0; bin--)
+                {
+                    right = AABB::Merge(right, binBounds[bin]);
+                    rightCount += binCounts[bin];
+                    const float cost = static_cast<float>(leftCounts[bin - 1]) * leftAreas[bin - 1] + static_cast<float>(rightCount) * GetHalfArea(right.Min, right.Max);
+                    if (leftCounts[bin - 1] != 0 && rightCount != 0 && cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = bin;
+                    }
+                }
+            }
+
+            if (bestAxis < 0) continue;
+
+            // Primitives in bins below the split go left, the rest go right
+            const float axisMin = GetAxis(centroidMin, bestAxis);
+            const float scale = static_cast<float>(BinCount) / (GetAxis(centroidMax, bestAxis) - axisMin);
+            const auto begin = _primitiveIndices.begin() + node.First;
+            const auto middle = std::partition(begin, begin + node.Count, [&](uint32 primitive)
+            {
+                return getBin(primitive, bestAxis, axisMin, scale) < bestSplit;
+            });
+            const auto leftCount = static_cast<uint32>(middle - begin);
+
+            const uint32 leftIndex = nodesUsed;
+            nodesUsed += 2;
+            _nodes[leftIndex].First = node.First;
+            _nodes[leftIndex].Count = leftCount;
+            _nodes[leftIndex + 1].First = node.First + leftCount;
+            _nodes[leftIndex + 1].Count = node.Count - leftCount;
+            _parents[leftIndex] = index;
+            _parents[leftIndex + 1] = index;
+            UpdateNodeBounds(leftIndex);
+            UpdateNodeBounds(leftIndex + 1);
+            node.First = leftIndex;
+            node.Count = 0;
+
+            pending.push_back({ leftIndex + 1, depth + 1 });
+            pending.push_back({ leftIndex, depth + 1 });
+        }
+
+        _nodes.resize(nodesUsed);
+        _parents.resize(nodesUsed);
+        for (uint32 index = 0; index < nodesUsed; index++)
+        {
+            const Node& node = _nodes[index];
+            for (uint32 i = node.First; i < node.First + node.Count; i++)
+            {
+                _leafOfPrimitive[_primitiveIndices[i]] = index;
+            }
+        }
+    }
+
+    void BVH::Refit(std::span<const AABB> primitives)
+    {
+        if (primitives.size() != _primitiveBounds.size()) throw std::out_of_range("Primitive span must match the primitive count of the hierarchy.");
+
+        std::copy(primitives.begin(), primitives.end(), _primitiveBounds.begin());
+
+        // Children are always stored after their parent, so walking backwards updates every child before its parent
+        for (size_t index = _nodes.size(); index-- > 2;)
+        {
+            UpdateNodeBounds(static_cast<uint32>(index));
+        }
+        if (!_nodes.empty()) UpdateNodeBounds(0);
+    }
+
+    void BVH::Refit(uint32 primitive, const AABB& bounds)
+    {
+        if (primitive >= _primitiveBounds.size()) throw std::out_of_range("Primitive index is out of range.");
+
+        _primitiveBounds[primitive] = bounds;
+        for (uint32 index = _leafOfPrimitive[primitive]; index != NoParent; index = _parents[index])
+        {
+            const Node previous = _nodes[index];
+            UpdateNodeBounds(index);
+
+            const Node& node = _nodes[index];
+            if (node.Min.X == previous.Min.X && node.Min.Y == previous.Min.Y && node.Min.Z == previous.Min.Z &&
+                node.Max.X == previous.Max.X && node.Max.Y == previous.Max.Y && node.Max.Z == previous.Max.Z) break;
+        }
+    }
+
+    bool BVH::RayCast(const Vector3& origin, const Vector3& direction, float maxDistance, RayHit& outHit) const
+    {
+        if (_nodes.empty()) return false;
+
+        const Vector3 inverseDirection(1.0f / direction.X, 1.0f / direction.Y, 1.0f / direction.Z);
+        const float infinity = std::numeric_limits<float>::infinity();
+
+        float closest = maxDistance;
+        bool hit = false;
+        if (IntersectRay(_nodes[0].Min, _nodes[0].Max, origin, inverseDirection, closest) == infinity) return false;
+
+        // Pending nodes are stored with their entry distance so they can be skipped once something closer has been hit
+        std::pair<uint32, float> stackBuffer[TraversalStackSize];
+        std::vector<std::pair<uint32, float>> heapStack;
+        std::pair<uint32, float>* stack = stackBuffer;
+        if (_depth >= TraversalStackSize)
+        {
+            heapStack.resize(_depth + 1);
+            stack = heapStack.data();
+        }
+
+        uint32 stackSize = 0;
+        uint32 index = 0;
+        while (true)
+        {
+            const Node& node = _nodes[index];
+            if (node.IsLeaf())
+            {
+                for (uint32 i = node.First; i < node.First + node.Count; i++)
+                {
+                    const uint32 primitive = _primitiveIndices[i];
+                    const AABB& bounds = _primitiveBounds[primitive];
+                    const float distance = IntersectRay(bounds.Min, bounds.Max, origin, inverseDirection, closest);
+                    if (distance != infinity && (!hit || distance < closest))
+                    {
+                        closest = distance;
+                        outHit = { primitive, distance };
+                        hit = true;
+                    }
+                }
+            }
+            else
+            {
+                // Visit the nearer child first, it is the most likely to shorten the ray
+                uint32 nearChild = node.First;
+                uint32 farChild = node.First + 1;
+                float nearDistance = IntersectRay(_nodes[nearChild].Min, _nodes[nearChild].Max, origin, inverseDirection, closest);
+                float farDistance = IntersectRay(_nodes[farChild].Min, _nodes[farChild].Max, origin, inverseDirection, closest);
+                if (farDistance < nearDistance)
+                {
+                    std::swap(nearChild, farChild);
+                    std::swap(nearDistance, farDistance);
+                }
+
+                if (nearDistance != infinity)
+                {
+                    if (farDistance != infinity) stack[stackSize++] = { farChild, farDistance };
+                    index = nearChild;
+                    continue;
+                }
+            }
+
+            bool found = false;
+            while (stackSize > 0 && !found)
+            {
+                const auto [pendingIndex, pendingDistance] = stack[--stackSize];
+                if (pendingDistance <= closest)
+                {
+                    index = pendingIndex;
+                    found = true;
+                }
+            }
+            if (!found) break;
+        }
+
+        return hit;
+    }
+
+    void BVH::QuerySphere(const Vector3& center, float radius, std::vector<uint32>& outPrimitives) const
+    {
+        Traverse(_nodes, _primitiveIndices, _depth,
+            [&](const Vector3& min, const Vector3& max) { return OverlapsSphere(min, max, center, radius); },
+            [&](uint32 primitive)
+            {
+                const AABB& bounds = _primitiveBounds[primitive];
+                if (OverlapsSphere(bounds.Min, bounds.Max, center, radius)) outPrimitives.push_back(primitive);
+            });
+    }
+
+    void BVH::QueryAABB(const AABB& box, std::vector<uint32>& outPrimitives) const
+    {
+        Traverse(_nodes, _primitiveIndices, _depth,
+            [&](const Vector3& min, const Vector3& max) { return OverlapsBox(min, max, box); },
+            [&](uint32 primitive)
+            {
+                const AABB& bounds = _primitiveBounds[primitive];
+                if (OverlapsBox(bounds.Min, bounds.Max, box)) outPrimitives.push_back(primitive);
+            });
+    }
+
+    void BVH::UpdateNodeBounds(uint32 index)
+    {
+        Node& node = _nodes[index];
+        AABB bounds;
+        if (node.IsLeaf())
+        {
+            for (uint32 i = node.First; i < node.First + node.Count; i++)
+            {
+                bounds = AABB::Merge(bounds, _primitiveBounds[_primitiveIndices[i]]);
+            }
+        }
+        else
+        {
+            bounds = AABB::Merge(AABB(_nodes[node.First].Min, _nodes[node.First].Max), AABB(_nodes[node.First + 1].Min, _nodes[node.First + 1].Max));
+        }
+        node.Min = bounds.Min;
+        node.Max = bounds.Max;
+    }
+}
@@ -6,19 +6,6 @@ namespace Tbx
 {
     std::string Bounds::ToString() const { return std::format("[Left: {}, Right: {}, Top: {}, Bottom: {}]", Left, Right, Top, Bottom); }
 
-    Bounds Bounds::FromOrthographicProjection(float size, float aspect)
-    {
-        float halfWidth = (size * aspect);
-        float halfHeight = size;
-
-        float left = -halfWidth;
-        float right = halfWidth;
-        float top = halfHeight;
-        float bottom = -halfHeight;
-
-        return { left, right, top, bottom };
-    }
-
     Bounds Bounds::FromPerspectiveProjection(float fov, float aspectRatio, float zNear)
     {
         float scale = Math::Tan(fov * 0.5f * zNear);
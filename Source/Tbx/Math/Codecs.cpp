@@ -0,0 +1,361 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/Codecs.h"
+#include "Tbx/Math/SimdLanes.h"
+
+namespace Tbx
+{
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Gathering components assumes tightly packed quaternions.");
+    static_assert(sizeof(PackedQuaternion48) == 6, "PackedQuaternion48 must stay 6 bytes.");
+
+    static constexpr float InvSqrt2 = 0.70710678f;
+
+    /// <summary>
+    /// The largest component index and the other three components of Lanes::Width quaternions, quantized to Bits bits each.
+    /// </summary>
+    template <int Bits>
+    struct SmallestThree
+    {
+        static constexpr float MaxValue = float((1 << Bits) - 1);
+
+        static uint64 Pack(int32_t largest, int32_t a, int32_t b, int32_t c)
+        {
+            return uint64(largest) << (Bits * 3) | uint64(a) << (Bits * 2) | uint64(b) << Bits | uint64(c);
+        }
+
+        static void Unpack(uint64 packed, int32_t& largest, int32_t& a, int32_t& b, int32_t& c)
+        {
+            constexpr uint64 mask = (1ull << Bits) - 1;
+            largest = static_cast<int32_t>((packed >> (Bits * 3)) & 3);
+            a = static_cast<int32_t>((packed >> (Bits * 2)) & mask);
+            b = static_cast<int32_t>((packed >> Bits) & mask);
+            c = static_cast<int32_t>(packed & mask);
+        }
+
+        template <typename Lanes>
+        static void Encode(const Quaternion& first, int32_t* largest, int32_t* a, int32_t* b, int32_t* c)
+        {
+            Lanes x, y, z, w;
+            Simd::LoadInterleaved(&first.X, x, y, z, w);
+
+            // Find the component with the largest magnitude, the first one wins ties
+            const Lanes one = Lanes::Set(1.0f);
+            Lanes index = Lanes::Set(0.0f);
+            Lanes best = Simd::Abs(x);
+            Lanes bestValue = x;
+            const auto pick = [&](Lanes value, float valueIndex)
+            {
+                const Lanes isLarger = Simd::Greater(Simd::Abs(value), best);
+                index = Simd::Select(isLarger, Lanes::Set(valueIndex), index);
+                best = Simd::Select(isLarger, Simd::Abs(value), best);
+                bestValue = Simd::Select(isLarger, value, bestValue);
+            };
+            pick(y, 1.0f);
+            pick(z, 2.0f);
+            pick(w, 3.0f);
+
+            // Skip the largest component, keeping the order of the others, and flip the sign so the largest is positive
+            const Lanes sign = Simd::Select(Simd::Less(bestValue, Lanes::Set(0.0f)), Lanes::Set(-1.0f), one);
+            const Lanes smallest0 = Simd::Select(Simd::Less(index, one), y, x);
+            const Lanes smallest1 = Simd::Select(Simd::Less(index, Lanes::Set(2.0f)), z, y);
+            const Lanes smallest2 = Simd::Select(Simd::Less(index, Lanes::Set(3.0f)), w, z);
+
+            // Map [-1/sqrt(2), 1/sqrt(2)] to [0, MaxValue]
+            const Lanes scale = sign * Lanes::Set(MaxValue * 0.5f / InvSqrt2);
+            const Lanes offset = Lanes::Set(MaxValue * 0.5f);
+            const Lanes maxValue = Lanes::Set(MaxValue);
+            const auto quantize = [&](Lanes value) { return Simd::Min(Simd::Max(value * scale + offset, Lanes::Set(0.0f)), maxValue); };
+            index.StoreInt(largest);
+            quantize(smallest0).StoreInt(a);
+            quantize(smallest1).StoreInt(b);
+            quantize(smallest2).StoreInt(c);
+        }
+
+        template <typename Lanes>
+        static void Decode(const int32_t* largest, const int32_t* a, const int32_t* b, const int32_t* c, Quaternion& first)
+        {
+            const Lanes scale = Lanes::Set(2.0f * InvSqrt2 / MaxValue);
+            const Lanes offset = Lanes::Set(InvSqrt2);
+            const Lanes smallest0 = Lanes::LoadInt(a) * scale - offset;
+            const Lanes smallest1 = Lanes::LoadInt(b) * scale - offset;
+            const Lanes smallest2 = Lanes::LoadInt(c) * scale - offset;
+            const Lanes index = Lanes::LoadInt(largest);
+
+            const Lanes one = Lanes::Set(1.0f);
+            const Lanes rest = smallest0 * smallest0 + smallest1 * smallest1 + smallest2 * smallest2;
+            const Lanes value = Simd::Sqrt(Simd::Max(one - rest, Lanes::Set(0.0f)));
+
+            // Put the largest component back in its place, the inverse of the selects in Encode
+            const Lanes isFirst = Simd::Less(index, one);
+            const Lanes beforeThird = Simd::Less(index, Lanes::Set(2.0f));
+            const Lanes beforeFourth = Simd::Less(index, Lanes::Set(3.0f));
+            const Lanes x = Simd::Select(isFirst, value, smallest0);
+            const Lanes y = Simd::Select(isFirst, smallest0, Simd::Select(beforeThird, value, smallest1));
+            const Lanes z = Simd::Select(beforeThird, smallest1, Simd::Select(beforeFourth, value, smallest2));
+            const Lanes w = Simd::Select(beforeFourth, smallest2, value);
+            Simd::StoreInterleaved(&first.X, x, y, z, w);
+        }
+    };
+
+    // Conversions between the 64 bit smallest three encoding and each packed type, picked by overload in the batch templates
+    static void ToPacked(uint64 bits, uint32& packed) { packed = static_cast<uint32>(bits); }
+    static void ToPacked(uint64 bits, PackedQuaternion48& packed) { packed = { { uint16(bits), uint16(bits >> 16), uint16(bits >> 32) } }; }
+    static void ToPacked(uint64 bits, uint64& packed) { packed = bits; }
+    static uint64 FromPacked(uint32 packed) { return packed; }
+    static uint64 FromPacked(const PackedQuaternion48& packed) { return uint64(packed.Bits[0]) | uint64(packed.Bits[1]) << 16 | uint64(packed.Bits[2]) << 32; }
+    static uint64 FromPacked(uint64 packed) { return packed; }
+
+    template <int Bits, typename Packed>
+    static void PackQuaternions(std::span<const Quaternion> quaternions, std::span<Packed> out)
+    {
+        if (out.size() < quaternions.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(quaternions.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            int32_t largest[Lanes::Width], a[Lanes::Width], b[Lanes::Width], c[Lanes::Width];
+            SmallestThree<Bits>::template Encode<Lanes>(quaternions[index], largest, a, b, c);
+            for (size_t lane = 0; lane < Lanes::Width; lane++)
+            {
+                ToPacked(SmallestThree<Bits>::Pack(largest[lane], a[lane], b[lane], c[lane]), out[index + lane]);
+            }
+        });
+    }
+
+    template <int Bits, typename Packed>
+    static void UnpackQuaternions(std::span<const Packed> packed, std::span<Quaternion> out)
+    {
+        if (out.size() < packed.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(packed.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            int32_t largest[Lanes::Width], a[Lanes::Width], b[Lanes::Width], c[Lanes::Width];
+            for (size_t lane = 0; lane < Lanes::Width; lane++)
+            {
+                SmallestThree<Bits>::Unpack(FromPacked(packed[index + lane]), largest[lane], a[lane], b[lane], c[lane]);
+            }
+            SmallestThree<Bits>::template Decode<Lanes>(largest, a, b, c, out[index]);
+        });
+    }
+
+    uint32 QuaternionCodec::Pack32(const Quaternion& quaternion)
+    {
+        uint32 result;
+        PackQuaternions<10>(std::span(&quaternion, 1), std::span(&result, 1));
+        return result;
+    }
+
+    Quaternion QuaternionCodec::Unpack32(uint32 packed)
+    {
+        Quaternion result;
+        UnpackQuaternions<10>(std::span<const uint32>(&packed, 1), std::span(&result, 1));
+        return result;
+    }
+
+    PackedQuaternion48 QuaternionCodec::Pack48(const Quaternion& quaternion)
+    {
+        PackedQuaternion48 result;
+        PackQuaternions<15>(std::span(&quaternion, 1), std::span(&result, 1));
+        return result;
+    }
+
+    Quaternion QuaternionCodec::Unpack48(const PackedQuaternion48& packed)
+    {
+        Quaternion result;
+        UnpackQuaternions<15>(std::span(&packed, 1), std::span(&result, 1));
+        return result;
+    }
+
+    uint64 QuaternionCodec::Pack64(const Quaternion& quaternion)
+    {
+        uint64 result;
+        PackQuaternions<20>(std::span(&quaternion, 1), std::span(&result, 1));
+        return result;
+    }
+
+    Quaternion QuaternionCodec::Unpack64(uint64 packed)
+    {
+        Quaternion result;
+        UnpackQuaternions<20>(std::span<const uint64>(&packed, 1), std::span(&result, 1));
+        return result;
+    }
+
+    void QuaternionCodec::Pack32Batch(std::span<const Quaternion> quaternions, std::span<uint32> out)
+    {
+        PackQuaternions<10>(quaternions, out);
+    }
+
+    void QuaternionCodec::Unpack32Batch(std::span<const uint32> packed, std::span<Quaternion> out)
+    {
+        UnpackQuaternions<10>(packed, out);
+    }
+
+    void QuaternionCodec::Pack48Batch(std::span<const Quaternion> quaternions, std::span<PackedQuaternion48> out)
+    {
+        PackQuaternions<15>(quaternions, out);
+    }
+
+    void QuaternionCodec::Unpack48Batch(std::span<const PackedQuaternion48> packed, std::span<Quaternion> out)
+    {
+        UnpackQuaternions<15>(packed, out);
+    }
+
+    void QuaternionCodec::Pack64Batch(std::span<const Quaternion> quaternions, std::span<uint64> out)
+    {
+        PackQuaternions<20>(quaternions, out);
+    }
+
+    void QuaternionCodec::Unpack64Batch(std::span<const uint64> packed, std::span<Quaternion> out)
+    {
+        UnpackQuaternions<20>(packed, out);
+    }
+
+    /// <summary>
+    /// Octahedral encoding of Lanes::Width normals with Bits bits per axis, stored as two's complement signed normalized integers.
+    /// </summary>
+    template <int Bits>
+    struct Octahedral
+    {
+        static constexpr float MaxValue = float((1 << (Bits - 1)) - 1);
+        static constexpr uint32 Mask = (1u << Bits) - 1;
+
+        static uint32 Pack(int32_t u, int32_t v) { return (static_cast<uint32>(u) & Mask) | (static_cast<uint32>(v) & Mask) << Bits; }
+
+        static void Unpack(uint32 packed, int32_t& u, int32_t& v)
+        {
+            // Shift the sign bit of each field into bit 31 so the arithmetic shift back extends it
+            u = static_cast<int32_t>(packed << (32 - Bits)) >> (32 - Bits);
+            v = static_cast<int32_t>((packed >> Bits) << (32 - Bits)) >> (32 - Bits);
+        }
+
+        template <typename Lanes>
+        static Lanes SignNotZero(Lanes value)
+        {
+            return Simd::Select(Simd::Less(value, Lanes::Set(0.0f)), Lanes::Set(-1.0f), Lanes::Set(1.0f));
+        }
+
+        template <typename Lanes>
+        static void Encode(const Vector3& first, int32_t* u, int32_t* v)
+        {
+            const float* in = &first.X;
+            const Lanes x = Lanes::Gather(in, Simd::Vector3Stride);
+            const Lanes y = Lanes::Gather(in + 1, Simd::Vector3Stride);
+            const Lanes z = Lanes::Gather(in + 2, Simd::Vector3Stride);
+
+            // Project onto the octahedron, the max keeps a zero vector from dividing by zero
+            const Lanes one = Lanes::Set(1.0f);
+            const Lanes invLength = one / Simd::Max(Simd::Abs(x) + Simd::Abs(y) + Simd::Abs(z), Lanes::Set(1e-30f));
+            const Lanes projectedX = x * invLength;
+            const Lanes projectedY = y * invLength;
+
+            // Fold the lower half over the diagonals onto the corners of the square
+            const Lanes isLower = Simd::Less(z, Lanes::Set(0.0f));
+            const Lanes foldedX = (one - Simd::Abs(projectedY)) * SignNotZero(projectedX);
+            const Lanes foldedY = (one - Simd::Abs(projectedX)) * SignNotZero(projectedY);
+            const Lanes maxValue = Lanes::Set(MaxValue);
+            (Simd::Select(isLower, foldedX, projectedX) * maxValue).StoreInt(u);
+            (Simd::Select(isLower, foldedY, projectedY) * maxValue).StoreInt(v);
+        }
+
+        template <typename Lanes>
+        static void Decode(const int32_t* u, const int32_t* v, Vector3& first)
+        {
+            // The most negative integer decodes to slightly below -1, so clamp it
+            const Lanes scale = Lanes::Set(1.0f / MaxValue);
+            const Lanes minusOne = Lanes::Set(-1.0f);
+            const Lanes x = Simd::Max(Lanes::LoadInt(u) * scale, minusOne);
+            const Lanes y = Simd::Max(Lanes::LoadInt(v) * scale, minusOne);
+            const Lanes z = Lanes::Set(1.0f) - Simd::Abs(x) - Simd::Abs(y);
+
+            // Unfold the lower half, moving each axis towards zero by how far the point is outside the diamond
+            const Lanes outside = Simd::Max(Lanes::Set(0.0f) - z, Lanes::Set(0.0f));
+            const Lanes zero = Lanes::Set(0.0f);
+            const Lanes unfoldedX = x - Simd::Select(Simd::Less(x, zero), zero - outside, outside);
+            const Lanes unfoldedY = y - Simd::Select(Simd::Less(y, zero), zero - outside, outside);
+
+            const Lanes invLength = Lanes::Set(1.0f) / Simd::Sqrt(unfoldedX * unfoldedX + unfoldedY * unfoldedY + z * z);
+            float* result = &first.X;
+            (unfoldedX * invLength).Scatter(result, Simd::Vector3Stride);
+            (unfoldedY * invLength).Scatter(result + 1, Simd::Vector3Stride);
+            (z * invLength).Scatter(result + 2, Simd::Vector3Stride);
+        }
+    };
+
+    template <int Bits, typename Encoded>
+    static void EncodeNormals(std::span<const Vector3> normals, std::span<Encoded> out)
+    {
+        if (out.size() < normals.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(normals.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            int32_t u[Lanes::Width], v[Lanes::Width];
+            Octahedral<Bits>::template Encode<Lanes>(normals[index], u, v);
+            for (size_t lane = 0; lane < Lanes::Width; lane++)
+            {
+                out[index + lane] = static_cast<Encoded>(Octahedral<Bits>::Pack(u[lane], v[lane]));
+            }
+        });
+    }
+
+    template <int Bits, typename Encoded>
+    static void DecodeNormals(std::span<const Encoded> encoded, std::span<Vector3> out)
+    {
+        if (out.size() < encoded.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(encoded.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            int32_t u[Lanes::Width], v[Lanes::Width];
+            for (size_t lane = 0; lane < Lanes::Width; lane++)
+            {
+                Octahedral<Bits>::Unpack(encoded[index + lane], u[lane], v[lane]);
+            }
+            Octahedral<Bits>::template Decode<Lanes>(u, v, out[index]);
+        });
+    }
+
+    uint16 NormalCodec::Encode16(const Vector3& normal)
+    {
+        uint16 result;
+        EncodeNormals<8>(std::span(&normal, 1), std::span(&result, 1));
+        return result;
+    }
+
+    Vector3 NormalCodec::Decode16(uint16 encoded)
+    {
+        Vector3 result;
+        DecodeNormals<8>(std::span<const uint16>(&encoded, 1), std::span(&result, 1));
+        return result;
+    }
+
+    uint32 NormalCodec::Encode32(const Vector3& normal)
+    {
+        uint32 result;
+        EncodeNormals<16>(std::span(&normal, 1), std::span(&result, 1));
+        return result;
+    }
+
+    Vector3 NormalCodec::Decode32(uint32 encoded)
+    {
+        Vector3 result;
+        DecodeNormals<16>(std::span<const uint32>(&encoded, 1), std::span(&result, 1));
+        return result;
+    }
+
+    void NormalCodec::Encode16Batch(std::span<const Vector3> normals, std::span<uint16> out)
+    {
+        EncodeNormals<8>(normals, out);
+    }
+
+    void NormalCodec::Decode16Batch(std::span<const uint16> encoded, std::span<Vector3> out)
+    {
+        DecodeNormals<8>(encoded, out);
+    }
+
+    void NormalCodec::Encode32Batch(std::span<const Vector3> normals, std::span<uint32> out)
+    {
+        EncodeNormals<16>(normals, out);
+    }
+
+    void NormalCodec::Decode32Batch(std::span<const uint32> encoded, std::span<Vector3> out)
+    {
+        DecodeNormals<16>(encoded, out);
+    }
+}
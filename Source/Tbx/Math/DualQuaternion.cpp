@@ -0,0 +1,282 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/DualQuaternion.h"
+#include "Tbx/Math/SimdLanes.h"
+
+#ifndef TBX_MATH_INLINE
+    #include "Tbx/Math/DualQuaternion.inl"
+#endif
+
+namespace Tbx
+{
+    static constexpr size_t DualQuaternionStride = sizeof(DualQuaternion) / sizeof(float);
+    static constexpr size_t TransformStride = sizeof(Transform) / sizeof(float);
+    static constexpr size_t MatrixStride = sizeof(Mat4x4) / sizeof(float);
+    static_assert(DualQuaternionStride == 8 && MatrixStride == 16, "Gathering components assumes tightly packed dual quaternions and matrices.");
+    static_assert(sizeof(Transform) % sizeof(float) == 0, "Gathering transform components assumes a whole number of floats per transform.");
+
+    /// <summary>
+    /// One quaternion component per lane type, Lanes::Width quaternions at once.
+    /// </summary>
+    template <typename Lanes>
+    struct QuaternionLanes
+    {
+        Lanes X;
+        Lanes Y;
+        Lanes Z;
+        Lanes W;
+    };
+
+    template <typename Lanes>
+    static QuaternionLanes<Lanes> LoadLanes(const Quaternion& first)
+    {
+        QuaternionLanes<Lanes> result;
+        Simd::LoadInterleaved(&first.X, result.X, result.Y, result.Z, result.W, DualQuaternionStride);
+        return result;
+    }
+
+    template <typename Lanes>
+    static void StoreLanes(Quaternion& first, const QuaternionLanes<Lanes>& value)
+    {
+        Simd::StoreInterleaved(&first.X, value.X, value.Y, value.Z, value.W, DualQuaternionStride);
+    }
+
+    template <typename Lanes>
+    static QuaternionLanes<Lanes> MultiplyLanes(const QuaternionLanes<Lanes>& lhs, const QuaternionLanes<Lanes>& rhs)
+    {
+        return
+        {
+            lhs.W * rhs.X + lhs.X * rhs.W + lhs.Y * rhs.Z - lhs.Z * rhs.Y,
+            lhs.W * rhs.Y + lhs.Y * rhs.W + lhs.Z * rhs.X - lhs.X * rhs.Z,
+            lhs.W * rhs.Z + lhs.Z * rhs.W + lhs.X * rhs.Y - lhs.Y * rhs.X,
+            lhs.W * rhs.W - lhs.X * rhs.X - lhs.Y * rhs.Y - lhs.Z * rhs.Z
+        };
+    }
+
+    /// <summary>
+    /// Converts a rotation matrix to a quaternion, branching on the largest diagonal term to stay accurate near 180 degrees.
+    /// </summary>
+    static Quaternion RotationFromBasis(const Vector3& right, const Vector3& up, const Vector3& forward)
+    {
+        // The basis vectors are the columns, so mRC is row R of column C
+        const float m00 = right.X, m10 = right.Y, m20 = right.Z;
+        const float m01 = up.X, m11 = up.Y, m21 = up.Z;
+        const float m02 = forward.X, m12 = forward.Y, m22 = forward.Z;
+
+        const float trace = m00 + m11 + m22;
+        if (trace > 0.0f)
+        {
+            const float s = 0.5f / std::sqrt(trace + 1.0f);
+            return { (m21 - m12) * s, (m02 - m20) * s, (m10 - m01) * s, 0.25f / s };
+        }
+        if (m00 > m11 && m00 > m22)
+        {
+            const float s = 2.0f * std::sqrt(1.0f + m00 - m11 - m22);
+            return { 0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s };
+        }
+        if (m11 > m22)
+        {
+            const float s = 2.0f * std::sqrt(1.0f + m11 - m00 - m22);
+            return { (m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s };
+        }
+        const float s = 2.0f * std::sqrt(1.0f + m22 - m00 - m11);
+        return { (m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s };
+    }
+
+    DualQuaternion DualQuaternion::FromTransform(const Transform& transform)
+    {
+        return FromRotationTranslation(transform.Rotation, transform.Position);
+    }
+
+    DualQuaternion DualQuaternion::FromMat4x4(const Mat4x4& matrix)
+    {
+        const Vector3 right = Vector3::Normalize({ matrix[0], matrix[1], matrix[2] });
+        const Vector3 up = Vector3::Normalize({ matrix[4], matrix[5], matrix[6] });
+        const Vector3 forward = Vector3::Normalize({ matrix[8], matrix[9], matrix[10] });
+        const Quaternion rotation = Quaternion::Normalize(RotationFromBasis(right, up, forward));
+        return FromRotationTranslation(rotation, { matrix[12], matrix[13], matrix[14] });
+    }
+
+    Transform DualQuaternion::ToTransform(const DualQuaternion& dualQuaternion)
+    {
+        return { GetTranslation(dualQuaternion), dualQuaternion.Real, Vector3(1.0f) };
+    }
+
+    Mat4x4 DualQuaternion::ToMat4x4(const DualQuaternion& dualQuaternion)
+    {
+        return Mat4x4::FromTRS(GetTranslation(dualQuaternion), dualQuaternion.Real, Vector3(1.0f));
+    }
+
+    DualQuaternion DualQuaternion::Blend(std::span<const DualQuaternion> dualQuaternions, std::span<const float> weights)
+    {
+        if (weights.size() < dualQuaternions.size()) throw std::out_of_range("Weights span is smaller than the dual quaternion span.");
+
+        if (dualQuaternions.empty()) return {};
+
+        const Quaternion& pivot = dualQuaternions[0].Real;
+        DualQuaternion sum = { { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+        for (size_t i = 0; i < dualQuaternions.size(); i++)
+        {
+            const DualQuaternion& dualQuaternion = dualQuaternions[i];
+            const float weight = Quaternion::Dot(pivot, dualQuaternion.Real) < 0.0f ? -weights[i] : weights[i];
+            sum.Real = Quaternion::Add(sum.Real, { dualQuaternion.Real.X * weight, dualQuaternion.Real.Y * weight, dualQuaternion.Real.Z * weight, dualQuaternion.Real.W * weight });
+            sum.Dual = Quaternion::Add(sum.Dual, { dualQuaternion.Dual.X * weight, dualQuaternion.Dual.Y * weight, dualQuaternion.Dual.Z * weight, dualQuaternion.Dual.W * weight });
+        }
+        return Normalize(sum);
+    }
+
+    void DualQuaternion::MultiplyBatch(std::span<const DualQuaternion> lhs, std::span<const DualQuaternion> rhs, std::span<DualQuaternion> out)
+    {
+        if (rhs.size() < lhs.size() || out.size() < lhs.size()) throw std::out_of_range("Span is smaller than the lhs span.");
+
+        Simd::ForEachLane(lhs.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const auto lhsReal = LoadLanes<Lanes>(lhs[index].Real);
+            const auto lhsDual = LoadLanes<Lanes>(lhs[index].Dual);
+            const auto rhsReal = LoadLanes<Lanes>(rhs[index].Real);
+            const auto rhsDual = LoadLanes<Lanes>(rhs[index].Dual);
+            const auto realDual = MultiplyLanes(lhsReal, rhsDual);
+            const auto dualReal = MultiplyLanes(lhsDual, rhsReal);
+            StoreLanes(out[index].Real, MultiplyLanes(lhsReal, rhsReal));
+            StoreLanes(out[index].Dual, QuaternionLanes<Lanes>{ realDual.X + dualReal.X, realDual.Y + dualReal.Y, realDual.Z + dualReal.Z, realDual.W + dualReal.W });
+        });
+    }
+
+    void DualQuaternion::BlendBatch(std::span<const DualQuaternion> from, std::span<const DualQuaternion> to, float t, std::span<DualQuaternion> out)
+    {
+        if (to.size() < from.size() || out.size() < from.size()) throw std::out_of_range("Span is smaller than the from span.");
+
+        Simd::ForEachLane(from.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const auto fromReal = LoadLanes<Lanes>(from[index].Real);
+            const auto fromDual = LoadLanes<Lanes>(from[index].Dual);
+            const auto toReal = LoadLanes<Lanes>(to[index].Real);
+            const auto toDual = LoadLanes<Lanes>(to[index].Dual);
+
+            // Flip to onto from's hemisphere so every blend takes the shortest path
+            const Lanes dot = fromReal.X * toReal.X + fromReal.Y * toReal.Y + fromReal.Z * toReal.Z + fromReal.W * toReal.W;
+            const Lanes fromWeight = Lanes::Set(1.0f - t);
+            const Lanes toWeight = Simd::Select(Simd::Less(dot, Lanes::Set(0.0f)), Lanes::Set(-t), Lanes::Set(t));
+            const QuaternionLanes<Lanes> real =
+            {
+                fromReal.X * fromWeight + toReal.X * toWeight,
+                fromReal.Y * fromWeight + toReal.Y * toWeight,
+                fromReal.Z * fromWeight + toReal.Z * toWeight,
+                fromReal.W * fromWeight + toReal.W * toWeight
+            };
+            const QuaternionLanes<Lanes> dual =
+            {
+                fromDual.X * fromWeight + toDual.X * toWeight,
+                fromDual.Y * fromWeight + toDual.Y * toWeight,
+                fromDual.Z * fromWeight + toDual.Z * toWeight,
+                fromDual.W * fromWeight + toDual.W * toWeight
+            };
+
+            // Same normalization as Normalize, the flipped sum of two unit rotations never has zero length
+            const Lanes invLength = Lanes::Set(1.0f) / Simd::Sqrt(real.X * real.X + real.Y * real.Y + real.Z * real.Z + real.W * real.W);
+            const QuaternionLanes<Lanes> unitReal = { real.X * invLength, real.Y * invLength, real.Z * invLength, real.W * invLength };
+            const QuaternionLanes<Lanes> unitDual = { dual.X * invLength, dual.Y * invLength, dual.Z * invLength, dual.W * invLength };
+            const Lanes overlap = unitReal.X * unitDual.X + unitReal.Y * unitDual.Y + unitReal.Z * unitDual.Z + unitReal.W * unitDual.W;
+            StoreLanes(out[index].Real, unitReal);
+            StoreLanes(out[index].Dual, QuaternionLanes<Lanes>
+            {
+                unitDual.X - unitReal.X * overlap,
+                unitDual.Y - unitReal.Y * overlap,
+                unitDual.Z - unitReal.Z * overlap,
+                unitDual.W - unitReal.W * overlap
+            });
+        });
+    }
+
+    void DualQuaternion::TransformPointBatch(const DualQuaternion& dualQuaternion, std::span<const Vector3> points, std::span<Vector3> out)
+    {
+        if (out.size() < points.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        // One rotation for every point, so convert it to a matrix once and pay 9 multiplies per point instead of two cross products
+        const Mat4x4 matrix = ToMat4x4(dualQuaternion);
+        Simd::ForEachLane(points.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const float* in = &points[index].X;
+            const Lanes x = Lanes::Gather(in, Simd::Vector3Stride);
+            const Lanes y = Lanes::Gather(in + 1, Simd::Vector3Stride);
+            const Lanes z = Lanes::Gather(in + 2, Simd::Vector3Stride);
+
+            float* result = &out[index].X;
+            for (int row = 0; row < 3; row++)
+            {
+                const Lanes value = Lanes::Set(matrix[row]) * x + Lanes::Set(matrix[4 + row]) * y + Lanes::Set(matrix[8 + row]) * z + Lanes::Set(matrix[12 + row]);
+                value.Scatter(result + row, Simd::Vector3Stride);
+            }
+        });
+    }
+
+    void DualQuaternion::FromTransformBatch(std::span<const Transform> transforms, std::span<DualQuaternion> out)
+    {
+        if (out.size() < transforms.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(transforms.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const float* position = &transforms[index].Position.X;
+            const float* rotation = &transforms[index].Rotation.X;
+            const Lanes tx = Lanes::Gather(position, TransformStride);
+            const Lanes ty = Lanes::Gather(position + 1, TransformStride);
+            const Lanes tz = Lanes::Gather(position + 2, TransformStride);
+            const QuaternionLanes<Lanes> real =
+            {
+                Lanes::Gather(rotation, TransformStride),
+                Lanes::Gather(rotation + 1, TransformStride),
+                Lanes::Gather(rotation + 2, TransformStride),
+                Lanes::Gather(rotation + 3, TransformStride)
+            };
+
+            // Half of (translation, 0) * rotation, written out because the translation has no W
+            const Lanes half = Lanes::Set(0.5f);
+            StoreLanes(out[index].Real, real);
+            StoreLanes(out[index].Dual, QuaternionLanes<Lanes>
+            {
+                half * (tx * real.W + ty * real.Z - tz * real.Y),
+                half * (ty * real.W + tz * real.X - tx * real.Z),
+                half * (tz * real.W + tx * real.Y - ty * real.X),
+                Lanes::Set(-0.5f) * (tx * real.X + ty * real.Y + tz * real.Z)
+            });
+        });
+    }
+
+    void DualQuaternion::ToMat4x4Batch(std::span<const DualQuaternion> dualQuaternions, std::span<Mat4x4> out)
+    {
+        if (out.size() < dualQuaternions.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(dualQuaternions.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const auto real = LoadLanes<Lanes>(dualQuaternions[index].Real);
+            const auto dual = LoadLanes<Lanes>(dualQuaternions[index].Dual);
+            const Lanes zero = Lanes::Set(0.0f);
+            const Lanes one = Lanes::Set(1.0f);
+            const Lanes two = Lanes::Set(2.0f);
+
+            // Same rotation matrix as Mat4x4::FromTRS, with the translation of GetTranslation
+            const Lanes xx = real.X * real.X;
+            const Lanes yy = real.Y * real.Y;
+            const Lanes zz = real.Z * real.Z;
+            const Lanes xy = real.X * real.Y;
+            const Lanes xz = real.X * real.Z;
+            const Lanes yz = real.Y * real.Z;
+            const Lanes wx = real.W * real.X;
+            const Lanes wy = real.W * real.Y;
+            const Lanes wz = real.W * real.Z;
+            const Lanes tx = two * (real.W * dual.X - dual.W * real.X + real.Y * dual.Z - real.Z * dual.Y);
+            const Lanes ty = two * (real.W * dual.Y - dual.W * real.Y + real.Z * dual.X - real.X * dual.Z);
+            const Lanes tz = two * (real.W * dual.Z - dual.W * real.Z + real.X * dual.Y - real.Y * dual.X);
+
+            float* result = out[index].Values.data();
+            Simd::StoreInterleaved(result, one - two * (yy + zz), two * (xy + wz), two * (xz - wy), zero, MatrixStride);
+            Simd::StoreInterleaved(result + 4, two * (xy - wz), one - two * (xx + zz), two * (yz + wx), zero, MatrixStride);
+            Simd::StoreInterleaved(result + 8, two * (xz + wy), two * (yz - wx), one - two * (xx + yy), zero, MatrixStride);
+            Simd::StoreInterleaved(result + 12, tx, ty, tz, one, MatrixStride);
+        });
+    }
+
+    std::string DualQuaternion::ToString() const
+    {
+        return std::format("(Real: {}, Dual: {})", Real.ToString(), Dual.ToString());
+    }
+}
@@ -0,0 +1,162 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/Frustum.h"
+#include "Tbx/Math/SimdLanes.h"
+
+namespace Tbx
+{
+    std::string Plane::ToString() const { return std::format("[Normal: {}, Distance: {}]", Normal.ToString(), Distance); }
+
+    float Plane::GetSignedDistance(const Plane& plane, const Vector3& point)
+    {
+        return plane.Normal.X * point.X + plane.Normal.Y * point.Y + plane.Normal.Z * point.Z + plane.Distance;
+    }
+
+    Plane Plane::Normalize(const Plane& plane)
+    {
+        const float length = std::sqrt(plane.Normal.X * plane.Normal.X + plane.Normal.Y * plane.Normal.Y + plane.Normal.Z * plane.Normal.Z);
+        if (length <= 0.0f) return plane;
+
+        const float inverseLength = 1.0f / length;
+        return { { plane.Normal.X * inverseLength, plane.Normal.Y * inverseLength, plane.Normal.Z * inverseLength }, plane.Distance * inverseLength };
+    }
+
+    Frustum::Frustum(const Mat4x4& viewProjection)
+    {
+        // Values are stored column by column, so row r of the matrix is Values[r], Values[4 + r], Values[8 + r], Values[12 + r].
+        // A point is inside when -w <= x, y, z <= w in clip space, each inequality is a plane built from row 3 plus or minus another row.
+        const auto& m = viewProjection.Values;
+        auto makePlane = [&m](int row, float sign)
+        {
+            return Plane::Normalize(
+            {
+                { m[3] + sign * m[row], m[7] + sign * m[4 + row], m[11] + sign * m[8 + row] },
+                m[15] + sign * m[12 + row]
+            });
+        };
+
+        Planes[Left] = makePlane(0, 1.0f);
+        Planes[Right] = makePlane(0, -1.0f);
+        Planes[Bottom] = makePlane(1, 1.0f);
+        Planes[Top] = makePlane(1, -1.0f);
+        Planes[Near] = makePlane(2, 1.0f);
+        Planes[Far] = makePlane(2, -1.0f);
+    }
+
+    std::string Frustum::ToString() const
+    {
+        return std::format(
+            "[Left: {}, Right: {}, Bottom: {}, Top: {}, Near: {}, Far: {}]",
+            Planes[Left].ToString(), Planes[Right].ToString(), Planes[Bottom].ToString(),
+            Planes[Top].ToString(), Planes[Near].ToString(), Planes[Far].ToString());
+    }
+
+    bool Frustum::Contains(const Frustum& frustum, const Vector3& point)
+    {
+        for (const auto& plane : frustum.Planes)
+        {
+            if (Plane::GetSignedDistance(plane, point) < 0.0f) return false;
+        }
+        return true;
+    }
+
+    bool Frustum::Intersects(const Frustum& frustum, const Vector3& center, float radius)
+    {
+        for (const auto& plane : frustum.Planes)
+        {
+            if (Plane::GetSignedDistance(plane, center) < -radius) return false;
+        }
+        return true;
+    }
+
+    bool Frustum::Intersects(const Frustum& frustum, const AABB& box)
+    {
+        // The center of an empty box is NaN, so it is rejected up front instead of relying on how NaN compares
+        if (box.IsEmpty()) return false;
+
+        const Vector3 center = box.GetCenter();
+        const Vector3 extents = box.GetExtents();
+        for (const auto& plane : frustum.Planes)
+        {
+            // Projected radius of the box onto the plane normal
+            const float radius =
+                std::fabs(plane.Normal.X) * extents.X +
+                std::fabs(plane.Normal.Y) * extents.Y +
+                std::fabs(plane.Normal.Z) * extents.Z;
+            if (Plane::GetSignedDistance(plane, center) + radius < 0.0f) return false;
+        }
+        return true;
+    }
+
+    void Frustum::CullSpheres(
+        const Frustum& frustum,
+        std::span<const float> centerX,
+        std::span<const float> centerY,
+        std::span<const float> centerZ,
+        std::span<const float> radius,
+        std::span<uint64> outVisibleMask)
+    {
+        const size_t count = centerX.size();
+        if (centerY.size() != count || centerZ.size() != count || radius.size() != count) throw std::out_of_range("Sphere component spans must be the same size.");
+        if (outVisibleMask.size() < (count + 63) / 64) throw std::out_of_range("Output mask is smaller than the sphere count.");
+
+        Simd::WriteBitMask(count, outVisibleMask.data(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const Lanes x = Lanes::Load(centerX.data() + index);
+            const Lanes y = Lanes::Load(centerY.data() + index);
+            const Lanes z = Lanes::Load(centerZ.data() + index);
+            const Lanes negativeRadius = Lanes::Set(0.0f) - Lanes::Load(radius.data() + index);
+
+            Lanes visible = Lanes::TrueMask();
+            for (const auto& plane : frustum.Planes)
+            {
+                const Lanes distance =
+                    Lanes::Set(plane.Normal.X) * x +
+                    Lanes::Set(plane.Normal.Y) * y +
+                    Lanes::Set(plane.Normal.Z) * z +
+                    Lanes::Set(plane.Distance);
+                visible = visible & Simd::GreaterEqual(distance, negativeRadius);
+            }
+            return visible;
+        });
+    }
+
+    void Frustum::CullAABBs(const Frustum& frustum, const AABBBuffer& boxes, std::span<uint64> outVisibleMask)
+    {
+        if (outVisibleMask.size() < boxes.GetMaskWordCount()) throw std::out_of_range("Output mask is smaller than the box buffer.");
+
+        Simd::WriteBitMask(boxes.Size(), outVisibleMask.data(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const Lanes half = Lanes::Set(0.5f);
+            const Lanes minX = Lanes::Load(boxes.GetMinX().data() + index);
+            const Lanes minY = Lanes::Load(boxes.GetMinY().data() + index);
+            const Lanes minZ = Lanes::Load(boxes.GetMinZ().data() + index);
+            const Lanes maxX = Lanes::Load(boxes.GetMaxX().data() + index);
+            const Lanes maxY = Lanes::Load(boxes.GetMaxY().data() + index);
+            const Lanes maxZ = Lanes::Load(boxes.GetMaxZ().data() + index);
+            const Lanes centerX = (minX + maxX) * half;
+            const Lanes centerY = (minY + maxY) * half;
+            const Lanes centerZ = (minZ + maxZ) * half;
+            const Lanes extentX = (maxX - minX) * half;
+            const Lanes extentY = (maxY - minY) * half;
+            const Lanes extentZ = (maxZ - minZ) * half;
+
+            // Empty boxes are never visible, matching Intersects
+            const Lanes empty = Simd::Greater(minX, maxX) | Simd::Greater(minY, maxY) | Simd::Greater(minZ, maxZ);
+            Lanes visible = Simd::Select(empty, Lanes::Set(0.0f), Lanes::TrueMask());
+            for (const auto& plane : frustum.Planes)
+            {
+                const Lanes distance =
+                    Lanes::Set(plane.Normal.X) * centerX +
+                    Lanes::Set(plane.Normal.Y) * centerY +
+                    Lanes::Set(plane.Normal.Z) * centerZ +
+                    Lanes::Set(plane.Distance);
+                const Lanes radius =
+                    Lanes::Set(std::fabs(plane.Normal.X)) * extentX +
+                    Lanes::Set(std::fabs(plane.Normal.Y)) * extentY +
+                    Lanes::Set(std::fabs(plane.Normal.Z)) * extentZ;
+                visible = visible & Simd::GreaterEqual(distance + radius, Lanes::Set(0.0f));
+            }
+            return visible;
+        });
+    }
+}
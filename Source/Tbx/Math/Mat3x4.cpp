@@ -0,0 +1,21 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/Mat3x4.h"
+
+#ifndef TBX_MATH_INLINE
+    #include "Tbx/Math/Mat3x4.inl"
+#endif
+
+namespace Tbx
+{
+    static_assert(sizeof(Mat3x4) == 12 * sizeof(float), "Mat3x4 must stay 48 bytes.");
+
+    std::string Mat3x4::ToString() const
+    {
+        return std::format(
+            "[{}, {}, {}, {}],\n[{}, {}, {}, {}],\n[{}, {}, {}, {}]",
+            Values[0], Values[3], Values[6], Values[9],
+            Values[1], Values[4], Values[7], Values[10],
+            Values[2], Values[5], Values[8], Values[11]
+        );
+    }
+}
@@ -1,73 +1,128 @@
 #include "Tbx/Math/PCH.h"
 #include "Tbx/Math/Constants.h"
 #include "Tbx/Math/Mat4x4.h"
+#include "Tbx/Math/Mat4x4Kernels.h"
+#include "Tbx/Math/SimdLanes.h"
+#include "Tbx/Math/ThreadPool.h"
 #include "Tbx/Math/Trig.h"
-#include "Tbx/Math/Int.h"
-#include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
-#include <glm/gtx/quaternion.hpp>
+
+#ifndef TBX_MATH_INLINE
+    #include "Tbx/Math/Mat4x4.inl"
+#endif
 
 namespace Tbx
 {
-    static Mat4x4 GlmMat4ToTbxMat4x4(const glm::mat4& glmMat)
-    {
-        std::array<float, 16> arr;
-        std::memcpy(arr.data(), glm::value_ptr(glmMat), sizeof(arr));
-        return arr;
+    /// <summary>
+    /// Batches larger than this (in matrices) write their results with non temporal stores,
+    /// so streaming out a whole frame of matrices doesn't evict the inputs from the cache.
+    /// </summary>
+    static constexpr size_t StreamingStoreThreshold = 4096;
+
+    /// <summary>
+    /// Multiplies count matrices, stepping lhs and rhs by LhsStep and RhsStep matrices each iteration.
+    /// A step of 0 keeps using the same matrix, which lets its loads be hoisted out of the loop.
+    /// </summary>
+    template <size_t LhsStep, size_t RhsStep>
+    static void MultiplyBatchKernel(const Mat4x4* lhs, const Mat4x4* rhs, Mat4x4* out, size_t count)
+    {
+#ifdef TBX_MATH_SSE2
+        const bool stream = count > StreamingStoreThreshold;
+        for (size_t i = 0; i < count; i++)
+        {
+            const float* l = lhs[i * LhsStep].Values.data();
+            const float* r = rhs[i * RhsStep].Values.data();
+            float* o = out[i].Values.data();
+            if (stream) Simd::Mat4x4MultiplyColumns<true>(l, r, o);
+            else Simd::Mat4x4MultiplyColumns<false>(l, r, o);
+        }
+        if (stream)
+        {
+            _mm_sfence();
+        }
+#else
+        for (size_t i = 0; i < count; i++)
+        {
+            Simd::Mat4x4Multiply(lhs[i * LhsStep].Values.data(), rhs[i * RhsStep].Values.data(), out[i].Values.data());
+        }
+#endif
     }
 
-    Mat4x4::Mat4x4()
-    {
-        Values = Constants::Mat4x4::Identity;
-    }
+    /// <summary>
+    /// The points or directions each thread transforms at a time, a multiple of every lane width.
+    /// </summary>
+    static constexpr size_t TransformGrainSize = 8192;
 
-    Mat4x4::Mat4x4(const std::initializer_list<float>& data)
+    enum class VectorTransform
     {
-        std::ranges::copy(data, Values.begin());
-    }
+        Point,
+        Direction,
+        ProjectivePoint
+    };
 
-    Mat4x4::Mat4x4(const std::initializer_list<std::initializer_list<float>>& data)
+    /// <summary>
+    /// Transforms the vectors in [begin, end), Lanes::Width at a time.
+    /// The vectors are shuffled into one register per component so each row of the matrix is three multiply adds per register.
+    /// </summary>
+    template <VectorTransform Kind, typename Lanes>
+    static size_t TransformLanes(const Mat4x4& matrix, const Vector3* in, Vector3* out, size_t begin, size_t end)
     {
-        // Copy init list to dest val
-        uint row = 0;
-        std::array<std::array<float, 4>, 4> vals;
-        for (const auto& rowList : data)
+        std::array<Lanes, 16> m;
+        for (int i = 0; i < 16; i++)
         {
-            uint col = 0;
-            for (float val : rowList)
+            m[i] = Lanes::Set(matrix[i]);
+        }
+
+        size_t index = begin;
+        for (; index + Lanes::Width <= end; index += Lanes::Width)
+        {
+            Lanes x, y, z;
+            Simd::LoadInterleaved(&in[index].X, x, y, z);
+
+            Lanes resultX = m[0] * x + m[4] * y + m[8] * z;
+            Lanes resultY = m[1] * x + m[5] * y + m[9] * z;
+            Lanes resultZ = m[2] * x + m[6] * y + m[10] * z;
+            if constexpr (Kind != VectorTransform::Direction)
             {
-                if (row < 4 && col < 4)
-                {
-                    vals[row][col] = val;
-                    col++;
-                }
-                else throw std::out_of_range("Initializer list has more elements than the destination array.");
+                resultX = resultX + m[12];
+                resultY = resultY + m[13];
+                resultZ = resultZ + m[14];
             }
-
-            if (col != 4 && row < 4)  throw std::out_of_range("Initializer list row has fewer elements than the destination array row.");
-            row++;
+            if constexpr (Kind == VectorTransform::ProjectivePoint)
+            {
+                const Lanes invW = Lanes::Set(1.0f) / (m[3] * x + m[7] * y + m[11] * z + m[15]);
+                resultX = resultX * invW;
+                resultY = resultY * invW;
+                resultZ = resultZ * invW;
+            }
+            Simd::StoreInterleaved(&out[index].X, resultX, resultY, resultZ);
         }
-        if (row != 4)  throw std::out_of_range("Initializer list has fewer rows than the destination array.");
+        return index;
+    }
 
-        // Copy result to values
-        Values =
-        {
-            vals[0][0], vals[1][0], vals[2][0], vals[3][0],
-            vals[0][1], vals[1][1], vals[2][1], vals[3][1],
-            vals[0][2], vals[1][2], vals[2][2], vals[3][2],
-            vals[0][3], vals[1][3], vals[2][3], vals[3][3]
-        };
+    template <VectorTransform Kind>
+    static void TransformRange(const Mat4x4& matrix, const Vector3* in, Vector3* out, size_t begin, size_t end)
+    {
+        const size_t tail = TransformLanes<Kind, Simd::FloatN>(matrix, in, out, begin, end);
+        TransformLanes<Kind, Simd::Float1>(matrix, in, out, tail, end);
     }
 
-    Mat4x4::Mat4x4(const std::array<std::array<float, 4>, 4>& data)
+    template <VectorTransform Kind>
+    static void TransformVectors(const Mat4x4& matrix, std::span<const Vector3> in, std::span<Vector3> out)
     {
-        Values = 
+        if (out.size() < in.size()) throw std::out_of_range("Output span is smaller than the input span.");
+        TransformRange<Kind>(matrix, in.data(), out.data(), 0, in.size());
+    }
+
+    template <VectorTransform Kind>
+    static void TransformVectors(const Mat4x4& matrix, std::span<const Vector3> in, std::span<Vector3> out, ThreadPool& pool)
+    {
+        if (out.size() < in.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        pool.ParallelFor(in.size(), TransformGrainSize, [&](size_t begin, size_t end)
         {
-            data[0][0], data[1][0], data[2][0], data[3][0],
-            data[0][1], data[1][1], data[2][1], data[3][1],
-            data[0][2], data[1][2], data[2][2], data[3][2],
-            data[0][3], data[1][3], data[2][3], data[3][3]
-        };
+            TransformRange<Kind>(matrix, in.data(), out.data(), begin, end);
+        });
     }
 
     std::string Mat4x4::ToString() const
@@ -81,142 +136,53 @@ namespace Tbx
         );
     }
 
-    Mat4x4 Mat4x4::FromPosition(const Vector3& position)
-    {
-        const glm::mat4 glmMat = glm::translate(glm::mat4(1.0f), glm::vec3(position.X, position.Y, position.Z));
-        return GlmMat4ToTbxMat4x4(glmMat);
-    }
-
-    Mat4x4 Mat4x4::FromRotation(const Quaternion& rotation)
-    {
-        const auto glmQuat = glm::quat(rotation.W, rotation.X, rotation.Y, rotation.Z);
-        glm::mat4 rotationMatrix = glm::toMat4(glmQuat);
-        return GlmMat4ToTbxMat4x4(rotationMatrix);
-    }
-
-    Mat4x4 Mat4x4::FromScale(const Vector3& scale)
-    {
-        const glm::mat4 glmMat = glm::scale(glm::mat4(1.0f), glm::vec3(scale.X, scale.Y, scale.Z));
-        return GlmMat4ToTbxMat4x4(glmMat);
-    }
-
-    Mat4x4 Mat4x4::FromTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
-    {
-        const auto glmPos = glm::vec3(position.X, position.Y, position.Z);
-        const auto glmRot = glm::quat(rotation.W, rotation.X, rotation.Y, rotation.Z);
-        const auto glmScale = glm::vec3(scale.X, scale.Y, scale.Z);
-
-        glm::mat4 glmMat = glm::translate(glm::mat4(1.0f), glmPos)
-            * glm::mat4_cast(glmRot)
-            * glm::scale(glm::mat4(1.0f), glmScale);
-        return GlmMat4ToTbxMat4x4(glmMat);
-    }
-
-    Mat4x4 Mat4x4::LookAt(const Vector3& from, const Vector3& target, const Vector3& up)
-    {
-        const auto glmVecFrom = glm::vec3(from.X, from.Y, from.Z);
-        const auto glmVecTarget = glm::vec3(target.X, target.Y, target.Z);
-        const auto glmVecUp = glm::vec3(up.X, up.Y, up.Z);
-
-        return GlmMat4ToTbxMat4x4(glm::lookAt(glmVecFrom, glmVecTarget, glmVecUp));
-    }
-
-    Mat4x4 Mat4x4::OrthographicProjection(const Bounds& bounds, float zNear, float zFar)
-    {
-        const glm::mat4& glmMat = glm::ortho(
-            bounds.Left,
-            bounds.Right,
-            bounds.Bottom,
-            bounds.Top,
-            0.0f,
-            zFar - zNear);
-        return GlmMat4ToTbxMat4x4(glmMat);
-    }
-
-    Mat4x4 Mat4x4::PerspectiveProjection(float fov, float aspect, float zNear, float zFar)
+    void Mat4x4::MultiplyBatch(std::span<const Mat4x4> lhs, const Mat4x4& rhs, std::span<Mat4x4> out)
     {
-        const glm::mat4 glmMat = glm::perspective(fov, aspect, zNear, zFar);
-        return GlmMat4ToTbxMat4x4(glmMat);
+        if (out.size() < lhs.size()) throw std::out_of_range("Output span is smaller than the input span.");
+        MultiplyBatchKernel<1, 0>(lhs.data(), &rhs, out.data(), lhs.size());
     }
 
-    Mat4x4 Mat4x4::Inverse(const Mat4x4& matrix)
+    void Mat4x4::MultiplyBatch(const Mat4x4& lhs, std::span<const Mat4x4> rhs, std::span<Mat4x4> out)
     {
-        const glm::mat4 glmMat = glm::make_mat4(matrix.Values.data());
-        const glm::mat4 inversedGlmMat = glm::inverse(glmMat);
-        return GlmMat4ToTbxMat4x4(inversedGlmMat);
+        if (out.size() < rhs.size()) throw std::out_of_range("Output span is smaller than the input span.");
+        MultiplyBatchKernel<0, 1>(&lhs, rhs.data(), out.data(), rhs.size());
     }
 
-    Mat4x4 Mat4x4::Transpose(const Mat4x4& matrix)
+    void Mat4x4::MultiplyBatch(std::span<const Mat4x4> lhs, std::span<const Mat4x4> rhs, std::span<Mat4x4> out)
     {
-        const glm::mat4 glmMat = glm::make_mat4(matrix.Values.data());
-        const glm::mat4 result = glm::transpose(glmMat);
-        return GlmMat4ToTbxMat4x4(result);
+        if (lhs.size() != rhs.size()) throw std::out_of_range("Input spans must be the same size.");
+        if (out.size() < lhs.size()) throw std::out_of_range("Output span is smaller than the input spans.");
+        MultiplyBatchKernel<1, 1>(lhs.data(), rhs.data(), out.data(), lhs.size());
     }
 
-    Mat4x4 Mat4x4::Translate(const Mat4x4& matrix, const Vector3& translate)
+    void Mat4x4::TransformPoints(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out)
     {
-        const glm::mat4 glmMat = glm::make_mat4(matrix.Values.data());
-        return GlmMat4ToTbxMat4x4(glm::translate(glmMat, glm::vec3(translate.X, translate.Y, translate.Z)));
+        TransformVectors<VectorTransform::Point>(matrix, points, out);
     }
 
-    Mat4x4 Mat4x4::Rotate(const Mat4x4& matrix, float angle, const Vector3& axis)
+    void Mat4x4::TransformPoints(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out, ThreadPool& pool)
     {
-        const auto glmVec = glm::vec3(axis.X, axis.Y, axis.Z);
-        const glm::mat4 glmMat = glm::make_mat4(matrix.Values.data());
-        const glm::mat4 result = glm::rotate(glmMat, Math::DegreesToRadians(angle), glmVec);
-        return GlmMat4ToTbxMat4x4(result);
+        TransformVectors<VectorTransform::Point>(matrix, points, out, pool);
     }
 
-    Mat4x4 Mat4x4::Scale(const Mat4x4& matrix, const Vector3& scale)
+    void Mat4x4::TransformDirections(const Mat4x4& matrix, std::span<const Vector3> directions, std::span<Vector3> out)
     {
-        auto result = matrix;
-
-        result[0]  *= scale.X; // scale along the x-axis
-        result[5]  *= scale.Y; // scale along the y-axis
-        result[10] *= scale.Z; // scale along the z-axis
-
-        return result;
+        TransformVectors<VectorTransform::Direction>(matrix, directions, out);
     }
 
-    Mat4x4 Mat4x4::Add(const Mat4x4& lhs, const Mat4x4& rhs)
+    void Mat4x4::TransformDirections(const Mat4x4& matrix, std::span<const Vector3> directions, std::span<Vector3> out, ThreadPool& pool)
     {
-        const glm::mat4 lhsMat = glm::make_mat4(lhs.Values.data());
-        const glm::mat4 rhsMat = glm::make_mat4(rhs.Values.data());
-
-        const glm::mat4& result = lhsMat + rhsMat;
-        return GlmMat4ToTbxMat4x4(result);
+        TransformVectors<VectorTransform::Direction>(matrix, directions, out, pool);
     }
 
-    Mat4x4 Mat4x4::Subtract(const Mat4x4& lhs, const Mat4x4& rhs)
+    void Mat4x4::TransformPointsProjective(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out)
     {
-        const glm::mat4 lhsMat = glm::make_mat4(lhs.Values.data());
-        const glm::mat4 rhsMat = glm::make_mat4(rhs.Values.data());
-
-        const glm::mat4 result = lhsMat - rhsMat;
-        return GlmMat4ToTbxMat4x4(result);
+        TransformVectors<VectorTransform::ProjectivePoint>(matrix, points, out);
     }
 
-    Mat4x4 Mat4x4::Multiply(const Mat4x4& lhs, const Mat4x4& rhs)
+    void Mat4x4::TransformPointsProjective(const Mat4x4& matrix, std::span<const Vector3> points, std::span<Vector3> out, ThreadPool& pool)
     {
-        const glm::mat4 lhsMat = glm::make_mat4(lhs.Values.data());
-        const glm::mat4 rhsMat = glm::make_mat4(rhs.Values.data());
-
-        const glm::mat4 result = lhsMat * rhsMat;
-        return GlmMat4ToTbxMat4x4(result);
-    }
-
-    Mat4x4 Mat4x4::Multiply(float lhs, const Mat4x4& rhs)
-    {
-        const glm::mat4 rhsMat = glm::make_mat4(rhs.Values.data());
-        const glm::mat4 result = lhs * rhsMat;
-        return GlmMat4ToTbxMat4x4(result);
-    }
-
-    Mat4x4 Mat4x4::Multiply(const Mat4x4& lhs, float rhs)
-    {
-        const glm::mat4 lhsMat = glm::make_mat4(lhs.Values.data());
-        const glm::mat4 result = lhsMat * rhs;
-        return GlmMat4ToTbxMat4x4(result);
+        TransformVectors<VectorTransform::ProjectivePoint>(matrix, points, out, pool);
     }
 
     bool Mat4x4::IsEqual(const Mat4x4& lhs, float rhs)
@@ -0,0 +1,195 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/PackedVectors.h"
+#include "Tbx/Math/SimdLanes.h"
+
+namespace Tbx
+{
+    // The batches treat spans of vectors as flat arrays of components, which needs every type to be exactly its three components
+    static_assert(sizeof(Vector3H) == 3 * sizeof(uint16) && sizeof(Vector3Q16) == 3 * sizeof(uint16), "Packed vectors must be tightly packed.");
+
+    static constexpr float QuantizedMax = 65535.0f;
+
+    Vector3H::Vector3H(const Vector3& vector)
+        : X(FloatToHalf(vector.X)), Y(FloatToHalf(vector.Y)), Z(FloatToHalf(vector.Z))
+    {
+    }
+
+    Vector3 Vector3H::ToVector3() const
+    {
+        return { HalfToFloat(X), HalfToFloat(Y), HalfToFloat(Z) };
+    }
+
+    uint16 Vector3H::FloatToHalf(float value)
+    {
+        const uint32 bits = std::bit_cast<uint32>(value);
+        const uint32 sign = (bits >> 16) & 0x8000u;
+        uint32 magnitude = bits & 0x7FFFFFFFu;
+
+        // Infinity and NaN, NaNs stay quiet NaNs
+        if (magnitude >= 0x7F800000u) return static_cast<uint16>(sign | (magnitude > 0x7F800000u ? 0x7E00u : 0x7C00u));
+
+        // At least 65536 overflows to infinity, values just below it round up to infinity in the normal path
+        if (magnitude >= 0x47800000u) return static_cast<uint16>(sign | 0x7C00u);
+
+        if (magnitude < 0x38800000u)
+        {
+            // Below the smallest normal half, adding 0.5 lines the half subnormal bits up with the bottom of the float mantissa
+            // and lets the FPU round them to nearest even
+            const float rounded = std::bit_cast<float>(magnitude) + 0.5f;
+            return static_cast<uint16>(sign | (std::bit_cast<uint32>(rounded) - std::bit_cast<uint32>(0.5f)));
+        }
+
+        // Rebias the exponent and round the 13 dropped mantissa bits to nearest even
+        const uint32 mantissaOdd = (magnitude >> 13) & 1u;
+        magnitude += 0xC8000FFFu + mantissaOdd;
+        return static_cast<uint16>(sign | (magnitude >> 13));
+    }
+
+    float Vector3H::HalfToFloat(uint16 half)
+    {
+        constexpr uint32 exponentMask = 0x7C00u << 13;
+        uint32 bits = (half & 0x7FFFu) << 13;
+        const uint32 exponent = bits & exponentMask;
+        bits += (127 - 15) << 23;
+
+        if (exponent == exponentMask)
+        {
+            // Infinity and NaN need the largest float exponent
+            bits += (128 - 16) << 23;
+        }
+        else if (exponent == 0)
+        {
+            // Subnormal halves are normal floats, renormalize them with the FPU
+            bits += 1 << 23;
+            bits = std::bit_cast<uint32>(std::bit_cast<float>(bits) - std::bit_cast<float>(113u << 23));
+        }
+        return std::bit_cast<float>(bits | (uint32(half & 0x8000u) << 16));
+    }
+
+    void Vector3H::FromVector3Batch(std::span<const Vector3> vectors, std::span<Vector3H> out)
+    {
+        if (out.size() < vectors.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        // Components convert independently, so convert the vectors as one flat array of floats
+        const float* in = reinterpret_cast<const float*>(vectors.data());
+        uint16* result = reinterpret_cast<uint16*>(out.data());
+        const size_t count = vectors.size() * 3;
+        size_t index = 0;
+#ifdef TBX_MATH_F16C
+        for (; index + 8 <= count; index += 8)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), _mm256_cvtps_ph(_mm256_loadu_ps(in + index), _MM_FROUND_TO_NEAREST_INT));
+        }
+#endif
+        for (; index < count; index++)
+        {
+            result[index] = FloatToHalf(in[index]);
+        }
+    }
+
+    void Vector3H::ToVector3Batch(std::span<const Vector3H> vectors, std::span<Vector3> out)
+    {
+        if (out.size() < vectors.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        const uint16* in = reinterpret_cast<const uint16*>(vectors.data());
+        float* result = reinterpret_cast<float*>(out.data());
+        const size_t count = vectors.size() * 3;
+        size_t index = 0;
+#ifdef TBX_MATH_F16C
+        for (; index + 8 <= count; index += 8)
+        {
+            _mm256_storeu_ps(result + index, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + index))));
+        }
+#endif
+        for (; index < count; index++)
+        {
+            result[index] = HalfToFloat(in[index]);
+        }
+    }
+
+    /// <summary>
+    /// Per component offsets and scales for the flat quantization kernels, repeating every three floats so that
+    /// register b of a block of Width vectors starts at element b * Width.
+    /// </summary>
+    struct QuantizationPattern
+    {
+        QuantizationPattern(const Vector3& offset, const Vector3& scale)
+        {
+            for (size_t i = 0; i < std::size(Offsets); i++)
+            {
+                Offsets[i] = (&offset.X)[i % 3];
+                Scales[i] = (&scale.X)[i % 3];
+            }
+        }
+
+        float Offsets[3 * Simd::FloatN::Width];
+        float Scales[3 * Simd::FloatN::Width];
+    };
+
+    static float QuantizationScale(float size)
+    {
+        return size > 0.0f ? QuantizedMax / size : 0.0f;
+    }
+
+    void Vector3Q16::QuantizeBatch(std::span<const Vector3> positions, const AABB& bounds, std::span<Vector3Q16> out)
+    {
+        if (out.size() < positions.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        const Vector3 size = bounds.GetSize();
+        const QuantizationPattern pattern(bounds.Min, { QuantizationScale(size.X), QuantizationScale(size.Y), QuantizationScale(size.Z) });
+        const float* in = reinterpret_cast<const float*>(positions.data());
+        uint16* result = reinterpret_cast<uint16*>(out.data());
+
+        // Lanes::Width vectors are 3 registers of flat components
+        Simd::ForEachLane(positions.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            constexpr size_t width = Lanes::Width;
+            const size_t first = index * 3;
+            int32_t quantized[3 * width];
+            for (size_t block = 0; block < 3; block++)
+            {
+                const Lanes value = (Lanes::Load(in + first + block * width) - Lanes::Load(pattern.Offsets + block * width)) * Lanes::Load(pattern.Scales + block * width);
+                Simd::Min(Simd::Max(value, Lanes::Set(0.0f)), Lanes::Set(QuantizedMax)).StoreInt(quantized + block * width);
+            }
+            for (size_t i = 0; i < 3 * width; i++)
+            {
+                result[first + i] = static_cast<uint16>(quantized[i]);
+            }
+        });
+    }
+
+    void Vector3Q16::DequantizeBatch(std::span<const Vector3Q16> positions, const AABB& bounds, std::span<Vector3> out)
+    {
+        if (out.size() < positions.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        const Vector3 step = bounds.GetSize() * (1.0f / QuantizedMax);
+        const QuantizationPattern pattern(bounds.Min, step);
+        const uint16* in = reinterpret_cast<const uint16*>(positions.data());
+        float* result = reinterpret_cast<float*>(out.data());
+
+        Simd::ForEachLane(positions.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            constexpr size_t width = Lanes::Width;
+            const size_t first = index * 3;
+            for (size_t block = 0; block < 3; block++)
+            {
+                const Lanes value = Lanes::LoadUInt16(in + first + block * width) * Lanes::Load(pattern.Scales + block * width) + Lanes::Load(pattern.Offsets + block * width);
+                value.Store(result + first + block * width);
+            }
+        });
+    }
+
+    Vector3Q16 Vector3Q16::Quantize(const Vector3& position, const AABB& bounds)
+    {
+        Vector3Q16 result;
+        QuantizeBatch(std::span(&position, 1), bounds, std::span(&result, 1));
+        return result;
+    }
+
+    Vector3 Vector3Q16::Dequantize(const Vector3Q16& position, const AABB& bounds)
+    {
+        Vector3 result;
+        DequantizeBatch(std::span(&position, 1), bounds, std::span(&result, 1));
+        return result;
+    }
+}
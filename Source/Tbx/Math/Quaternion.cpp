@@ -1,46 +1,124 @@
 #include "Tbx/Math/PCH.h"
 #include "Tbx/Math/Quaternion.h"
 #include "Tbx/Math/Trig.h"
+#include "Tbx/Math/TrigKernels.h"
 #include <glm/fwd.hpp>
 #include <glm/gtx/quaternion.hpp>
 
+#ifndef TBX_MATH_INLINE
+    #include "Tbx/Math/Quaternion.inl"
+#endif
+
 namespace Tbx
 {
-    Vector3 Quaternion::GetForward(const Quaternion& rot)
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Gathering components assumes tightly packed quaternions.");
+
+    enum class BlendMode
     {
-        const auto glmQuat = glm::quat(rot.W, rot.X, rot.Y, rot.Z);
-        glm::vec3 objectForward = glm::vec3(0.0f, 0.0f, 1.0f);
-        glm::vec3 result = glm::normalize(glm::rotate(glmQuat, objectForward));
-        return { result.x, result.y, result.z };
-    }
+        Slerp,
+        Nlerp,
+        FastSlerp
+    };
 
-    Vector3 Quaternion::GetRight(const Quaternion& rot)
+    /// <summary>
+    /// Blends Lanes::Width pairs of rotations starting at index, the lane form of Slerp, Nlerp and FastSlerp.
+    /// </summary>
+    template <BlendMode Mode, typename Lanes>
+    static void BlendLanes(const Quaternion* from, const Quaternion* to, Lanes t, Quaternion* out)
     {
-        const auto glmQuat = glm::quat(rot.W, rot.X, rot.Y, rot.Z);
-        glm::vec3 objectRight = glm::vec3(-1.0f, 0.0f, 0.0f);
-        glm::vec3 result = glm::normalize(glm::rotate(glmQuat, objectRight));
-        return { result.x, result.y, result.z };
+        const Lanes zero = Lanes::Set(0.0f);
+        const Lanes one = Lanes::Set(1.0f);
+        Lanes fromX, fromY, fromZ, fromW;
+        Lanes toX, toY, toZ, toW;
+        Simd::LoadInterleaved(&from->X, fromX, fromY, fromZ, fromW);
+        Simd::LoadInterleaved(&to->X, toX, toY, toZ, toW);
+
+        // Flip to onto from's hemisphere so every blend takes the shortest path
+        const Lanes dot = fromX * toX + fromY * toY + fromZ * toZ + fromW * toW;
+        const Lanes toSign = Simd::Select(Simd::Less(dot, zero), Lanes::Set(-1.0f), one);
+        const Lanes cosTheta = dot * toSign;
+        toX = toX * toSign;
+        toY = toY * toSign;
+        toZ = toZ * toSign;
+        toW = toW * toSign;
+
+        if constexpr (Mode == BlendMode::FastSlerp)
+        {
+            const Lanes half = Lanes::Set(0.5f);
+            const Lanes a = Lanes::Set(1.0904f) + cosTheta * (Lanes::Set(-3.2452f) + cosTheta * (Lanes::Set(3.55645f) - cosTheta * Lanes::Set(1.43519f)));
+            const Lanes b = Lanes::Set(0.848013f) + cosTheta * (Lanes::Set(-1.06021f) + cosTheta * Lanes::Set(0.215638f));
+            const Lanes k = a * (t - half) * (t - half) + b;
+            t = t + t * (t - half) * (t - one) * k;
+        }
+
+        // Nlerp weights, normalized afterwards
+        Lanes fromWeight = one - t;
+        Lanes toWeight = t;
+        Lanes normalize = Lanes::TrueMask();
+        if constexpr (Mode == BlendMode::Slerp)
+        {
+            // sin((1 - t) * theta) = sin(theta) * cos(t * theta) - cos(theta) * sin(t * theta), so one SinCos gives both weights
+            const Lanes theta = Simd::ACos(cosTheta);
+            const Lanes sinTheta = Simd::Sqrt((one - cosTheta) * (one + cosTheta));
+            Lanes sinTTheta;
+            Lanes cosTTheta;
+            Simd::SinCos(t * theta, sinTTheta, cosTTheta);
+            const Lanes slerpToWeight = sinTTheta / sinTheta;
+
+            // Nearly equal rotations keep the nlerp weights like Slerp does
+            normalize = Simd::Greater(cosTheta, Lanes::Set(0.9995f));
+            fromWeight = Simd::Select(normalize, fromWeight, cosTTheta - cosTheta * slerpToWeight);
+            toWeight = Simd::Select(normalize, toWeight, slerpToWeight);
+        }
+
+        const Lanes x = fromX * fromWeight + toX * toWeight;
+        const Lanes y = fromY * fromWeight + toY * toWeight;
+        const Lanes z = fromZ * fromWeight + toZ * toWeight;
+        const Lanes w = fromW * fromWeight + toW * toWeight;
+        const Lanes scale = Simd::Select(normalize, one / Simd::Sqrt(x * x + y * y + z * z + w * w), one);
+        Simd::StoreInterleaved(&out->X, x * scale, y * scale, z * scale, w * scale);
     }
 
-    Vector3 Quaternion::GetUp(const Quaternion& rot)
+    template <BlendMode Mode>
+    static void BlendBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out)
     {
-        const auto glmQuat = glm::quat(rot.W, rot.X, rot.Y, rot.Z);
-        glm::vec3 objectUp = glm::vec3(0.0f, 1.0f, 0.0f); 
-        glm::vec3 result = glm::normalize(glm::rotate(glmQuat, objectUp));
-        return { result.x, result.y, result.z };
+        if (to.size() < from.size() || out.size() < from.size()) throw std::out_of_range("Span is smaller than the from span.");
+
+        Simd::ForEachLane(from.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            BlendLanes<Mode>(&from[index], &to[index], Lanes::Set(t), &out[index]);
+        });
     }
 
-    Quaternion Quaternion::FromAxisAngle(const Vector3& axis, float angle)
+    template <BlendMode Mode>
+    static void BlendBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out)
     {
-        glm::vec3 glmAxis = glm::normalize(glm::vec3(axis.X, axis.Y, axis.Z)); // Normalize the axis
-        glm::quat result = glm::angleAxis(Math::DegreesToRadians(angle), glmAxis); // Convert angle to radians
-        return { result.x, result.y, result.z, result.w };
+        if (to.size() < from.size() || t.size() < from.size() || out.size() < from.size()) throw std::out_of_range("Span is smaller than the from span.");
+
+        Simd::ForEachLane(from.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            BlendLanes<Mode>(&from[index], &to[index], Lanes::Load(t.data() + index), &out[index]);
+        });
     }
 
-    Quaternion Quaternion::FromEuler(float x, float y, float z)
+    /// <summary>
+    /// Rotates Lanes::Width vectors starting at index with v + 2w(q x v) + 2q x (q x v), the lane form of Multiply(Quaternion, Vector3).
+    /// </summary>
+    template <typename Lanes>
+    static void RotateLanes(Lanes x, Lanes y, Lanes z, Lanes w, const Vector3* vectors, Vector3* out)
     {
-        const auto result = glm::quat(glm::vec3(Math::DegreesToRadians(x), Math::DegreesToRadians(y), Math::DegreesToRadians(z)));
-        return {result.x, result.y, -result.z, result.w};
+        Lanes vx, vy, vz;
+        Simd::LoadInterleaved(&vectors->X, vx, vy, vz);
+
+        // Twice q x v, so the doubling is paid once instead of on both terms
+        const Lanes two = Lanes::Set(2.0f);
+        const Lanes tx = (y * vz - z * vy) * two;
+        const Lanes ty = (z * vx - x * vz) * two;
+        const Lanes tz = (x * vy - y * vx) * two;
+        Simd::StoreInterleaved(&out->X,
+            vx + w * tx + (y * tz - z * ty),
+            vy + w * ty + (z * tx - x * tz),
+            vz + w * tz + (x * ty - y * tx));
     }
 
     Vector3 Quaternion::ToEuler(const Quaternion& quaternion)
@@ -49,77 +127,131 @@ namespace Tbx
         return {result.x, result.y, result.z};
     }
 
-    bool Quaternion::IsEqualOrEquivalent(const Quaternion& lhs, const Quaternion& rhs, float epsilon)
+    void Quaternion::FromEulerBatch(std::span<const Vector3> euler, std::span<Quaternion> out)
     {
-        // If q and -q are both valid rotations, check both possibilities
-        bool directMatch =
-            std::abs(lhs.X - rhs.X) < epsilon &&
-            std::abs(lhs.Y - rhs.Y) < epsilon &&
-            std::abs(lhs.Z - rhs.Z) < epsilon &&
-            std::abs(lhs.W - rhs.W) < epsilon;
+        if (out.size() < euler.size()) throw std::out_of_range("Output span is smaller than the input span.");
 
-        bool negatedMatch =
-            std::abs(lhs.X + rhs.X) < epsilon &&
-            std::abs(lhs.Y + rhs.Y) < epsilon &&
-            std::abs(lhs.Z + rhs.Z) < epsilon &&
-            std::abs(lhs.W + rhs.W) < epsilon;
+        Simd::ForEachLane(euler.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            const float* in = &euler[index].X;
+            const Lanes toHalfRadians = Lanes::Set(Math::PI / 360.0f);
+            Lanes sx, cx, sy, cy, sz, cz;
+            Simd::SinCos(Lanes::Gather(in, Simd::Vector3Stride) * toHalfRadians, sx, cx);
+            Simd::SinCos(Lanes::Gather(in + 1, Simd::Vector3Stride) * toHalfRadians, sy, cy);
+            Simd::SinCos(Lanes::Gather(in + 2, Simd::Vector3Stride) * toHalfRadians, sz, cz);
 
-        return directMatch || negatedMatch;
+            // Same composition as glm's quat(vec3) constructor, with Z negated like FromEuler
+            const Lanes cycz = cy * cz;
+            const Lanes sysz = sy * sz;
+            const Lanes sycz = sy * cz;
+            const Lanes cysz = cy * sz;
+            Simd::StoreInterleaved(&out[index].X, sx * cycz - cx * sysz, cx * sycz + sx * cysz, sx * sycz - cx * cysz, cx * cycz + sx * sysz);
+        });
     }
 
-    std::string Quaternion::ToString() const
+    void Quaternion::ToEulerBatch(std::span<const Quaternion> quaternions, std::span<Vector3> out)
     {
-        return std::format("(X: {}, Y: {}, Z: {}, W: {})", X, Y, Z, W);
+        if (out.size() < quaternions.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        Simd::ForEachLane(quaternions.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            Lanes x, y, z, w;
+            Simd::LoadInterleaved(&quaternions[index].X, x, y, z, w);
+            const Lanes two = Lanes::Set(2.0f);
+            const Lanes toDegrees = Lanes::Set(180.0f / Math::PI);
+            const Lanes ww = w * w;
+            const Lanes xx = x * x;
+            const Lanes yy = y * y;
+            const Lanes zz = z * z;
+
+            // Same decomposition as glm::eulerAngles, including its fallback for the pitch singularity
+            const Lanes pitchY = two * (y * z + w * x);
+            const Lanes pitchX = ww - xx - yy + zz;
+            const Lanes epsilon = Lanes::Set(std::numeric_limits<float>::epsilon());
+            const Lanes singular = Simd::Less(Simd::Abs(pitchX), epsilon) & Simd::Less(Simd::Abs(pitchY), epsilon);
+            const Lanes pitch = Simd::Select(singular, two * Simd::ATan2(x, w), Simd::ATan2(pitchY, pitchX));
+            const Lanes yaw = Simd::ASin(Simd::Min(Simd::Max(two * (w * y - x * z), Lanes::Set(-1.0f)), Lanes::Set(1.0f)));
+            const Lanes roll = Simd::ATan2(two * (x * y + w * z), ww + xx - yy - zz);
+
+            float* result = &out[index].X;
+            (pitch * toDegrees).Scatter(result, Simd::Vector3Stride);
+            (yaw * toDegrees).Scatter(result + 1, Simd::Vector3Stride);
+            (roll * toDegrees).Scatter(result + 2, Simd::Vector3Stride);
+        });
+    }
+
+    void Quaternion::SlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out)
+    {
+        BlendBatch<BlendMode::Slerp>(from, to, t, out);
+    }
+
+    void Quaternion::SlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out)
+    {
+        BlendBatch<BlendMode::Slerp>(from, to, t, out);
     }
 
-    Quaternion Quaternion::Normalize(const Quaternion& quaternion)
+    void Quaternion::NlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out)
     {
-        const auto glmQuat = glm::quat(quaternion.W, quaternion.X, quaternion.Y, quaternion.Z);
-        const auto result = glm::normalize(glmQuat);
+        BlendBatch<BlendMode::Nlerp>(from, to, t, out);
+    }
 
-        return {result.x, result.y, result.z, result.w};
+    void Quaternion::NlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out)
+    {
+        BlendBatch<BlendMode::Nlerp>(from, to, t, out);
     }
 
-    Quaternion Quaternion::Add(const Quaternion& lhs, const Quaternion& rhs)
+    void Quaternion::FastSlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, float t, std::span<Quaternion> out)
     {
-        const auto glmL = glm::quat(lhs.W, lhs.X, lhs.Y, lhs.Z);
-        const auto glmR = glm::quat(rhs.W, rhs.X, rhs.Y, rhs.Z);
+        BlendBatch<BlendMode::FastSlerp>(from, to, t, out);
+    }
 
-        auto result = glmL + glmR;
-        return {result.x, result.y, result.z, result.w};
+    void Quaternion::FastSlerpBatch(std::span<const Quaternion> from, std::span<const Quaternion> to, std::span<const float> t, std::span<Quaternion> out)
+    {
+        BlendBatch<BlendMode::FastSlerp>(from, to, t, out);
     }
 
-    Quaternion Quaternion::Subtract(const Quaternion& lhs, const Quaternion& rhs)
+    void Quaternion::RotateBatch(const Quaternion& rotation, std::span<const Vector3> vectors, std::span<Vector3> out)
     {
-        const auto glmL = glm::quat(lhs.W, lhs.X, lhs.Y, lhs.Z);
-        const auto glmR = glm::quat(rhs.W, rhs.X, rhs.Y, rhs.Z);
+        if (out.size() < vectors.size()) throw std::out_of_range("Output span is smaller than the input span.");
 
-        auto result = glmL - glmR;
-        return {result.x, result.y, result.z, result.w};
+        Simd::ForEachLane(vectors.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            RotateLanes(Lanes::Set(rotation.X), Lanes::Set(rotation.Y), Lanes::Set(rotation.Z), Lanes::Set(rotation.W), &vectors[index], &out[index]);
+        });
     }
 
-    Quaternion Quaternion::Multiply(const Quaternion& lhs, const Quaternion& rhs)
+    void Quaternion::RotateBatch(std::span<const Quaternion> rotations, std::span<const Vector3> vectors, std::span<Vector3> out)
     {
-        const auto glmL = glm::quat(lhs.W, lhs.X, lhs.Y, lhs.Z);
-        const auto glmR = glm::quat(rhs.W, rhs.X, rhs.Y, rhs.Z);
+        if (rotations.size() < vectors.size() || out.size() < vectors.size()) throw std::out_of_range("Span is smaller than the vectors span.");
 
-        auto result = glmL * glmR;
-        return { result.x, result.y, result.z, result.w };
+        Simd::ForEachLane(vectors.size(), [&]<typename Lanes>(Lanes, size_t index)
+        {
+            Lanes x, y, z, w;
+            Simd::LoadInterleaved(&rotations[index].X, x, y, z, w);
+            RotateLanes(x, y, z, w, &vectors[index], &out[index]);
+        });
     }
 
-    Vector3 Quaternion::Multiply(const Quaternion& lhs, const Vector3& rhs)
+    bool Quaternion::IsEqualOrEquivalent(const Quaternion& lhs, const Quaternion& rhs, float epsilon)
     {
-        const auto glmL = glm::quat(lhs.W, lhs.X, lhs.Y, lhs.Z);
-        const auto glmR = glm::vec3(rhs.X, rhs.Y, rhs.Z);
-        auto result = glmL * glmR;
-        return { result.x, result.y, result.z };
+        // If q and -q are both valid rotations, check both possibilities
+        bool directMatch =
+            std::abs(lhs.X - rhs.X) < epsilon &&
+            std::abs(lhs.Y - rhs.Y) < epsilon &&
+            std::abs(lhs.Z - rhs.Z) < epsilon &&
+            std::abs(lhs.W - rhs.W) < epsilon;
+
+        bool negatedMatch =
+            std::abs(lhs.X + rhs.X) < epsilon &&
+            std::abs(lhs.Y + rhs.Y) < epsilon &&
+            std::abs(lhs.Z + rhs.Z) < epsilon &&
+            std::abs(lhs.W + rhs.W) < epsilon;
+
+        return directMatch || negatedMatch;
     }
 
-    Vector3 Quaternion::Multiply(const Vector3& lhs, const Quaternion& rhs)
+    std::string Quaternion::ToString() const
     {
-        const auto& glmL = glm::vec3(lhs.X, lhs.Y, lhs.Z);
-        const auto& glmR = glm::quat(rhs.W, rhs.X, rhs.Y, rhs.Z);
-        auto result = glmL * glmR;
-        return { result.x, result.y, result.z };
+        return std::format("(X: {}, Y: {}, Z: {}, W: {})", X, Y, Z, W);
     }
 }
@@ -0,0 +1,410 @@
+#pragma once
+#include "Tbx/Math/Simd.h"
+#include "Tbx/Math/Int.h"
+#include "Tbx/Math/Vectors.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+// Lane wrappers used to write batch kernels once and instantiate them for each instruction set.
+// Float1 is the scalar fallback, also used for the tail of a batch that doesn't fill a whole register.
+// Comparisons return a lane mask (all bits set when true) that can be combined with & and | and read with MoveMask.
+
+namespace Tbx::Simd
+{
+    struct Float1
+    {
+        static constexpr size_t Width = 1;
+
+        static Float1 Load(const float* ptr) { return { *ptr }; }
+        static Float1 Set(float value) { return { value }; }
+        void Store(float* ptr) const { *ptr = Value; }
+
+        friend Float1 operator + (Float1 lhs, Float1 rhs) { return { lhs.Value + rhs.Value }; }
+        friend Float1 operator - (Float1 lhs, Float1 rhs) { return { lhs.Value - rhs.Value }; }
+        friend Float1 operator * (Float1 lhs, Float1 rhs) { return { lhs.Value * rhs.Value }; }
+        friend Float1 operator / (Float1 lhs, Float1 rhs) { return { lhs.Value / rhs.Value }; }
+        friend Float1 operator & (Float1 lhs, Float1 rhs) { return FromBits(std::bit_cast<uint32_t>(lhs.Value) & std::bit_cast<uint32_t>(rhs.Value)); }
+        friend Float1 operator | (Float1 lhs, Float1 rhs) { return FromBits(std::bit_cast<uint32_t>(lhs.Value) | std::bit_cast<uint32_t>(rhs.Value)); }
+
+        static Float1 Gather(const float* ptr, size_t) { return { *ptr }; }
+        static Float1 Gather(const float* ptr, const uint32* indices, size_t stride) { return { ptr[indices[0] * stride] }; }
+        void Scatter(float* ptr, size_t) const { *ptr = Value; }
+        static Float1 FromBits(uint32_t bits) { return { std::bit_cast<float>(bits) }; }
+        static Float1 FromBool(bool value) { return FromBits(value ? 0xFFFFFFFFu : 0u); }
+        static Float1 TrueMask() { return FromBits(0xFFFFFFFFu); }
+        static Float1 LoadInt(const int32_t* ptr) { return { static_cast<float>(*ptr) }; }
+        static Float1 LoadUInt16(const uint16_t* ptr) { return { static_cast<float>(*ptr) }; }
+        // Rounds to the nearest integer, ties to even like the SIMD conversions
+        void StoreInt(int32_t* ptr) const { *ptr = static_cast<int32_t>(std::nearbyint(Value)); }
+
+        float Value;
+    };
+
+    inline Float1 Min(Float1 lhs, Float1 rhs) { return { lhs.Value < rhs.Value ? lhs.Value : rhs.Value }; }
+    inline Float1 Max(Float1 lhs, Float1 rhs) { return { lhs.Value > rhs.Value ? lhs.Value : rhs.Value }; }
+    inline Float1 Sqrt(Float1 value) { return { std::sqrt(value.Value) }; }
+    inline Float1 Abs(Float1 value) { return { std::fabs(value.Value) }; }
+    inline Float1 Less(Float1 lhs, Float1 rhs) { return Float1::FromBool(lhs.Value < rhs.Value); }
+    inline Float1 LessEqual(Float1 lhs, Float1 rhs) { return Float1::FromBool(lhs.Value <= rhs.Value); }
+    inline Float1 Greater(Float1 lhs, Float1 rhs) { return Float1::FromBool(lhs.Value > rhs.Value); }
+    inline Float1 GreaterEqual(Float1 lhs, Float1 rhs) { return Float1::FromBool(lhs.Value >= rhs.Value); }
+    inline uint32_t MoveMask(Float1 mask) { return std::bit_cast<uint32_t>(mask.Value) >> 31; }
+    /// <summary>
+    /// Floats of at least 2^31 are already whole and NaN has nothing to truncate, both are returned as they are
+    /// instead of going through an int32_t conversion that is undefined for them. Float4 and Float8 do the same.
+    /// </summary>
+    inline Float1 Truncate(Float1 value) { return std::fabs(value.Value) < 2147483648.0f ? Float1{ static_cast<float>(static_cast<int32_t>(value.Value)) } : value; }
+    inline Float1 Select(Float1 mask, Float1 ifTrue, Float1 ifFalse) { return (mask & ifTrue) | Float1::FromBits(~std::bit_cast<uint32_t>(mask.Value) & std::bit_cast<uint32_t>(ifFalse.Value)); }
+    inline void LoadInterleaved(const float* ptr, Float1& x, Float1& y, Float1& z, Float1& w, size_t = 4) { x = { ptr[0] }; y = { ptr[1] }; z = { ptr[2] }; w = { ptr[3] }; }
+    inline void StoreInterleaved(float* ptr, Float1 x, Float1 y, Float1 z, Float1 w, size_t = 4) { ptr[0] = x.Value; ptr[1] = y.Value; ptr[2] = z.Value; ptr[3] = w.Value; }
+    inline void LoadInterleaved(const float* ptr, Float1& x, Float1& y, Float1& z) { x = { ptr[0] }; y = { ptr[1] }; z = { ptr[2] }; }
+    inline void StoreInterleaved(float* ptr, Float1 x, Float1 y, Float1 z) { ptr[0] = x.Value; ptr[1] = y.Value; ptr[2] = z.Value; }
+
+#ifdef TBX_MATH_SSE2
+    struct Float4
+    {
+        static constexpr size_t Width = 4;
+
+        static Float4 Load(const float* ptr) { return { _mm_loadu_ps(ptr) }; }
+        static Float4 Set(float value) { return { _mm_set1_ps(value) }; }
+        static Float4 TrueMask() { return { _mm_castsi128_ps(_mm_set1_epi32(-1)) }; }
+        void Store(float* ptr) const { _mm_storeu_ps(ptr, Value); }
+        /// <summary>
+        /// Loads Width 32 bit integers and converts them to floats. The integers are inserted one by one, since they are usually
+        /// unpacked by scalar stores just before and a single 16 byte load of them would stall on store forwarding.
+        /// </summary>
+        static Float4 LoadInt(const int32_t* ptr) { return { _mm_cvtepi32_ps(_mm_setr_epi32(ptr[0], ptr[1], ptr[2], ptr[3])) }; }
+        /// <summary>
+        /// Loads Width unsigned 16 bit integers and converts them to floats.
+        /// </summary>
+        static Float4 LoadUInt16(const uint16_t* ptr)
+        {
+            return { _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr)), _mm_setzero_si128())) };
+        }
+        /// <summary>
+        /// Rounds every lane to the nearest integer, ties to even, and stores Width 32 bit integers.
+        /// </summary>
+        void StoreInt(int32_t* ptr) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), _mm_cvtps_epi32(Value)); }
+
+        friend Float4 operator + (Float4 lhs, Float4 rhs) { return { _mm_add_ps(lhs.Value, rhs.Value) }; }
+        friend Float4 operator - (Float4 lhs, Float4 rhs) { return { _mm_sub_ps(lhs.Value, rhs.Value) }; }
+        friend Float4 operator * (Float4 lhs, Float4 rhs) { return { _mm_mul_ps(lhs.Value, rhs.Value) }; }
+        friend Float4 operator / (Float4 lhs, Float4 rhs) { return { _mm_div_ps(lhs.Value, rhs.Value) }; }
+        friend Float4 operator & (Float4 lhs, Float4 rhs) { return { _mm_and_ps(lhs.Value, rhs.Value) }; }
+        friend Float4 operator | (Float4 lhs, Float4 rhs) { return { _mm_or_ps(lhs.Value, rhs.Value) }; }
+
+        /// <summary>
+        /// Loads one float every stride floats, i.e. the same Mat4x4 element from consecutive matrices.
+        /// </summary>
+        static Float4 Gather(const float* ptr, size_t stride) { return { _mm_setr_ps(ptr[0], ptr[stride], ptr[stride * 2], ptr[stride * 3]) }; }
+        /// <summary>
+        /// Loads ptr[indices[lane] * stride] for each lane, i.e. the same Mat4x4 element from the matrices the indices pick.
+        /// </summary>
+        static Float4 Gather(const float* ptr, const uint32* indices, size_t stride)
+        {
+            return { _mm_setr_ps(ptr[indices[0] * stride], ptr[indices[1] * stride], ptr[indices[2] * stride], ptr[indices[3] * stride]) };
+        }
+        /// <summary>
+        /// Stores one float every stride floats, the inverse of Gather.
+        /// </summary>
+        void Scatter(float* ptr, size_t stride) const
+        {
+            alignas(16) float values[Width];
+            _mm_store_ps(values, Value);
+            for (size_t lane = 0; lane < Width; lane++)
+            {
+                ptr[lane * stride] = values[lane];
+            }
+        }
+
+        __m128 Value;
+    };
+
+    inline Float4 Min(Float4 lhs, Float4 rhs) { return { _mm_min_ps(lhs.Value, rhs.Value) }; }
+    inline Float4 Max(Float4 lhs, Float4 rhs) { return { _mm_max_ps(lhs.Value, rhs.Value) }; }
+    inline Float4 Sqrt(Float4 value) { return { _mm_sqrt_ps(value.Value) }; }
+    inline Float4 Abs(Float4 value) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), value.Value) }; }
+    inline Float4 Less(Float4 lhs, Float4 rhs) { return { _mm_cmplt_ps(lhs.Value, rhs.Value) }; }
+    inline Float4 LessEqual(Float4 lhs, Float4 rhs) { return { _mm_cmple_ps(lhs.Value, rhs.Value) }; }
+    inline Float4 Greater(Float4 lhs, Float4 rhs) { return { _mm_cmpgt_ps(lhs.Value, rhs.Value) }; }
+    inline Float4 GreaterEqual(Float4 lhs, Float4 rhs) { return { _mm_cmpge_ps(lhs.Value, rhs.Value) }; }
+    inline uint32_t MoveMask(Float4 mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask.Value)); }
+    /// <summary>
+    /// Rounds every lane towards zero. Lanes of at least 2^31 and NaNs are returned as they are, since the cvttps
+    /// conversion would turn them into INT_MIN.
+    /// </summary>
+    inline Float4 Truncate(Float4 value)
+    {
+        const __m128 small = _mm_cmplt_ps(Abs(value).Value, _mm_set1_ps(2147483648.0f));
+        const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(value.Value));
+        return { _mm_or_ps(_mm_and_ps(small, truncated), _mm_andnot_ps(small, value.Value)) };
+    }
+    inline Float4 Select(Float4 mask, Float4 ifTrue, Float4 ifFalse) { return { _mm_or_ps(_mm_and_ps(mask.Value, ifTrue.Value), _mm_andnot_ps(mask.Value, ifFalse.Value)) }; }
+
+    /// <summary>
+    /// Loads Width 4 float structs (i.e. quaternions) stride floats apart and transposes them so each lane type holds one component.
+    /// </summary>
+    inline void LoadInterleaved(const float* ptr, Float4& x, Float4& y, Float4& z, Float4& w, size_t stride = 4)
+    {
+        __m128 row0 = _mm_loadu_ps(ptr);
+        __m128 row1 = _mm_loadu_ps(ptr + stride);
+        __m128 row2 = _mm_loadu_ps(ptr + stride * 2);
+        __m128 row3 = _mm_loadu_ps(ptr + stride * 3);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        x = { row0 };
+        y = { row1 };
+        z = { row2 };
+        w = { row3 };
+    }
+
+    /// <summary>
+    /// Transposes one component per lane type back into Width 4 float structs stride floats apart, the inverse of LoadInterleaved.
+    /// </summary>
+    inline void StoreInterleaved(float* ptr, Float4 x, Float4 y, Float4 z, Float4 w, size_t stride = 4)
+    {
+        _MM_TRANSPOSE4_PS(x.Value, y.Value, z.Value, w.Value);
+        _mm_storeu_ps(ptr, x.Value);
+        _mm_storeu_ps(ptr + stride, y.Value);
+        _mm_storeu_ps(ptr + stride * 2, z.Value);
+        _mm_storeu_ps(ptr + stride * 3, w.Value);
+    }
+
+    /// <summary>
+    /// Loads Width tightly packed 3 float structs (i.e. Vector3) with three 16 byte loads and shuffles them so each lane type holds one component.
+    /// </summary>
+    inline void LoadInterleaved(const float* ptr, Float4& x, Float4& y, Float4& z)
+    {
+        // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+        const __m128 block0 = _mm_loadu_ps(ptr);
+        const __m128 block1 = _mm_loadu_ps(ptr + 4);
+        const __m128 block2 = _mm_loadu_ps(ptr + 8);
+        const __m128 xy23 = _mm_shuffle_ps(block1, block2, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m128 yy01 = _mm_shuffle_ps(block0, block1, _MM_SHUFFLE(0, 0, 1, 1));
+        const __m128 zz01 = _mm_shuffle_ps(block0, block1, _MM_SHUFFLE(1, 1, 2, 2));
+        const __m128 zz23 = _mm_shuffle_ps(block2, block2, _MM_SHUFFLE(3, 3, 0, 0));
+        x = { _mm_shuffle_ps(block0, xy23, _MM_SHUFFLE(2, 0, 3, 0)) };
+        y = { _mm_shuffle_ps(yy01, xy23, _MM_SHUFFLE(3, 1, 2, 0)) };
+        z = { _mm_shuffle_ps(zz01, zz23, _MM_SHUFFLE(2, 0, 2, 0)) };
+    }
+
+    /// <summary>
+    /// Shuffles one component per lane type back into Width tightly packed 3 float structs with three 16 byte stores, the inverse of LoadInterleaved.
+    /// </summary>
+    inline void StoreInterleaved(float* ptr, Float4 x, Float4 y, Float4 z)
+    {
+        const __m128 xy01 = _mm_unpacklo_ps(x.Value, y.Value);
+        const __m128 xy23 = _mm_unpackhi_ps(x.Value, y.Value);
+        const __m128 zzxx = _mm_shuffle_ps(z.Value, xy01, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 yyzz = _mm_shuffle_ps(xy01, z.Value, _MM_SHUFFLE(1, 1, 3, 3));
+        const __m128 zzxy = _mm_shuffle_ps(z.Value, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm_storeu_ps(ptr, _mm_shuffle_ps(xy01, zzxx, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(ptr + 4, _mm_shuffle_ps(yyzz, xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(ptr + 8, _mm_shuffle_ps(zzxy, zzxy, _MM_SHUFFLE(1, 3, 2, 0)));
+    }
+#endif
+
+#ifdef TBX_MATH_AVX2
+    struct Float8
+    {
+        static constexpr size_t Width = 8;
+
+        static Float8 Load(const float* ptr) { return { _mm256_loadu_ps(ptr) }; }
+        static Float8 Set(float value) { return { _mm256_set1_ps(value) }; }
+        static Float8 TrueMask() { return { _mm256_castsi256_ps(_mm256_set1_epi32(-1)) }; }
+        void Store(float* ptr) const { _mm256_storeu_ps(ptr, Value); }
+        /// <summary>
+        /// Loads Width 32 bit integers and converts them to floats, inserting them one by one like Float4::LoadInt.
+        /// </summary>
+        static Float8 LoadInt(const int32_t* ptr)
+        {
+            return { _mm256_cvtepi32_ps(_mm256_setr_epi32(ptr[0], ptr[1], ptr[2], ptr[3], ptr[4], ptr[5], ptr[6], ptr[7])) };
+        }
+        /// <summary>
+        /// Loads Width unsigned 16 bit integers and converts them to floats.
+        /// </summary>
+        static Float8 LoadUInt16(const uint16_t* ptr) { return { _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)))) }; }
+        /// <summary>
+        /// Rounds every lane to the nearest integer, ties to even, and stores Width 32 bit integers.
+        /// </summary>
+        void StoreInt(int32_t* ptr) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), _mm256_cvtps_epi32(Value)); }
+
+        Float4 Low() const { return { _mm256_castps256_ps128(Value) }; }
+        Float4 High() const { return { _mm256_extractf128_ps(Value, 1) }; }
+
+        friend Float8 operator + (Float8 lhs, Float8 rhs) { return { _mm256_add_ps(lhs.Value, rhs.Value) }; }
+        friend Float8 operator - (Float8 lhs, Float8 rhs) { return { _mm256_sub_ps(lhs.Value, rhs.Value) }; }
+        friend Float8 operator * (Float8 lhs, Float8 rhs) { return { _mm256_mul_ps(lhs.Value, rhs.Value) }; }
+        friend Float8 operator / (Float8 lhs, Float8 rhs) { return { _mm256_div_ps(lhs.Value, rhs.Value) }; }
+        friend Float8 operator & (Float8 lhs, Float8 rhs) { return { _mm256_and_ps(lhs.Value, rhs.Value) }; }
+        friend Float8 operator | (Float8 lhs, Float8 rhs) { return { _mm256_or_ps(lhs.Value, rhs.Value) }; }
+
+        /// <summary>
+        /// Loads one float every stride floats, i.e. the same Mat4x4 element from consecutive matrices.
+        /// </summary>
+        static Float8 Gather(const float* ptr, size_t stride)
+        {
+            return { _mm256_setr_ps(
+                ptr[0], ptr[stride], ptr[stride * 2], ptr[stride * 3],
+                ptr[stride * 4], ptr[stride * 5], ptr[stride * 6], ptr[stride * 7]) };
+        }
+        /// <summary>
+        /// Loads ptr[indices[lane] * stride] for each lane, i.e. the same Mat4x4 element from the matrices the indices pick.
+        /// </summary>
+        static Float8 Gather(const float* ptr, const uint32* indices, size_t stride)
+        {
+            const __m256i offsets = _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), _mm256_set1_epi32(static_cast<int>(stride)));
+            return { _mm256_i32gather_ps(ptr, offsets, 4) };
+        }
+        /// <summary>
+        /// Stores one float every stride floats, the inverse of Gather.
+        /// </summary>
+        void Scatter(float* ptr, size_t stride) const
+        {
+            alignas(32) float values[Width];
+            _mm256_store_ps(values, Value);
+            for (size_t lane = 0; lane < Width; lane++)
+            {
+                ptr[lane * stride] = values[lane];
+            }
+        }
+
+        __m256 Value;
+    };
+
+    inline Float8 Min(Float8 lhs, Float8 rhs) { return { _mm256_min_ps(lhs.Value, rhs.Value) }; }
+    inline Float8 Max(Float8 lhs, Float8 rhs) { return { _mm256_max_ps(lhs.Value, rhs.Value) }; }
+    inline Float8 Sqrt(Float8 value) { return { _mm256_sqrt_ps(value.Value) }; }
+    inline Float8 Abs(Float8 value) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value.Value) }; }
+    inline Float8 Less(Float8 lhs, Float8 rhs) { return { _mm256_cmp_ps(lhs.Value, rhs.Value, _CMP_LT_OQ) }; }
+    inline Float8 LessEqual(Float8 lhs, Float8 rhs) { return { _mm256_cmp_ps(lhs.Value, rhs.Value, _CMP_LE_OQ) }; }
+    inline Float8 Greater(Float8 lhs, Float8 rhs) { return { _mm256_cmp_ps(lhs.Value, rhs.Value, _CMP_GT_OQ) }; }
+    inline Float8 GreaterEqual(Float8 lhs, Float8 rhs) { return { _mm256_cmp_ps(lhs.Value, rhs.Value, _CMP_GE_OQ) }; }
+    inline uint32_t MoveMask(Float8 mask) { return static_cast<uint32_t>(_mm256_movemask_ps(mask.Value)); }
+    // The rounding instruction already returns lanes of at least 2^31 and NaNs as they are
+    inline Float8 Truncate(Float8 value) { return { _mm256_round_ps(value.Value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) }; }
+    inline Float8 Select(Float8 mask, Float8 ifTrue, Float8 ifFalse) { return { _mm256_blendv_ps(ifFalse.Value, ifTrue.Value, mask.Value) }; }
+
+    /// <summary>
+    /// Loads Width 4 float structs (i.e. quaternions) stride floats apart and transposes them so each lane type holds one component.
+    /// </summary>
+    inline void LoadInterleaved(const float* ptr, Float8& x, Float8& y, Float8& z, Float8& w, size_t stride = 4)
+    {
+        // Pair struct i with struct i + 4 so the rest is a 4x4 transpose within each 128 bit half
+        const __m256 row0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr)), _mm_loadu_ps(ptr + stride * 4), 1);
+        const __m256 row1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + stride)), _mm_loadu_ps(ptr + stride * 5), 1);
+        const __m256 row2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + stride * 2)), _mm_loadu_ps(ptr + stride * 6), 1);
+        const __m256 row3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(ptr + stride * 3)), _mm_loadu_ps(ptr + stride * 7), 1);
+
+        const __m256 xy01 = _mm256_unpacklo_ps(row0, row1);
+        const __m256 xy23 = _mm256_unpacklo_ps(row2, row3);
+        const __m256 zw01 = _mm256_unpackhi_ps(row0, row1);
+        const __m256 zw23 = _mm256_unpackhi_ps(row2, row3);
+        x = { _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0)) };
+        y = { _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2)) };
+        z = { _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0)) };
+        w = { _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2)) };
+    }
+
+    /// <summary>
+    /// Transposes one component per lane type back into Width 4 float structs stride floats apart, the inverse of LoadInterleaved.
+    /// </summary>
+    inline void StoreInterleaved(float* ptr, Float8 x, Float8 y, Float8 z, Float8 w, size_t stride = 4)
+    {
+        const __m256 xy01 = _mm256_unpacklo_ps(x.Value, y.Value);
+        const __m256 xy23 = _mm256_unpackhi_ps(x.Value, y.Value);
+        const __m256 zw01 = _mm256_unpacklo_ps(z.Value, w.Value);
+        const __m256 zw23 = _mm256_unpackhi_ps(z.Value, w.Value);
+        const __m256 row0 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 row1 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 row2 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 row3 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+
+        // Each row holds struct i in its low half and struct i + 4 in its high half
+        _mm_storeu_ps(ptr, _mm256_castps256_ps128(row0));
+        _mm_storeu_ps(ptr + stride, _mm256_castps256_ps128(row1));
+        _mm_storeu_ps(ptr + stride * 2, _mm256_castps256_ps128(row2));
+        _mm_storeu_ps(ptr + stride * 3, _mm256_castps256_ps128(row3));
+        _mm_storeu_ps(ptr + stride * 4, _mm256_extractf128_ps(row0, 1));
+        _mm_storeu_ps(ptr + stride * 5, _mm256_extractf128_ps(row1, 1));
+        _mm_storeu_ps(ptr + stride * 6, _mm256_extractf128_ps(row2, 1));
+        _mm_storeu_ps(ptr + stride * 7, _mm256_extractf128_ps(row3, 1));
+    }
+
+    /// <summary>
+    /// Loads Width tightly packed 3 float structs (i.e. Vector3), the first four in the low half of each lane type and the rest in the high half.
+    /// </summary>
+    inline void LoadInterleaved(const float* ptr, Float8& x, Float8& y, Float8& z)
+    {
+        Float4 lowX, lowY, lowZ, highX, highY, highZ;
+        LoadInterleaved(ptr, lowX, lowY, lowZ);
+        LoadInterleaved(ptr + 12, highX, highY, highZ);
+        x = { _mm256_insertf128_ps(_mm256_castps128_ps256(lowX.Value), highX.Value, 1) };
+        y = { _mm256_insertf128_ps(_mm256_castps128_ps256(lowY.Value), highY.Value, 1) };
+        z = { _mm256_insertf128_ps(_mm256_castps128_ps256(lowZ.Value), highZ.Value, 1) };
+    }
+
+    /// <summary>
+    /// Stores one component per lane type back into Width tightly packed 3 float structs, the inverse of LoadInterleaved.
+    /// </summary>
+    inline void StoreInterleaved(float* ptr, Float8 x, Float8 y, Float8 z)
+    {
+        StoreInterleaved(ptr, x.Low(), y.Low(), z.Low());
+        StoreInterleaved(ptr + 12, x.High(), y.High(), z.High());
+    }
+#endif
+
+    /// <summary>
+    /// The widest lane type available for the target instruction set.
+    /// </summary>
+#if defined(TBX_MATH_AVX2)
+    using FloatN = Float8;
+#elif defined(TBX_MATH_SSE2)
+    using FloatN = Float4;
+#else
+    using FloatN = Float1;
+#endif
+
+    /// <summary>
+    /// Distance in floats between the same component of two consecutive vectors in a span of Vector3, for Gather and Scatter.
+    /// </summary>
+    inline constexpr size_t Vector3Stride = sizeof(Vector3) / sizeof(float);
+    static_assert(Vector3Stride == 3, "Gathering and scattering components assumes tightly packed vectors.");
+
+    /// <summary>
+    /// Runs a kernel over count elements, FloatN::Width at a time with a Float1 tail.
+    /// Kernel is called with a lane type instance and the index of the first element.
+    /// </summary>
+    template <typename Kernel>
+    void ForEachLane(size_t count, Kernel&& kernel)
+    {
+        size_t index = 0;
+        for (; index + FloatN::Width <= count; index += FloatN::Width)
+        {
+            kernel(FloatN(), index);
+        }
+        for (; index < count; index++)
+        {
+            kernel(Float1(), index);
+        }
+    }
+
+    /// <summary>
+    /// Runs a test over count elements, FloatN::Width at a time with a Float1 tail, and packs the resulting lane masks
+    /// into a bitmask with one bit per element. Test is called with a lane type instance and the index of the first element.
+    /// The mask must hold at least (count + 63) / 64 words.
+    /// </summary>
+    template <typename Test>
+    void WriteBitMask(size_t count, uint64* outMask, Test&& test)
+    {
+        std::fill(outMask, outMask + (count + 63) / 64, 0ull);
+
+        // The SIMD width divides 64 so a full register never straddles two mask words
+        ForEachLane(count, [outMask, &test]<typename Lanes>(Lanes lanes, size_t index)
+        {
+            outMask[index / 64] |= uint64(MoveMask(test(lanes, index))) << (index % 64);
+        });
+    }
+}
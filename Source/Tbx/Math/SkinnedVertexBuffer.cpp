@@ -0,0 +1,215 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/SkinnedVertexBuffer.h"
+#include "Tbx/Math/SimdLanes.h"
+
+namespace Tbx
+{
+    static constexpr size_t MatrixStride = sizeof(Mat4x4) / sizeof(float);
+    static_assert(MatrixStride == 16, "Gathering matrix elements assumes tightly packed matrices.");
+
+    /// <summary>
+    /// The vertices each thread skins at a time, a multiple of every lane width.
+    /// </summary>
+    static constexpr size_t SkinGrainSize = 2048;
+
+    /// <summary>
+    /// The column major elements of the affine part of a matrix, the bottom row of a skin matrix is always (0, 0, 0, 1).
+    /// </summary>
+    static constexpr size_t AffineElements[12] = { 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14 };
+
+    /// <summary>
+    /// Skins Lanes::Width vertices starting at index.
+    /// </summary>
+    template <typename Lanes>
+    static void SkinLanes(const SkinnedVertexBuffer& buffer, const float* skinMatrices, size_t index, Vector3* outPositions, Vector3* outNormals)
+    {
+        // Blend the affine part of the influencing skin matrices by their weights
+        Lanes blended[12];
+        for (size_t influence = 0; influence < SkinnedVertexBuffer::MaxInfluences; influence++)
+        {
+            const uint32* joints = buffer.GetJoints(influence).data() + index;
+            const Lanes weight = Lanes::Load(buffer.GetWeights(influence).data() + index);
+            for (size_t element = 0; element < 12; element++)
+            {
+                const Lanes value = weight * Lanes::Gather(skinMatrices + AffineElements[element], joints, MatrixStride);
+                blended[element] = influence == 0 ? value : blended[element] + value;
+            }
+        }
+
+        const Lanes px = Lanes::Load(buffer.GetPositionX().data() + index);
+        const Lanes py = Lanes::Load(buffer.GetPositionY().data() + index);
+        const Lanes pz = Lanes::Load(buffer.GetPositionZ().data() + index);
+        (blended[0] * px + blended[3] * py + blended[6] * pz + blended[9]).Scatter(&outPositions[index].X, Simd::Vector3Stride);
+        (blended[1] * px + blended[4] * py + blended[7] * pz + blended[10]).Scatter(&outPositions[index].Y, Simd::Vector3Stride);
+        (blended[2] * px + blended[5] * py + blended[8] * pz + blended[11]).Scatter(&outPositions[index].Z, Simd::Vector3Stride);
+
+        const Lanes nx = Lanes::Load(buffer.GetNormalX().data() + index);
+        const Lanes ny = Lanes::Load(buffer.GetNormalY().data() + index);
+        const Lanes nz = Lanes::Load(buffer.GetNormalZ().data() + index);
+        // The upper 3x3 of the blend stands in for its inverse transpose, see the limitation documented on Skin
+        const Lanes x = blended[0] * nx + blended[3] * ny + blended[6] * nz;
+        const Lanes y = blended[1] * nx + blended[4] * ny + blended[7] * nz;
+        const Lanes z = blended[2] * nx + blended[5] * ny + blended[8] * nz;
+
+        // Blending shortens the normal, zero normals stay zero
+        const Lanes scale = Lanes::Set(1.0f) / Simd::Sqrt(Simd::Max(x * x + y * y + z * z, Lanes::Set(1e-30f)));
+        (x * scale).Scatter(&outNormals[index].X, Simd::Vector3Stride);
+        (y * scale).Scatter(&outNormals[index].Y, Simd::Vector3Stride);
+        (z * scale).Scatter(&outNormals[index].Z, Simd::Vector3Stride);
+    }
+
+    SkinnedVertexBuffer::SkinnedVertexBuffer(std::span<const Vertex> vertices)
+    {
+        Reserve(vertices.size());
+        for (const auto& vertex : vertices)
+        {
+            Add(vertex);
+        }
+    }
+
+    size_t SkinnedVertexBuffer::Add(const Vertex& vertex)
+    {
+        // Every array gets room before any of them grows, so a failed allocation throws while they are still the same size
+        const size_t size = Size();
+        const size_t capacity = std::max<size_t>(size * 2, 16);
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_normalX, &_normalY, &_normalZ })
+        {
+            if (array->capacity() == size) array->reserve(capacity);
+        }
+        for (size_t influence = 0; influence < MaxInfluences; influence++)
+        {
+            if (_joints[influence].capacity() == size) _joints[influence].reserve(capacity);
+            if (_weights[influence].capacity() == size) _weights[influence].reserve(capacity);
+        }
+
+        _positionX.push_back(vertex.Position.X);
+        _positionY.push_back(vertex.Position.Y);
+        _positionZ.push_back(vertex.Position.Z);
+        _normalX.push_back(vertex.Normal.X);
+        _normalY.push_back(vertex.Normal.Y);
+        _normalZ.push_back(vertex.Normal.Z);
+        for (size_t influence = 0; influence < MaxInfluences; influence++)
+        {
+            _joints[influence].push_back(vertex.Joints[influence]);
+            _weights[influence].push_back(vertex.Weights[influence]);
+        }
+        _maxJoint = std::max(_maxJoint, *std::max_element(vertex.Joints.begin(), vertex.Joints.end()));
+        return Size() - 1;
+    }
+
+    SkinnedVertexBuffer::Vertex SkinnedVertexBuffer::Get(size_t index) const
+    {
+        if (index >= Size()) throw std::out_of_range("Vertex index is out of range.");
+
+        Vertex vertex;
+        vertex.Position = { _positionX[index], _positionY[index], _positionZ[index] };
+        vertex.Normal = { _normalX[index], _normalY[index], _normalZ[index] };
+        for (size_t influence = 0; influence < MaxInfluences; influence++)
+        {
+            vertex.Joints[influence] = _joints[influence][index];
+            vertex.Weights[influence] = _weights[influence][index];
+        }
+        return vertex;
+    }
+
+    void SkinnedVertexBuffer::Set(size_t index, const Vertex& vertex)
+    {
+        if (index >= Size()) throw std::out_of_range("Vertex index is out of range.");
+
+        // Overwriting a vertex that held the largest joint with smaller ones may lower it, which needs a scan of every joint
+        uint32 oldMaxJoint = 0;
+        for (const IndexArray& joints : _joints)
+        {
+            oldMaxJoint = std::max(oldMaxJoint, joints[index]);
+        }
+        const uint32 newMaxJoint = *std::max_element(vertex.Joints.begin(), vertex.Joints.end());
+
+        _positionX[index] = vertex.Position.X;
+        _positionY[index] = vertex.Position.Y;
+        _positionZ[index] = vertex.Position.Z;
+        _normalX[index] = vertex.Normal.X;
+        _normalY[index] = vertex.Normal.Y;
+        _normalZ[index] = vertex.Normal.Z;
+        for (size_t influence = 0; influence < MaxInfluences; influence++)
+        {
+            _joints[influence][index] = vertex.Joints[influence];
+            _weights[influence][index] = vertex.Weights[influence];
+        }
+
+        if (newMaxJoint >= _maxJoint)
+        {
+            _maxJoint = newMaxJoint;
+        }
+        else if (oldMaxJoint == _maxJoint)
+        {
+            _maxJoint = 0;
+            for (const IndexArray& joints : _joints)
+            {
+                _maxJoint = std::max(_maxJoint, *std::max_element(joints.begin(), joints.end()));
+            }
+        }
+    }
+
+    void SkinnedVertexBuffer::Reserve(size_t count)
+    {
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_normalX, &_normalY, &_normalZ })
+        {
+            array->reserve(count);
+        }
+        for (size_t influence = 0; influence < MaxInfluences; influence++)
+        {
+            _joints[influence].reserve(count);
+            _weights[influence].reserve(count);
+        }
+    }
+
+    void SkinnedVertexBuffer::Clear()
+    {
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_normalX, &_normalY, &_normalZ })
+        {
+            array->clear();
+        }
+        for (size_t influence = 0; influence < MaxInfluences; influence++)
+        {
+            _joints[influence].clear();
+            _weights[influence].clear();
+        }
+        _maxJoint = 0;
+    }
+
+    void SkinnedVertexBuffer::ValidateSkin(std::span<const Mat4x4> skinMatrices, std::span<Vector3> outPositions, std::span<Vector3> outNormals) const
+    {
+        if (outPositions.size() < Size() || outNormals.size() < Size()) throw std::out_of_range("Output span is smaller than the vertex buffer.");
+
+        // The kernel gathers matrices without bounds checks, so the largest joint must have a skin matrix
+        if (Size() != 0 && _maxJoint >= skinMatrices.size()) throw std::out_of_range("Joint index has no skin matrix.");
+    }
+
+    void SkinnedVertexBuffer::SkinRange(const Mat4x4* skinMatrices, size_t begin, size_t end, Vector3* outPositions, Vector3* outNormals) const
+    {
+        const float* matrices = skinMatrices->Values.data();
+        Simd::ForEachLane(end - begin, [&]<typename Lanes>(Lanes, size_t offset)
+        {
+            SkinLanes<Lanes>(*this, matrices, begin + offset, outPositions, outNormals);
+        });
+    }
+
+    void SkinnedVertexBuffer::Skin(std::span<const Mat4x4> skinMatrices, std::span<Vector3> outPositions, std::span<Vector3> outNormals) const
+    {
+        ValidateSkin(skinMatrices, outPositions, outNormals);
+        if (Size() == 0) return;
+
+        SkinRange(skinMatrices.data(), 0, Size(), outPositions.data(), outNormals.data());
+    }
+
+    void SkinnedVertexBuffer::Skin(std::span<const Mat4x4> skinMatrices, std::span<Vector3> outPositions, std::span<Vector3> outNormals, ThreadPool& pool) const
+    {
+        ValidateSkin(skinMatrices, outPositions, outNormals);
+        if (Size() == 0) return;
+
+        pool.ParallelFor(Size(), SkinGrainSize, [&](size_t begin, size_t end)
+        {
+            SkinRange(skinMatrices.data(), begin, end, outPositions.data(), outNormals.data());
+        });
+    }
+}
@@ -0,0 +1,91 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/ThreadPool.h"
+
+namespace Tbx
+{
+    ThreadPool::ThreadPool(size_t threadCount)
+    {
+        const size_t workerCount = threadCount > 1 ? threadCount - 1 : 0;
+        _workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; i++)
+        {
+            _workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _wake.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& work)
+    {
+        if (count == 0) return;
+        if (grainSize == 0) grainSize = 1;
+
+        // Not worth waking the workers for a single chunk
+        if (_workers.empty() || count <= grainSize)
+        {
+            work(0, count);
+            return;
+        }
+
+        std::lock_guard dispatchLock(_dispatchMutex);
+        {
+            std::lock_guard lock(_mutex);
+            _work = &work;
+            _count = count;
+            _grainSize = grainSize;
+            _nextIndex = 0;
+            _busyWorkers = _workers.size();
+            _generation++;
+        }
+        _wake.notify_all();
+
+        RunChunks();
+
+        std::unique_lock lock(_mutex);
+        _done.wait(lock, [this]() { return _busyWorkers == 0; });
+        _work = nullptr;
+    }
+
+    void ThreadPool::WorkerLoop()
+    {
+        uint64_t lastGeneration = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(_mutex);
+                _wake.wait(lock, [&]() { return _stopping || _generation != lastGeneration; });
+                if (_stopping) return;
+                lastGeneration = _generation;
+            }
+
+            RunChunks();
+
+            std::lock_guard lock(_mutex);
+            if (--_busyWorkers == 0)
+            {
+                _done.notify_one();
+            }
+        }
+    }
+
+    void ThreadPool::RunChunks()
+    {
+        while (true)
+        {
+            const size_t begin = _nextIndex.fetch_add(_grainSize);
+            if (begin >= _count) return;
+            (*_work)(begin, std::min(begin + _grainSize, _count));
+        }
+    }
+}
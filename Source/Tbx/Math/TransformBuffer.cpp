@@ -0,0 +1,202 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/TransformBuffer.h"
+#include "Tbx/Math/SimdLanes.h"
+
+namespace Tbx
+{
+    /// <summary>
+    /// Stores one column of a matrix for each lane, i.e. out[0] gets (c0, c1, c2, c3) of lane 0.
+    /// </summary>
+    static void StoreColumn(Simd::Float1 c0, Simd::Float1 c1, Simd::Float1 c2, Simd::Float1 c3, Mat4x4* out, int column)
+    {
+        float* dst = out->Values.data() + column * 4;
+        dst[0] = c0.Value;
+        dst[1] = c1.Value;
+        dst[2] = c2.Value;
+        dst[3] = c3.Value;
+    }
+
+#ifdef TBX_MATH_SSE2
+    static void StoreColumn(Simd::Float4 c0, Simd::Float4 c1, Simd::Float4 c2, Simd::Float4 c3, Mat4x4* out, int column)
+    {
+        _MM_TRANSPOSE4_PS(c0.Value, c1.Value, c2.Value, c3.Value);
+        _mm_store_ps(out[0].Values.data() + column * 4, c0.Value);
+        _mm_store_ps(out[1].Values.data() + column * 4, c1.Value);
+        _mm_store_ps(out[2].Values.data() + column * 4, c2.Value);
+        _mm_store_ps(out[3].Values.data() + column * 4, c3.Value);
+    }
+#endif
+
+#ifdef TBX_MATH_AVX2
+    static void StoreColumn(Simd::Float8 c0, Simd::Float8 c1, Simd::Float8 c2, Simd::Float8 c3, Mat4x4* out, int column)
+    {
+        StoreColumn(c0.Low(), c1.Low(), c2.Low(), c3.Low(), out, column);
+        StoreColumn(c0.High(), c1.High(), c2.High(), c3.High(), out + 4, column);
+    }
+#endif
+
+    /// <summary>
+    /// Composes T * R * S for Lanes::Width transforms starting at index.
+    /// The rotation matrix columns are scaled and the translation written directly, no matrix multiplies are needed.
+    /// </summary>
+    template <typename Lanes>
+    static void ComposeTRS(const TransformBuffer& buffer, size_t index, Mat4x4* out)
+    {
+        const Lanes x = Lanes::Load(buffer.GetRotationX().data() + index);
+        const Lanes y = Lanes::Load(buffer.GetRotationY().data() + index);
+        const Lanes z = Lanes::Load(buffer.GetRotationZ().data() + index);
+        const Lanes w = Lanes::Load(buffer.GetRotationW().data() + index);
+        const Lanes sx = Lanes::Load(buffer.GetScaleX().data() + index);
+        const Lanes sy = Lanes::Load(buffer.GetScaleY().data() + index);
+        const Lanes sz = Lanes::Load(buffer.GetScaleZ().data() + index);
+
+        const Lanes zero = Lanes::Set(0.0f);
+        const Lanes one = Lanes::Set(1.0f);
+        const Lanes two = Lanes::Set(2.0f);
+
+        const Lanes xx = x * x;
+        const Lanes yy = y * y;
+        const Lanes zz = z * z;
+        const Lanes xy = x * y;
+        const Lanes xz = x * z;
+        const Lanes yz = y * z;
+        const Lanes wx = w * x;
+        const Lanes wy = w * y;
+        const Lanes wz = w * z;
+
+        StoreColumn((one - two * (yy + zz)) * sx, two * (xy + wz) * sx, two * (xz - wy) * sx, zero, out, 0);
+        StoreColumn(two * (xy - wz) * sy, (one - two * (xx + zz)) * sy, two * (yz + wx) * sy, zero, out, 1);
+        StoreColumn(two * (xz + wy) * sz, two * (yz - wx) * sz, (one - two * (xx + yy)) * sz, zero, out, 2);
+        StoreColumn(
+            Lanes::Load(buffer.GetPositionX().data() + index),
+            Lanes::Load(buffer.GetPositionY().data() + index),
+            Lanes::Load(buffer.GetPositionZ().data() + index),
+            one, out, 3);
+    }
+
+    static void CheckIndex(const TransformBuffer& buffer, size_t index)
+    {
+        if (index >= buffer.Size()) throw std::out_of_range("Transform index is out of range.");
+    }
+
+    TransformBuffer::TransformBuffer(std::span<const Transform> transforms)
+    {
+        Reserve(transforms.size());
+        for (const auto& transform : transforms)
+        {
+            Add(transform);
+        }
+    }
+
+    size_t TransformBuffer::Add(const Transform& transform)
+    {
+        // Every array gets room before any of them grows, so a failed allocation throws while they are still the same size
+        const size_t size = Size();
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_rotationX, &_rotationY, &_rotationZ, &_rotationW, &_scaleX, &_scaleY, &_scaleZ })
+        {
+            if (array->capacity() == size) array->reserve(std::max<size_t>(size * 2, 16));
+        }
+
+        _positionX.push_back(transform.Position.X);
+        _positionY.push_back(transform.Position.Y);
+        _positionZ.push_back(transform.Position.Z);
+        _rotationX.push_back(transform.Rotation.X);
+        _rotationY.push_back(transform.Rotation.Y);
+        _rotationZ.push_back(transform.Rotation.Z);
+        _rotationW.push_back(transform.Rotation.W);
+        _scaleX.push_back(transform.Scale.X);
+        _scaleY.push_back(transform.Scale.Y);
+        _scaleZ.push_back(transform.Scale.Z);
+        return Size() - 1;
+    }
+
+    void TransformBuffer::Remove(size_t index)
+    {
+        CheckIndex(*this, index);
+
+        const size_t last = Size() - 1;
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_rotationX, &_rotationY, &_rotationZ, &_rotationW, &_scaleX, &_scaleY, &_scaleZ })
+        {
+            (*array)[index] = (*array)[last];
+            array->pop_back();
+        }
+    }
+
+    Transform TransformBuffer::Get(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return
+        {
+            { _positionX[index], _positionY[index], _positionZ[index] },
+            { _rotationX[index], _rotationY[index], _rotationZ[index], _rotationW[index] },
+            { _scaleX[index], _scaleY[index], _scaleZ[index] }
+        };
+    }
+
+    void TransformBuffer::Set(size_t index, const Transform& transform)
+    {
+        CheckIndex(*this, index);
+        _positionX[index] = transform.Position.X;
+        _positionY[index] = transform.Position.Y;
+        _positionZ[index] = transform.Position.Z;
+        _rotationX[index] = transform.Rotation.X;
+        _rotationY[index] = transform.Rotation.Y;
+        _rotationZ[index] = transform.Rotation.Z;
+        _rotationW[index] = transform.Rotation.W;
+        _scaleX[index] = transform.Scale.X;
+        _scaleY[index] = transform.Scale.Y;
+        _scaleZ[index] = transform.Scale.Z;
+    }
+
+    void TransformBuffer::SetPosition(size_t index, const Vector3& position)
+    {
+        CheckIndex(*this, index);
+        _positionX[index] = position.X;
+        _positionY[index] = position.Y;
+        _positionZ[index] = position.Z;
+    }
+
+    void TransformBuffer::SetRotation(size_t index, const Quaternion& rotation)
+    {
+        CheckIndex(*this, index);
+        _rotationX[index] = rotation.X;
+        _rotationY[index] = rotation.Y;
+        _rotationZ[index] = rotation.Z;
+        _rotationW[index] = rotation.W;
+    }
+
+    void TransformBuffer::SetScale(size_t index, const Vector3& scale)
+    {
+        CheckIndex(*this, index);
+        _scaleX[index] = scale.X;
+        _scaleY[index] = scale.Y;
+        _scaleZ[index] = scale.Z;
+    }
+
+    void TransformBuffer::Reserve(size_t count)
+    {
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_rotationX, &_rotationY, &_rotationZ, &_rotationW, &_scaleX, &_scaleY, &_scaleZ })
+        {
+            array->reserve(count);
+        }
+    }
+
+    void TransformBuffer::Clear()
+    {
+        for (FloatArray* array : { &_positionX, &_positionY, &_positionZ, &_rotationX, &_rotationY, &_rotationZ, &_rotationW, &_scaleX, &_scaleY, &_scaleZ })
+        {
+            array->clear();
+        }
+    }
+
+    void TransformBuffer::ComputeWorldMatrices(std::span<Mat4x4> out) const
+    {
+        const size_t count = Size();
+        if (out.size() < count) throw std::out_of_range("Output span is smaller than the transform buffer.");
+
+        Simd::ForEachLane(count, [this, &out]<typename Lanes>(Lanes, size_t index)
+        {
+            ComposeTRS<Lanes>(*this, index, out.data() + index);
+        });
+    }
+}
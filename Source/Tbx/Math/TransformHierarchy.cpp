@@ -0,0 +1,247 @@
+#include "Tbx/Math/PCH.h"
+#include "Tbx/Math/TransformHierarchy.h"
+
+namespace Tbx
+{
+    /// <summary>
+    /// The number of nodes of one level each thread claims at a time when a level is spread across a pool.
+    /// </summary>
+    static constexpr size_t LevelGrainSize = 256;
+
+    static void CheckIndex(const TransformHierarchy& hierarchy, size_t index)
+    {
+        if (index >= hierarchy.Size()) throw std::out_of_range("Node index is out of range.");
+    }
+
+    size_t TransformHierarchy::Add(const Transform& local, size_t parent)
+    {
+        size_t index = Size();
+        if (parent != NoParent)
+        {
+            if (parent >= Size()) throw std::out_of_range("Parent index is out of range.");
+
+            // Insert after the last node of the parents subtree, shifting everything after it.
+            // Only nodes after the insertion point can have a parent that shifts, as parents are stored first.
+            index = parent + _descendantCounts[parent] + 1;
+            for (size_t other = index; other < Size(); other++)
+            {
+                if (_parents[other] != NoParent && _parents[other] >= index) _parents[other]++;
+            }
+            for (size_t ancestor = parent; ancestor != NoParent; ancestor = _parents[ancestor])
+            {
+                _descendantCounts[ancestor]++;
+            }
+        }
+
+        const auto offset = static_cast<std::ptrdiff_t>(index);
+        _locals.insert(_locals.begin() + offset, local);
+        _worlds.insert(_worlds.begin() + offset, Mat4x4());
+        _parents.insert(_parents.begin() + offset, parent);
+        _descendantCounts.insert(_descendantCounts.begin() + offset, 0);
+        _depths.insert(_depths.begin() + offset, parent == NoParent ? 0 : _depths[parent] + 1);
+        _dirty.insert(_dirty.begin() + offset, 1);
+        _levelsDirty = true;
+        return index;
+    }
+
+    void TransformHierarchy::Remove(size_t index)
+    {
+        CheckIndex(*this, index);
+
+        const size_t count = _descendantCounts[index] + 1;
+        for (size_t ancestor = _parents[index]; ancestor != NoParent; ancestor = _parents[ancestor])
+        {
+            _descendantCounts[ancestor] -= count;
+        }
+
+        const auto begin = static_cast<std::ptrdiff_t>(index);
+        const auto end = static_cast<std::ptrdiff_t>(index + count);
+        _locals.erase(_locals.begin() + begin, _locals.begin() + end);
+        _worlds.erase(_worlds.begin() + begin, _worlds.begin() + end);
+        _parents.erase(_parents.begin() + begin, _parents.begin() + end);
+        _descendantCounts.erase(_descendantCounts.begin() + begin, _descendantCounts.begin() + end);
+        _depths.erase(_depths.begin() + begin, _depths.begin() + end);
+        _dirty.erase(_dirty.begin() + begin, _dirty.begin() + end);
+        _levelsDirty = true;
+
+        for (size_t other = index; other < Size(); other++)
+        {
+            if (_parents[other] != NoParent && _parents[other] > index) _parents[other] -= count;
+        }
+    }
+
+    const Transform& TransformHierarchy::GetLocal(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return _locals[index];
+    }
+
+    void TransformHierarchy::SetLocal(size_t index, const Transform& local)
+    {
+        CheckIndex(*this, index);
+        _locals[index] = local;
+        _dirty[index] = 1;
+    }
+
+    size_t TransformHierarchy::GetParent(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return _parents[index];
+    }
+
+    size_t TransformHierarchy::GetDescendantCount(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return _descendantCounts[index];
+    }
+
+    size_t TransformHierarchy::GetDepth(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return _depths[index];
+    }
+
+    bool TransformHierarchy::IsDirty(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return _dirty[index] != 0;
+    }
+
+    const Mat4x4& TransformHierarchy::GetWorld(size_t index) const
+    {
+        CheckIndex(*this, index);
+        return _worlds[index];
+    }
+
+    size_t TransformHierarchy::UpdateWorldMatrices()
+    {
+        size_t updated = 0;
+        size_t index = 0;
+        while (index < Size())
+        {
+            if (!_dirty[index])
+            {
+                index++;
+                continue;
+            }
+
+            // The whole subtree follows the dirty node, so update it in one go and skip past it
+            const size_t end = index + _descendantCounts[index] + 1;
+            UpdateRange(index, end);
+            updated += end - index;
+            index = end;
+        }
+        return updated;
+    }
+
+    void TransformHierarchy::UpdateAllWorldMatrices()
+    {
+        UpdateRange(0, Size());
+    }
+
+    size_t TransformHierarchy::UpdateWorldMatrices(ThreadPool& pool)
+    {
+        // Dirty subtrees don't depend on each other, so each small one can be updated whole by a different thread.
+        // A large subtree would leave the other threads idle, so it is spread across them one depth level at a time instead.
+        std::vector<std::pair<size_t, size_t>> ranges = {};
+        size_t updated = 0;
+        size_t index = 0;
+        while (index < Size())
+        {
+            if (!_dirty[index])
+            {
+                index++;
+                continue;
+            }
+
+            const size_t end = index + _descendantCounts[index] + 1;
+            if (end - index >= LargeSubtreeSize)
+            {
+                UpdateRangeByLevel(pool, index, end);
+            }
+            else
+            {
+                ranges.emplace_back(index, end);
+            }
+            updated += end - index;
+            index = end;
+        }
+
+        pool.ParallelFor(ranges.size(), 1, [&](size_t begin, size_t end)
+        {
+            for (size_t range = begin; range < end; range++)
+            {
+                UpdateRange(ranges[range].first, ranges[range].second);
+            }
+        });
+        return updated;
+    }
+
+    void TransformHierarchy::UpdateAllWorldMatrices(ThreadPool& pool)
+    {
+        UpdateRangeByLevel(pool, 0, Size());
+    }
+
+    void TransformHierarchy::UpdateNode(size_t index)
+    {
+        const Transform& local = _locals[index];
+        const Mat4x4 localMatrix = Mat4x4::FromTRS(local.Position, local.Rotation, local.Scale);
+        const size_t parent = _parents[index];
+        _worlds[index] = parent == NoParent
+            ? localMatrix
+            : Mat4x4::Multiply(_worlds[parent], localMatrix);
+        _dirty[index] = 0;
+    }
+
+    void TransformHierarchy::UpdateRange(size_t begin, size_t end)
+    {
+        // Parents are always stored before their children, so their world matrix is already up to date
+        for (size_t index = begin; index < end; index++)
+        {
+            UpdateNode(index);
+        }
+    }
+
+    void TransformHierarchy::UpdateRangeByLevel(ThreadPool& pool, size_t begin, size_t end)
+    {
+        if (begin == end) return;
+        if (_levelsDirty)
+        {
+            RebuildLevels();
+        }
+
+        // Every node in a level only depends on the level before it.
+        // Levels list their nodes in storage order, so the nodes of the range are a contiguous run of each level.
+        for (size_t depth = _depths[begin]; depth < _levels.size(); depth++)
+        {
+            const std::vector<size_t>& level = _levels[depth];
+            const auto first = std::lower_bound(level.begin(), level.end(), begin);
+            const auto last = std::lower_bound(first, level.end(), end);
+            if (first == last) break;
+
+            const size_t* nodes = &*first;
+            pool.ParallelFor(static_cast<size_t>(last - first), LevelGrainSize, [&](size_t chunkBegin, size_t chunkEnd)
+            {
+                for (size_t i = chunkBegin; i < chunkEnd; i++)
+                {
+                    UpdateNode(nodes[i]);
+                }
+            });
+        }
+    }
+
+    void TransformHierarchy::RebuildLevels()
+    {
+        _levels.clear();
+        for (size_t index = 0; index < Size(); index++)
+        {
+            const size_t depth = _depths[index];
+            if (depth >= _levels.size())
+            {
+                _levels.resize(depth + 1);
+            }
+            _levels[depth].push_back(index);
+        }
+        _levelsDirty = false;
+    }
+}
@@ -1,19 +1,31 @@
 #include "Tbx/Math/PCH.h"
 #include "Tbx/Math/Trig.h"
+#include "Tbx/Math/TrigKernels.h"
 #include <glm/glm.hpp>
 
 namespace Tbx::Math
 {
-    float DegreesToRadians(float degrees)
+    /// <summary>
+    /// Runs a kernel over every value with Simd::ForEachLane, passing it the loaded values instead of the lane type.
+    /// </summary>
+    template <typename Kernel>
+    static void ForEachValue(std::span<const float> values, Kernel&& kernel)
     {
-        return glm::radians(degrees);
-    }
-
-    float RadiansToDegrees(float radians)
-    {
-        return glm::degrees(radians);
+        Simd::ForEachLane(values.size(), [values, &kernel]<typename Lanes>(Lanes, size_t index)
+        {
+            kernel(Lanes::Load(values.data() + index), index);
+        });
     }
 
+#ifdef TBX_MATH_FAST_TRIG
+    float Cos(float x) { return FastCos(x); }
+    float Sin(float x) { return FastSin(x); }
+    float Tan(float x) { return FastTan(x); }
+    float ACos(float x) { return FastACos(x); }
+    float ASin(float x) { return FastASin(x); }
+    float ATan(float x) { return FastATan(x); }
+    void SinCos(float x, float& outSin, float& outCos) { FastSinCos(x, outSin, outCos); }
+#else
     float Cos(float x)
     {
         return glm::cos(x);
@@ -43,4 +55,104 @@ namespace Tbx::Math
     {
         return glm::atan(x);
     }
+
+    void SinCos(float x, float& outSin, float& outCos)
+    {
+        outSin = glm::sin(x);
+        outCos = glm::cos(x);
+    }
+#endif
+
+    float FastSin(float x)
+    {
+        float sin;
+        float cos;
+        FastSinCos(x, sin, cos);
+        return sin;
+    }
+
+    float FastCos(float x)
+    {
+        float sin;
+        float cos;
+        FastSinCos(x, sin, cos);
+        return cos;
+    }
+
+    float FastTan(float x)
+    {
+        float sin;
+        float cos;
+        FastSinCos(x, sin, cos);
+        return sin / cos;
+    }
+
+    float FastASin(float x)
+    {
+        return Simd::ASin(Simd::Float1::Set(x)).Value;
+    }
+
+    float FastACos(float x)
+    {
+        return Simd::ACos(Simd::Float1::Set(x)).Value;
+    }
+
+    float FastATan(float x)
+    {
+        return Simd::ATan(Simd::Float1::Set(x)).Value;
+    }
+
+    float FastATan2(float y, float x)
+    {
+        return Simd::ATan2(Simd::Float1::Set(y), Simd::Float1::Set(x)).Value;
+    }
+
+    void FastSinCos(float x, float& outSin, float& outCos)
+    {
+        Simd::Float1 sin;
+        Simd::Float1 cos;
+        Simd::SinCos(Simd::Float1::Set(x), sin, cos);
+        outSin = sin.Value;
+        outCos = cos.Value;
+    }
+
+    void SinBatch(std::span<const float> values, std::span<float> out)
+    {
+        if (out.size() < values.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        ForEachValue(values, [&]<typename Lanes>(Lanes x, size_t index)
+        {
+            Lanes sin;
+            Lanes cos;
+            Simd::SinCos(x, sin, cos);
+            sin.Store(out.data() + index);
+        });
+    }
+
+    void CosBatch(std::span<const float> values, std::span<float> out)
+    {
+        if (out.size() < values.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        ForEachValue(values, [&]<typename Lanes>(Lanes x, size_t index)
+        {
+            Lanes sin;
+            Lanes cos;
+            Simd::SinCos(x, sin, cos);
+            cos.Store(out.data() + index);
+        });
+    }
+
+    void SinCosBatch(std::span<const float> values, std::span<float> outSin, std::span<float> outCos)
+    {
+        if (outSin.size() < values.size() || outCos.size() < values.size()) throw std::out_of_range("Output span is smaller than the input span.");
+
+        ForEachValue(values, [&]<typename Lanes>(Lanes x, size_t index)
+        {
+            Lanes sin;
+            Lanes cos;
+            Simd::SinCos(x, sin, cos);
+            sin.Store(outSin.data() + index);
+            cos.Store(outCos.data() + index);
+        });
+    }
 }
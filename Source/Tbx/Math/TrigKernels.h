@@ -0,0 +1,215 @@
+#pragma once
+#include "Tbx/Math/SimdLanes.h"
+#include <limits>
+
+// Polynomial trig kernels written once for every lane type, so the scalar fast trig functions and the SIMD batches share one implementation.
+// The coefficients are the single precision minimax polynomials from the Cephes math library.
+// Sin and Cos reduce the argument to [-pi/4, pi/4] with a three part pi/4, which stays accurate for |x| <= 8192.
+// From 2^24 on, including infinities and NaN, every lane type falls back to std::sin and std::cos.
+
+namespace Tbx::Simd
+{
+    /// <summary>
+    /// Evaluates the sine and cosine polynomials of a remainder r in [-pi/4, pi/4].
+    /// </summary>
+    template <typename Lanes>
+    void SinCosPolynomial(Lanes r, Lanes& outSin, Lanes& outCos)
+    {
+        const Lanes z = r * r;
+        outSin = ((Lanes::Set(-1.9515295891e-4f) * z + Lanes::Set(8.3321608736e-3f)) * z + Lanes::Set(-1.6666654611e-1f)) * z * r + r;
+        outCos = ((Lanes::Set(2.443315711809948e-5f) * z + Lanes::Set(-1.388731625493765e-3f)) * z + Lanes::Set(4.166664568298827e-2f)) * z * z - Lanes::Set(0.5f) * z + Lanes::Set(1.0f);
+    }
+
+    /// <summary>
+    /// Reduces |x| to a remainder in [-pi/4, pi/4] around j * pi/4, using a three part pi/4 so the remainder stays exact.
+    /// </summary>
+    template <typename Lanes>
+    Lanes ReduceQuarterPi(Lanes absX, Lanes j)
+    {
+        return ((absX - j * Lanes::Set(0.78515625f)) - j * Lanes::Set(2.4187564849853515625e-4f)) - j * Lanes::Set(3.77489497744594108e-8f);
+    }
+
+    /// <summary>
+    /// Computes the sine and cosine of x in radians, sharing the range reduction between them.
+    /// </summary>
+    template <typename Lanes>
+    void SinCos(Lanes x, Lanes& outSin, Lanes& outCos)
+    {
+        const Lanes half = Lanes::Set(0.5f);
+        const Lanes one = Lanes::Set(1.0f);
+        const Lanes two = Lanes::Set(2.0f);
+
+        // Sin is odd and cos is even, so reduce |x| and restore the sign of sin at the end
+        // +-1 from the sign bit, so sin(-0) stays -0 like std::sin
+        const Lanes sign = (x & Lanes::Set(-0.0f)) | one;
+        const Lanes absX = Abs(x);
+
+        // j is the number of pi/4 steps rounded up to even, so the remainder lands in [-pi/4, pi/4].
+        // Rounding floor(y) up to even is 2 * floor((y + 1) / 2), which needs a single truncation.
+        const Lanes quadrant = Truncate((absX * Lanes::Set(1.27323954473516f) + one) * half);
+        Lanes sinR;
+        Lanes cosR;
+        SinCosPolynomial(ReduceQuarterPi(absX, quadrant + quadrant), sinR, cosR);
+
+        // The quadrant is j / 2 modulo 4: odd quadrants swap sin and cos,
+        // sin is negative in quadrants 2 and 3 and cos is negative in quadrants 1 and 2.
+        const Lanes quadrantHalf = Truncate(quadrant * half);
+        const Lanes quadrantQuarter = Truncate(quadrant * Lanes::Set(0.25f));
+        const Lanes isOdd = quadrant - two * quadrantHalf;
+        const Lanes isUpper = quadrantHalf - two * quadrantQuarter;
+        const Lanes swap = GreaterEqual(isOdd, half);
+        const Lanes cosNegative = isOdd + isUpper - two * isOdd * isUpper;
+
+        outSin = Select(swap, cosR, sinR) * (one - two * isUpper) * sign;
+        outCos = Select(swap, sinR, cosR) * (one - two * cosNegative);
+
+        // Lanes of 2^24 and up, infinities and NaNs truncated to garbage quadrants above.
+        // Recompute just those with the standard library, like the scalar SinCos does.
+        const uint32_t inRange = MoveMask(Less(absX, Lanes::Set(16777216.0f)));
+        constexpr uint32_t allLanes = (1u << Lanes::Width) - 1;
+        if (inRange != allLanes) [[unlikely]]
+        {
+            float values[Lanes::Width];
+            float sins[Lanes::Width];
+            float coss[Lanes::Width];
+            x.Store(values);
+            outSin.Store(sins);
+            outCos.Store(coss);
+            for (size_t lane = 0; lane < Lanes::Width; lane++)
+            {
+                if (inRange & (1u << lane)) continue;
+                sins[lane] = std::sin(values[lane]);
+                coss[lane] = std::cos(values[lane]);
+            }
+            outSin = Lanes::Load(sins);
+            outCos = Lanes::Load(coss);
+        }
+    }
+
+    /// <summary>
+    /// Scalar SinCos, which takes the quadrant bits from an integer instead of the float round trips the SIMD lanes need.
+    /// </summary>
+    inline void SinCos(Float1 x, Float1& outSin, Float1& outCos)
+    {
+        // The quadrant has to fit in an int32_t. Past 2^24 floats are spaced further apart than pi so the polynomial result
+        // would be meaningless anyway, those inputs and infinities and NaNs go to the standard library instead.
+        const float absX = std::fabs(x.Value);
+        if (!(absX < 16777216.0f))
+        {
+            outSin = Float1::Set(std::sin(x.Value));
+            outCos = Float1::Set(std::cos(x.Value));
+            return;
+        }
+        const auto quadrant = static_cast<int32_t>((absX * 1.27323954473516f + 1.0f) * 0.5f);
+        Float1 sinR;
+        Float1 cosR;
+        SinCosPolynomial(ReduceQuarterPi(Float1::Set(absX), Float1::Set(static_cast<float>(quadrant * 2))), sinR, cosR);
+
+        float sin = (quadrant & 1) ? cosR.Value : sinR.Value;
+        float cos = (quadrant & 1) ? sinR.Value : cosR.Value;
+        if (quadrant & 2) sin = -sin;
+        if ((quadrant + 1) & 2) cos = -cos;
+        outSin = Float1::Set(x.Value < 0.0f ? -sin : sin);
+        outCos = Float1::Set(cos);
+    }
+
+    /// <summary>
+    /// Computes the arc tangent of x in radians.
+    /// </summary>
+    template <typename Lanes>
+    Lanes ATan(Lanes x)
+    {
+        const Lanes one = Lanes::Set(1.0f);
+        // +-1 from the sign bit, so -0 and underflowed negative quotients keep their sign like std::atan
+        const Lanes sign = (x & Lanes::Set(-0.0f)) | one;
+        const Lanes absX = Abs(x);
+
+        // Reduce to |x| <= tan(pi/8) using atan(x) = pi/2 - atan(1/x) and atan(x) = pi/4 + atan((x - 1) / (x + 1))
+        const Lanes large = Greater(absX, Lanes::Set(2.414213562373095f));
+        const Lanes medium = Greater(absX, Lanes::Set(0.4142135623730950f));
+        const Lanes reduced = Select(large, Lanes::Set(-1.0f) / absX, Select(medium, (absX - one) / (absX + one), absX));
+        const Lanes offset = Select(large, Lanes::Set(1.57079632679489661923f), Select(medium, Lanes::Set(0.78539816339744830962f), Lanes::Set(0.0f)));
+
+        const Lanes z = reduced * reduced;
+        const Lanes polynomial = (((Lanes::Set(8.05374449538e-2f) * z - Lanes::Set(1.38776856032e-1f)) * z + Lanes::Set(1.99777106478e-1f)) * z - Lanes::Set(3.33329491539e-1f)) * z * reduced + reduced;
+        return (offset + polynomial) * sign;
+    }
+
+    /// <summary>
+    /// Computes the angle of the point (x, y) in radians, in [-pi, pi] like std::atan2, including its results for signed zeros and infinities.
+    /// </summary>
+    template <typename Lanes>
+    Lanes ATan2(Lanes y, Lanes x)
+    {
+        const Lanes zero = Lanes::Set(0.0f);
+        const Lanes one = Lanes::Set(1.0f);
+        const Lanes signBit = Lanes::Set(-0.0f);
+        const Lanes infinity = Lanes::Set(std::numeric_limits<float>::infinity());
+
+        // The quadrant comes from the sign bits, so -0 for x is in the left half plane and -0 for y below the x axis.
+        // atan(y / x) covers the right half plane, the left half plane is a half turn away towards y's side.
+        const Lanes xSign = (x & signBit) | one;
+        const Lanes ySign = (y & signBit) | one;
+        const Lanes xNegative = Less(xSign, zero);
+        const Lanes halfTurn = Lanes::Set(3.14159265358979323846f) * ySign;
+
+        // Two infinities divide to NaN, std::atan2 gives them the diagonal of their quadrant so the quotient is taken as +-1
+        const Lanes bothInfinite = GreaterEqual(Abs(y), infinity) & GreaterEqual(Abs(x), infinity);
+        const Lanes quotient = Select(bothInfinite, ySign * xSign, y / x);
+
+        // y / x is NaN at the origin and drops the sign of a zero y, on the x axis the angle is y itself or the half turn.
+        // A NaN x fails the comparison and stays NaN through the division.
+        const Lanes onAxis = LessEqual(Abs(y), zero) & LessEqual(Abs(x), infinity);
+
+        // The half turn is only added in the left half plane, adding +0 would turn atan(-1 / inf) = -0 into +0
+        const Lanes angle = ATan(quotient);
+        return Select(onAxis, Select(xNegative, halfTurn, y), Select(xNegative, angle + halfTurn, angle));
+    }
+
+    /// <summary>
+    /// Computes asin(|x|) for |x| <= 1 and whether the result had to be reconstructed as pi/2 - 2 * asin(sqrt((1 - |x|) / 2)).
+    /// When it was, outHalfAngle holds the asin(sqrt((1 - |x|) / 2)) term so ACos can use it without cancellation.
+    /// </summary>
+    template <typename Lanes>
+    Lanes ASinAbs(Lanes absX, Lanes& outLarge, Lanes& outHalfAngle)
+    {
+        const Lanes half = Lanes::Set(0.5f);
+        outLarge = Greater(absX, half);
+        const Lanes z = Select(outLarge, half * (Lanes::Set(1.0f) - absX), absX * absX);
+        const Lanes reduced = Select(outLarge, Sqrt(z), absX);
+
+        outHalfAngle = ((((Lanes::Set(4.2163199048e-2f) * z + Lanes::Set(2.4181311049e-2f)) * z + Lanes::Set(4.5470025998e-2f)) * z
+            + Lanes::Set(7.4953002686e-2f)) * z + Lanes::Set(1.6666752422e-1f)) * z * reduced + reduced;
+        return Select(outLarge, Lanes::Set(1.57079632679489661923f) - (outHalfAngle + outHalfAngle), outHalfAngle);
+    }
+
+    /// <summary>
+    /// Computes the arc sine of x in radians, NaN outside [-1, 1].
+    /// </summary>
+    template <typename Lanes>
+    Lanes ASin(Lanes x)
+    {
+        const Lanes sign = Select(Less(x, Lanes::Set(0.0f)), Lanes::Set(-1.0f), Lanes::Set(1.0f));
+        Lanes large;
+        Lanes halfAngle;
+        return ASinAbs(Abs(x), large, halfAngle) * sign;
+    }
+
+    /// <summary>
+    /// Computes the arc cosine of x in radians, NaN outside [-1, 1].
+    /// </summary>
+    template <typename Lanes>
+    Lanes ACos(Lanes x)
+    {
+        const Lanes negative = Less(x, Lanes::Set(0.0f));
+        const Lanes sign = Select(negative, Lanes::Set(-1.0f), Lanes::Set(1.0f));
+        Lanes large;
+        Lanes halfAngle;
+        const Lanes asin = ASinAbs(Abs(x), large, halfAngle);
+
+        // Near |x| = 1 use acos(x) = 2 * asin(sqrt((1 - x) / 2)) directly instead of pi/2 - asin(x), which would cancel
+        const Lanes twiceHalfAngle = halfAngle + halfAngle;
+        const Lanes largeResult = Select(negative, Lanes::Set(3.14159265358979323846f) - twiceHalfAngle, twiceHalfAngle);
+        return Select(large, largeResult, Lanes::Set(1.57079632679489661923f) - asin * sign);
+    }
+}
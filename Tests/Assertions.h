@@ -0,0 +1,25 @@
+#pragma once
+#include "PCH.h"
+#include "Tbx/Math/Int.h"
+#include "Tbx/Math/Vectors.h"
+#include <vector>
+
+// Assertions shared by several test files.
+
+namespace Tbx::Tests::Core::Math
+{
+    inline void ExpectNear(const Vector3& actual, const Vector3& expected, float tolerance)
+    {
+        EXPECT_NEAR(actual.X, expected.X, tolerance);
+        EXPECT_NEAR(actual.Y, expected.Y, tolerance);
+        EXPECT_NEAR(actual.Z, expected.Z, tolerance);
+    }
+
+    /// <summary>
+    /// Reads bit index of a mask written by the batch tests, 64 results per word.
+    /// </summary>
+    inline bool IsMaskBitSet(const std::vector<uint64>& mask, size_t index)
+    {
+        return (mask[index / 64] >> (index % 64)) & 1;
+    }
+}
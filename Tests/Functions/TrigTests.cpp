@@ -0,0 +1,268 @@
+#include "PCH.h"
+#include "Tbx/Math/Trig.h"
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Tbx::Tests::Core::Math
+{
+    TEST(TrigTests, FastSinCos_StayWithinDocumentedError)
+    {
+        // Arrange
+        double sinError = 0.0;
+        double cosError = 0.0;
+        double tanError = 0.0;
+
+        // Act
+        for (double x = -8192.0; x <= 8192.0; x += 0.0137)
+        {
+            const auto value = static_cast<float>(x);
+            float sin;
+            float cos;
+            Tbx::Math::FastSinCos(value, sin, cos);
+            sinError = std::max(sinError, std::fabs(sin - std::sin(static_cast<double>(value))));
+            cosError = std::max(cosError, std::fabs(cos - std::cos(static_cast<double>(value))));
+
+            const double tan = std::tan(static_cast<double>(value));
+            if (std::fabs(std::cos(static_cast<double>(value))) > 0.01)
+                tanError = std::max(tanError, std::fabs(Tbx::Math::FastTan(value) - tan) / std::max(1.0, std::fabs(tan)));
+        }
+
+        // Assert
+        EXPECT_LT(sinError, 1e-7);
+        EXPECT_LT(cosError, 1e-7);
+        EXPECT_LT(tanError, 2.5e-7);
+    }
+
+    TEST(TrigTests, FastInverseTrig_StaysWithinDocumentedError)
+    {
+        // Arrange
+        double aSinError = 0.0;
+        double aCosError = 0.0;
+        double aTanError = 0.0;
+
+        // Act
+        for (double x = -1.0; x <= 1.0; x += 1e-5)
+        {
+            const auto value = static_cast<float>(x);
+            aSinError = std::max(aSinError, std::fabs(Tbx::Math::FastASin(value) - std::asin(static_cast<double>(value))));
+            aCosError = std::max(aCosError, std::fabs(Tbx::Math::FastACos(value) - std::acos(static_cast<double>(value))));
+        }
+        for (double x = -1000.0; x <= 1000.0; x += 0.0123)
+        {
+            const auto value = static_cast<float>(x);
+            aTanError = std::max(aTanError, std::fabs(Tbx::Math::FastATan(value) - std::atan(static_cast<double>(value))));
+        }
+
+        // Assert
+        EXPECT_LT(aSinError, 2e-7);
+        EXPECT_LT(aCosError, 3e-7);
+        EXPECT_LT(aTanError, 1.5e-7);
+        EXPECT_FLOAT_EQ(Tbx::Math::FastACos(-1.0f), Tbx::Math::PI);
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastASin(1.5f)));
+    }
+
+    TEST(TrigTests, FastATan2_StaysWithinDocumentedError)
+    {
+        // Arrange
+        double error = 0.0;
+
+        // Act
+        for (double angle = -3.14159; angle <= 3.14159; angle += 1e-4)
+        {
+            for (double radius : { 1e-30, 1.0, 1e30 })
+            {
+                const auto y = static_cast<float>(std::sin(angle) * radius);
+                const auto x = static_cast<float>(std::cos(angle) * radius);
+                error = std::max(error, std::fabs(Tbx::Math::FastATan2(y, x) - std::atan2(static_cast<double>(y), static_cast<double>(x))));
+            }
+        }
+
+        // Assert
+        EXPECT_LT(error, 3e-7);
+    }
+
+    TEST(TrigTests, FastATan2_WithZeroOrTinyInput_MatchesStandardLibrary)
+    {
+        // Arrange
+        constexpr float tiny = std::numeric_limits<float>::denorm_min();
+        const std::array<float, 8> values = { 0.0f, -0.0f, tiny, -tiny, 1e-38f, -1e-38f, 1.0f, -1.0f };
+
+        // Act & Assert
+        for (float y : values)
+        {
+            for (float x : values)
+            {
+                const float expected = std::atan2(y, x);
+                const float actual = Tbx::Math::FastATan2(y, x);
+                EXPECT_NEAR(actual, expected, 3e-7f) << "y = " << y << ", x = " << x;
+                EXPECT_EQ(std::signbit(actual), std::signbit(expected)) << "y = " << y << ", x = " << x;
+            }
+        }
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastATan2(1.0f, std::numeric_limits<float>::quiet_NaN())));
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastATan2(0.0f, std::numeric_limits<float>::quiet_NaN())));
+    }
+
+    TEST(TrigTests, FastATan2_WithInfiniteInput_MatchesStandardLibrary)
+    {
+        // Arrange
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+        const std::array<float, 6> values = { infinity, -infinity, 0.0f, -0.0f, 1.0f, -1.0f };
+
+        // Act & Assert
+        for (float y : values)
+        {
+            for (float x : values)
+            {
+                const float expected = std::atan2(y, x);
+                const float actual = Tbx::Math::FastATan2(y, x);
+                EXPECT_NEAR(actual, expected, 3e-7f) << "y = " << y << ", x = " << x;
+                EXPECT_EQ(std::signbit(actual), std::signbit(expected)) << "y = " << y << ", x = " << x;
+            }
+        }
+    }
+
+    TEST(TrigTests, SinCos_MatchesSinAndCos)
+    {
+        // Arrange
+        float sin;
+        float cos;
+
+        // Act
+        Tbx::Math::SinCos(1.25f, sin, cos);
+
+        // Assert
+        EXPECT_NEAR(sin, Tbx::Math::Sin(1.25f), 1e-7f);
+        EXPECT_NEAR(cos, Tbx::Math::Cos(1.25f), 1e-7f);
+    }
+
+    TEST(TrigTests, SinCosBatch_MatchesScalarFastSinCos)
+    {
+        // Arrange
+        std::vector<float> values;
+        for (int i = 0; i < 1003; i++)
+            values.push_back(static_cast<float>(i) * 0.173f - 80.0f);
+        std::vector<float> sin(values.size());
+        std::vector<float> cos(values.size());
+        std::vector<float> sinOnly(values.size());
+        std::vector<float> cosOnly(values.size());
+
+        // Act
+        Tbx::Math::SinCosBatch(values, sin, cos);
+        Tbx::Math::SinBatch(values, sinOnly);
+        Tbx::Math::CosBatch(values, cosOnly);
+
+        // Assert
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            EXPECT_NEAR(sin[i], Tbx::Math::FastSin(values[i]), 1e-7f) << i;
+            EXPECT_NEAR(cos[i], Tbx::Math::FastCos(values[i]), 1e-7f) << i;
+            EXPECT_EQ(sinOnly[i], sin[i]) << i;
+            EXPECT_EQ(cosOnly[i], cos[i]) << i;
+        }
+    }
+
+    TEST(TrigTests, FastSinCos_WithNonFiniteOrHugeInput_MatchesStandardLibrary)
+    {
+        // Arrange
+        const float infinity = std::numeric_limits<float>::infinity();
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+
+        // Act
+        float sin;
+        float cos;
+        Tbx::Math::FastSinCos(3e9f, sin, cos);
+
+        // Assert
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastSin(nan)));
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastCos(nan)));
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastSin(infinity)));
+        EXPECT_TRUE(std::isnan(Tbx::Math::FastCos(-infinity)));
+        EXPECT_FLOAT_EQ(sin, std::sin(3e9f));
+        EXPECT_FLOAT_EQ(cos, std::cos(3e9f));
+        EXPECT_FLOAT_EQ(Tbx::Math::FastSin(-1e20f), std::sin(-1e20f));
+    }
+
+    TEST(TrigTests, SinCosBatch_WithNonFiniteOrHugeInputInSimdLanes_MatchesStandardLibrary)
+    {
+        // Arrange
+        // The special values sit at the start and in the middle, away from the scalar tail of the batch
+        const float infinity = std::numeric_limits<float>::infinity();
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        std::vector<float> values(35, 0.5f);
+        values[0] = 1e30f;
+        values[1] = infinity;
+        values[2] = -infinity;
+        values[3] = nan;
+        values[9] = -3e9f;
+        values[17] = nan;
+        std::vector<float> sin(values.size());
+        std::vector<float> cos(values.size());
+        std::vector<float> sinOnly(values.size());
+        std::vector<float> cosOnly(values.size());
+
+        // Act
+        Tbx::Math::SinCosBatch(values, sin, cos);
+        Tbx::Math::SinBatch(values, sinOnly);
+        Tbx::Math::CosBatch(values, cosOnly);
+
+        // Assert
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            const float expectedSin = std::sin(values[i]);
+            const float expectedCos = std::cos(values[i]);
+            if (std::isnan(expectedSin))
+            {
+                EXPECT_TRUE(std::isnan(sin[i]) && std::isnan(sinOnly[i])) << i;
+                EXPECT_TRUE(std::isnan(cos[i]) && std::isnan(cosOnly[i])) << i;
+                continue;
+            }
+            EXPECT_NEAR(sin[i], expectedSin, 1e-7f) << i;
+            EXPECT_NEAR(cos[i], expectedCos, 1e-7f) << i;
+            EXPECT_EQ(sinOnly[i], sin[i]) << i;
+            EXPECT_EQ(cosOnly[i], cos[i]) << i;
+        }
+    }
+
+    TEST(TrigTests, SinBatch_WithSmallerOutput_Throws)
+    {
+        // Arrange
+        std::vector<float> values(8);
+        std::vector<float> out(7);
+
+        // Act & Assert
+        EXPECT_THROW(Tbx::Math::SinBatch(values, out), std::out_of_range);
+    }
+
+    TEST(TrigTests, ConstexprTrig_AtCompileTime_MatchesStandardLibrary)
+    {
+        // Arrange
+        constexpr size_t count = 97;
+
+        // Act
+        // Each row is x followed by its sin, cos, tan and sqrt(x * x), all evaluated at compile time
+        constexpr auto results = []()
+        {
+            std::array<std::array<float, 5>, count> values = {};
+            for (size_t i = 0; i < count; i++)
+            {
+                const float x = static_cast<float>(i) * 0.27f - 13.0f;
+                values[i] = { x, Tbx::Math::ConstexprSin(x), Tbx::Math::ConstexprCos(x), Tbx::Math::ConstexprTan(x), Tbx::Math::ConstexprSqrt(x * x) };
+            }
+            return values;
+        }();
+
+        // Assert
+        static_assert(Tbx::Math::ConstexprSqrt(4.0f) == 2.0f && Tbx::Math::ConstexprSin(0.0f) == 0.0f && Tbx::Math::ConstexprCos(0.0f) == 1.0f);
+        for (size_t i = 0; i < count; i++)
+        {
+            const float x = results[i][0];
+            const float expected[] = { std::sin(x), std::cos(x), std::tan(x), std::fabs(x) };
+            for (size_t k = 0; k < 4; k++)
+            {
+                EXPECT_LE(std::fabs(results[i][k + 1] - expected[k]), std::fabs(expected[k]) * 1.2e-7f + 1e-9f) << i << " " << k;
+            }
+        }
+    }
+}
@@ -0,0 +1,220 @@
+#include "PCH.h"
+#include "Assertions.h"
+#include "Tbx/Math/AABB.h"
+#include "Tbx/Math/AABBBuffer.h"
+#include "Tbx/Math/Quaternion.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static AABB MakeBox(int i)
+    {
+        const auto f = static_cast<float>(i);
+        const Vector3 center(f * 1.5f - 10.0f, f * -0.75f + 4.0f, (i % 5) * 2.0f - 5.0f);
+        return AABB::FromCenterExtents(center, Vector3(0.5f + (i % 3), 1.0f, 0.25f + (i % 4)));
+    }
+
+    TEST(AABBTests, DefaultConstructor_IsEmpty)
+    {
+        // Act
+        AABB box;
+
+        // Assert
+        EXPECT_TRUE(box.IsEmpty());
+        EXPECT_FALSE(AABB::Contains(box, Vector3(0.0f, 0.0f, 0.0f)));
+    }
+
+    TEST(AABBTests, Merge_EnclosesBothBoxes)
+    {
+        // Arrange
+        AABB lhs({ -1.0f, 0.0f, 2.0f }, { 1.0f, 1.0f, 3.0f });
+        AABB rhs({ 0.0f, -2.0f, 0.0f }, { 4.0f, 0.5f, 1.0f });
+
+        // Act
+        AABB result = AABB::Merge(AABB::Merge(AABB(), lhs), rhs);
+
+        // Assert
+        EXPECT_EQ(result.ToString(), AABB({ -1.0f, -2.0f, 0.0f }, { 4.0f, 1.0f, 3.0f }).ToString());
+    }
+
+    TEST(AABBTests, Contains_ChecksPointsAndBoxes)
+    {
+        // Arrange
+        AABB box({ -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f });
+
+        // Act & Assert
+        EXPECT_TRUE(AABB::Contains(box, Vector3(0.0f, 1.0f, -1.0f)));
+        EXPECT_FALSE(AABB::Contains(box, Vector3(0.0f, 1.1f, 0.0f)));
+        EXPECT_TRUE(AABB::Contains(box, AABB({ -0.5f, -0.5f, -0.5f }, { 0.5f, 1.0f, 0.5f })));
+        EXPECT_FALSE(AABB::Contains(box, AABB({ -0.5f, -0.5f, -0.5f }, { 0.5f, 1.5f, 0.5f })));
+    }
+
+    TEST(AABBTests, Overlaps_DetectsIntersectingAndTouchingBoxes)
+    {
+        // Arrange
+        AABB box({ 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+
+        // Act & Assert
+        EXPECT_TRUE(AABB::Overlaps(box, AABB({ 0.5f, 0.5f, 0.5f }, { 2.0f, 2.0f, 2.0f })));
+        EXPECT_TRUE(AABB::Overlaps(box, AABB({ 1.0f, 0.0f, 0.0f }, { 2.0f, 1.0f, 1.0f })));
+        EXPECT_FALSE(AABB::Overlaps(box, AABB({ 1.1f, 0.0f, 0.0f }, { 2.0f, 1.0f, 1.0f })));
+    }
+
+    TEST(AABBTests, TransformBy_MatchesTransformedCorners)
+    {
+        // Arrange
+        AABB box({ -1.0f, -2.0f, 0.5f }, { 3.0f, 1.0f, 2.0f });
+        Mat4x4 matrix = Mat4x4::FromTRS(Vector3(4.0f, -1.0f, 2.0f), Quaternion::FromEuler(30.0f, 45.0f, 60.0f), Vector3(2.0f, 1.0f, 0.5f));
+
+        AABB expected;
+        for (int corner = 0; corner < 8; corner++)
+        {
+            Vector3 point((corner & 1) ? box.Max.X : box.Min.X, (corner & 2) ? box.Max.Y : box.Min.Y, (corner & 4) ? box.Max.Z : box.Min.Z);
+            const auto& m = matrix.Values;
+            Vector3 transformed(
+                m[0] * point.X + m[4] * point.Y + m[8] * point.Z + m[12],
+                m[1] * point.X + m[5] * point.Y + m[9] * point.Z + m[13],
+                m[2] * point.X + m[6] * point.Y + m[10] * point.Z + m[14]);
+            expected = AABB::Merge(expected, transformed);
+        }
+
+        // Act
+        AABB result = AABB::TransformBy(box, matrix);
+
+        // Assert
+        EXPECT_NEAR(result.Min.X, expected.Min.X, 1e-4f);
+        EXPECT_NEAR(result.Min.Y, expected.Min.Y, 1e-4f);
+        EXPECT_NEAR(result.Min.Z, expected.Min.Z, 1e-4f);
+        EXPECT_NEAR(result.Max.X, expected.Max.X, 1e-4f);
+        EXPECT_NEAR(result.Max.Y, expected.Max.Y, 1e-4f);
+        EXPECT_NEAR(result.Max.Z, expected.Max.Z, 1e-4f);
+    }
+
+    TEST(AABBTests, BufferTests_MatchSingleBoxOperations)
+    {
+        // Arrange
+        std::vector<AABB> boxes;
+        for (int i = 0; i < 75; i++)
+            boxes.push_back(MakeBox(i));
+        AABBBuffer buffer(boxes);
+        AABB query({ -4.0f, -2.0f, -3.0f }, { 6.0f, 5.0f, 2.0f });
+        Vector3 point(0.0f, 1.0f, -1.0f);
+        std::vector<uint64> contains(buffer.GetMaskWordCount());
+        std::vector<uint64> containedBy(buffer.GetMaskWordCount());
+        std::vector<uint64> overlaps(buffer.GetMaskWordCount());
+
+        // Act
+        buffer.Contains(point, contains);
+        buffer.ContainedBy(query, containedBy);
+        buffer.Overlaps(query, overlaps);
+
+        // Assert
+        for (size_t i = 0; i < boxes.size(); i++)
+        {
+            EXPECT_EQ(IsMaskBitSet(contains, i), AABB::Contains(boxes[i], point)) << i;
+            EXPECT_EQ(IsMaskBitSet(containedBy, i), AABB::Contains(query, boxes[i])) << i;
+            EXPECT_EQ(IsMaskBitSet(overlaps, i), AABB::Overlaps(boxes[i], query)) << i;
+        }
+        EXPECT_EQ(overlaps[1] >> 11, 0u);
+    }
+
+    TEST(AABBTests, BufferTransformBy_MatchesSingleTransformBy)
+    {
+        // Arrange
+        std::vector<AABB> boxes;
+        std::vector<Mat4x4> matrices;
+        for (int i = 0; i < 21; i++)
+        {
+            const auto f = static_cast<float>(i);
+            boxes.push_back(MakeBox(i));
+            matrices.push_back(Mat4x4::FromTRS(Vector3(f, -f, 2.0f), Quaternion::FromEuler(f * 7.0f, f * 13.0f, f * 29.0f), Vector3(1.0f + f * 0.1f)));
+        }
+        AABBBuffer buffer(boxes);
+        AABBBuffer shared;
+        AABBBuffer perBox;
+
+        // Act
+        buffer.TransformBy(matrices[5], shared);
+        buffer.TransformBy(matrices, perBox);
+
+        // Assert
+        for (size_t i = 0; i < boxes.size(); i++)
+        {
+            EXPECT_EQ(shared.Get(i).ToString(), AABB::TransformBy(boxes[i], matrices[5]).ToString()) << i;
+            EXPECT_EQ(perBox.Get(i).ToString(), AABB::TransformBy(boxes[i], matrices[i]).ToString()) << i;
+        }
+    }
+
+    TEST(AABBTests, BufferTransformBy_PassesEmptyBoxesThrough)
+    {
+        // Arrange
+        std::vector<AABB> boxes;
+        std::vector<Mat4x4> matrices;
+        for (int i = 0; i < 21; i++)
+        {
+            boxes.push_back(i % 3 == 0 ? AABB() : MakeBox(i));
+            matrices.push_back(Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(30.0f, 45.0f, 60.0f), Vector3(2.0f)));
+        }
+        AABBBuffer buffer(boxes);
+        AABBBuffer shared;
+        AABBBuffer perBox;
+
+        // Act
+        buffer.TransformBy(matrices[0], shared);
+        buffer.TransformBy(matrices, perBox);
+
+        // Assert
+        for (size_t i = 0; i < boxes.size(); i += 3)
+        {
+            EXPECT_TRUE(shared.Get(i).IsEmpty()) << i;
+            EXPECT_EQ(shared.Get(i).ToString(), AABB().ToString()) << i;
+            EXPECT_EQ(perBox.Get(i).ToString(), AABB().ToString()) << i;
+            EXPECT_EQ(shared.Get(i + 1).ToString(), AABB::TransformBy(boxes[i + 1], matrices[0]).ToString()) << i;
+        }
+    }
+
+    TEST(AABBTests, BufferMergeAndComputeBounds_MatchSingleMerge)
+    {
+        // Arrange
+        std::vector<AABB> lhsBoxes;
+        std::vector<AABB> rhsBoxes;
+        AABB expectedBounds;
+        for (int i = 0; i < 19; i++)
+        {
+            lhsBoxes.push_back(MakeBox(i));
+            rhsBoxes.push_back(MakeBox(i * 3 + 1));
+            expectedBounds = AABB::Merge(expectedBounds, lhsBoxes.back());
+        }
+        AABBBuffer lhs(lhsBoxes);
+        AABBBuffer rhs(rhsBoxes);
+        AABBBuffer merged;
+
+        // Act
+        AABBBuffer::Merge(lhs, rhs, merged);
+        AABB bounds = lhs.ComputeBounds();
+
+        // Assert
+        for (size_t i = 0; i < lhsBoxes.size(); i++)
+        {
+            EXPECT_EQ(merged.Get(i).ToString(), AABB::Merge(lhsBoxes[i], rhsBoxes[i]).ToString()) << i;
+        }
+        EXPECT_EQ(bounds.ToString(), expectedBounds.ToString());
+    }
+
+    TEST(AABBTests, BufferGetAndSet_ThrowOutOfRange)
+    {
+        // Arrange
+        AABBBuffer buffer;
+        buffer.Add(MakeBox(0));
+        buffer.Add(MakeBox(1));
+
+        // Act
+        buffer.Remove(1);
+
+        // Assert
+        EXPECT_THROW(buffer.Get(1), std::out_of_range);
+        EXPECT_THROW(buffer.Set(1, MakeBox(2)), std::out_of_range);
+        EXPECT_THROW(buffer.Remove(1), std::out_of_range);
+        EXPECT_NO_THROW(buffer.Set(0, MakeBox(2)));
+        EXPECT_EQ(buffer.Get(0).ToString(), MakeBox(2).ToString());
+    }
+}
@@ -0,0 +1,62 @@
+#include "PCH.h"
+#include "Tbx/Math/AnimationClip.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    TEST(AnimationClipTests, AddPositionKey_KeepsTrackSortedByTime)
+    {
+        // Arrange
+        AnimationClip clip(1);
+
+        // Act
+        clip.AddPositionKey(0, 2.0f, Vector3(2.0f));
+        clip.AddPositionKey(0, 0.0f, Vector3(0.0f));
+        clip.AddPositionKey(0, 1.0f, Vector3(1.0f));
+
+        // Assert
+        const auto& track = clip.GetPositionTrack(0);
+        ASSERT_EQ(track.Size(), 3u);
+        for (size_t key = 0; key < track.Size(); key++)
+        {
+            EXPECT_FLOAT_EQ(track.Times[key], static_cast<float>(key));
+            EXPECT_FLOAT_EQ(track.X[key], static_cast<float>(key));
+        }
+        EXPECT_FLOAT_EQ(clip.GetDuration(), 2.0f);
+    }
+
+    TEST(AnimationClipTests, AddRotationKey_AtExistingTime_ReplacesKey)
+    {
+        // Arrange
+        AnimationClip clip(2);
+        clip.AddRotationKey(1, 0.5f, Quaternion::FromEuler(0.0f, 10.0f, 0.0f));
+
+        // Act
+        clip.AddRotationKey(1, 0.5f, Quaternion::FromEuler(0.0f, 20.0f, 0.0f));
+
+        // Assert
+        const auto& track = clip.GetRotationTrack(1);
+        ASSERT_EQ(track.Size(), 1u);
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(track.Get(0), Quaternion::FromEuler(0.0f, 20.0f, 0.0f)));
+        EXPECT_EQ(clip.GetRotationTrack(0).Size(), 0u);
+    }
+
+    TEST(AnimationClipTests, AddScaleKey_WithInvalidBone_Throws)
+    {
+        // Arrange
+        AnimationClip clip(2);
+
+        // Act & Assert
+        EXPECT_THROW(clip.AddScaleKey(2, 0.0f, Vector3(1.0f)), std::out_of_range);
+    }
+
+    TEST(AnimationClipTests, GetTrack_WithInvalidBone_Throws)
+    {
+        // Arrange
+        AnimationClip clip(2);
+
+        // Act & Assert
+        EXPECT_THROW(clip.GetPositionTrack(2), std::out_of_range);
+        EXPECT_THROW(clip.GetRotationTrack(2), std::out_of_range);
+        EXPECT_THROW(clip.GetScaleTrack(2), std::out_of_range);
+    }
+}
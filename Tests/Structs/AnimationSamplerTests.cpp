@@ -0,0 +1,146 @@
+#include "PCH.h"
+#include "Tbx/Math/AnimationSampler.h"
+#include <vector>
+
+namespace Tbx::Tests::Core::Math
+{
+    static AnimationClip MakeWalkClip()
+    {
+        // Two bones with keys every 0.25 seconds, the second bone has no scale track
+        AnimationClip clip(2);
+        for (int key = 0; key <= 8; key++)
+        {
+            const float time = static_cast<float>(key) * 0.25f;
+            clip.AddPositionKey(0, time, Vector3(static_cast<float>(key), 0.0f, -static_cast<float>(key)));
+            clip.AddRotationKey(0, time, Quaternion::FromEuler(0.0f, static_cast<float>(key) * 10.0f, 0.0f));
+            clip.AddScaleKey(0, time, Vector3(1.0f + static_cast<float>(key)));
+            clip.AddPositionKey(1, time, Vector3(0.0f, static_cast<float>(key) * 2.0f, 0.0f));
+            clip.AddRotationKey(1, time, Quaternion::FromEuler(static_cast<float>(key) * 20.0f, 0.0f, 0.0f));
+        }
+        return clip;
+    }
+
+    TEST(AnimationSamplerTests, Sample_BetweenKeys_InterpolatesSurroundingKeys)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler sampler(clip);
+        std::vector<Transform> pose(2);
+
+        // Act
+        sampler.Sample(0.625f, pose);
+
+        // Assert
+        EXPECT_NEAR(pose[0].Position.X, 2.5f, 1e-5f);
+        EXPECT_NEAR(pose[0].Position.Z, -2.5f, 1e-5f);
+        EXPECT_NEAR(pose[0].Scale.Y, 3.5f, 1e-5f);
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(pose[0].Rotation, Quaternion::FromEuler(0.0f, 25.0f, 0.0f), 1e-4f));
+        EXPECT_NEAR(pose[1].Position.Y, 5.0f, 1e-5f);
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(pose[1].Rotation, Quaternion::FromEuler(50.0f, 0.0f, 0.0f), 1e-4f));
+    }
+
+    TEST(AnimationSamplerTests, Sample_OutsideKeys_ClampsToFirstAndLastKey)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler sampler(clip);
+        std::vector<Transform> pose(2);
+
+        // Act
+        sampler.Sample(-1.0f, pose);
+        const Vector3 before = pose[0].Position;
+        sampler.Sample(5.0f, pose);
+        const Vector3 after = pose[0].Position;
+
+        // Assert
+        EXPECT_FLOAT_EQ(before.X, 0.0f);
+        EXPECT_FLOAT_EQ(after.X, 8.0f);
+    }
+
+    TEST(AnimationSamplerTests, Sample_WithoutTrack_LeavesComponentUnchanged)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler sampler(clip);
+        std::vector<Transform> pose(2);
+        pose[1].Scale = Vector3(3.0f);
+
+        // Act
+        sampler.Sample(1.0f, pose);
+
+        // Assert
+        EXPECT_FLOAT_EQ(pose[1].Scale.X, 3.0f);
+        EXPECT_FLOAT_EQ(pose[1].Scale.Z, 3.0f);
+    }
+
+    TEST(AnimationSamplerTests, Sample_PlayingForwardAndSeeking_MatchesFreshSampler)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler playing(clip);
+        std::vector<Transform> pose(2);
+        std::vector<Transform> expected(2);
+        const float times[] = { 0.0f, 0.1f, 0.3f, 0.31f, 1.9f, 0.2f, 0.2f, 1.5f, 2.0f, 0.0f };
+
+        for (float time : times)
+        {
+            // Act
+            playing.Sample(time, pose);
+            AnimationSampler fresh(clip);
+            fresh.Sample(time, expected);
+
+            // Assert
+            for (size_t bone = 0; bone < pose.size(); bone++)
+            {
+                EXPECT_EQ(pose[bone].ToString(), expected[bone].ToString()) << time;
+            }
+        }
+    }
+
+    TEST(AnimationSamplerTests, SampleTransformBuffer_MatchesTransformSpan)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler sampler(clip);
+        std::vector<Transform> pose(2);
+        TransformBuffer buffer(pose);
+
+        // Act
+        sampler.Sample(1.3f, pose);
+        sampler.Sample(1.3f, buffer);
+
+        // Assert
+        EXPECT_EQ(buffer.Get(0).ToString(), pose[0].ToString());
+        EXPECT_EQ(buffer.Get(1).ToString(), pose[1].ToString());
+    }
+
+    TEST(AnimationSamplerTests, SampleTransformBuffer_WithoutTrack_LeavesComponentUnchanged)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler sampler(clip);
+        TransformBuffer buffer(std::vector<Transform>(2));
+        buffer.SetScale(1, Vector3(3.0f));
+
+        // Act
+        sampler.Sample(1.0f, buffer);
+
+        // Assert
+        const Transform bone = buffer.Get(1);
+        EXPECT_FLOAT_EQ(bone.Scale.X, 3.0f);
+        EXPECT_FLOAT_EQ(bone.Scale.Z, 3.0f);
+        EXPECT_NEAR(bone.Position.Y, 8.0f, 1e-5f);
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(bone.Rotation, Quaternion::FromEuler(80.0f, 0.0f, 0.0f), 1e-4f));
+    }
+
+    TEST(AnimationSamplerTests, Sample_WithSmallerPose_Throws)
+    {
+        // Arrange
+        const AnimationClip clip = MakeWalkClip();
+        AnimationSampler sampler(clip);
+        std::vector<Transform> pose(1);
+
+        // Act & Assert
+        EXPECT_THROW(sampler.Sample(0.0f, pose), std::out_of_range);
+    }
+}
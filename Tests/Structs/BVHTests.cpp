@@ -0,0 +1,253 @@
+#include "PCH.h"
+#include "Tbx/Math/BVH.h"
+#include <algorithm>
+#include <random>
+
+namespace Tbx::Tests::Core::Math
+{
+    static std::vector<AABB> MakePrimitives(size_t count, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> size(0.1f, 2.0f);
+
+        std::vector<AABB> primitives;
+        for (size_t i = 0; i < count; i++)
+        {
+            primitives.push_back(AABB::FromCenterExtents(Vector3(position(random), position(random), position(random)), Vector3(size(random), size(random), size(random))));
+        }
+        return primitives;
+    }
+
+    static bool BruteForceRayCast(const std::vector<AABB>& primitives, const Vector3& origin, const Vector3& direction, float maxDistance, BVH::RayHit& outHit)
+    {
+        bool hit = false;
+        for (uint32 i = 0; i < primitives.size(); i++)
+        {
+            float entry = 0.0f;
+            float exit = maxDistance;
+            const float o[3] = { origin.X, origin.Y, origin.Z };
+            const float d[3] = { direction.X, direction.Y, direction.Z };
+            const float min[3] = { primitives[i].Min.X, primitives[i].Min.Y, primitives[i].Min.Z };
+            const float max[3] = { primitives[i].Max.X, primitives[i].Max.Y, primitives[i].Max.Z };
+            for (int axis = 0; axis < 3; axis++)
+            {
+                const float t1 = (min[axis] - o[axis]) / d[axis];
+                const float t2 = (max[axis] - o[axis]) / d[axis];
+                entry = std::max(entry, std::min(t1, t2));
+                exit = std::min(exit, std::max(t1, t2));
+            }
+            if (entry <= exit && (!hit || entry < outHit.Distance))
+            {
+                outHit = { i, entry };
+                hit = true;
+            }
+        }
+        return hit;
+    }
+
+    static void ExpectQueriesMatchBruteForce(const BVH& bvh, const std::vector<AABB>& primitives)
+    {
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        for (int query = 0; query < 50; query++)
+        {
+            const Vector3 center(position(random), position(random), position(random));
+            const AABB box = AABB::FromCenterExtents(center, Vector3(8.0f, 4.0f, 6.0f));
+            std::vector<uint32> expectedBox;
+            std::vector<uint32> expectedSphere;
+            for (uint32 i = 0; i < primitives.size(); i++)
+            {
+                if (AABB::Overlaps(primitives[i], box)) expectedBox.push_back(i);
+
+                const float x = center.X - std::clamp(center.X, primitives[i].Min.X, primitives[i].Max.X);
+                const float y = center.Y - std::clamp(center.Y, primitives[i].Min.Y, primitives[i].Max.Y);
+                const float z = center.Z - std::clamp(center.Z, primitives[i].Min.Z, primitives[i].Max.Z);
+                if (x * x + y * y + z * z <= 25.0f) expectedSphere.push_back(i);
+            }
+
+            std::vector<uint32> boxResult;
+            std::vector<uint32> sphereResult;
+            bvh.QueryAABB(box, boxResult);
+            bvh.QuerySphere(center, 5.0f, sphereResult);
+            std::sort(boxResult.begin(), boxResult.end());
+            std::sort(sphereResult.begin(), sphereResult.end());
+            EXPECT_EQ(boxResult, expectedBox);
+            EXPECT_EQ(sphereResult, expectedSphere);
+
+            const Vector3 direction = Vector3::Normalize(Vector3(-center.X, position(random), -center.Z));
+            BVH::RayHit hit;
+            BVH::RayHit expectedHit;
+            const bool result = bvh.RayCast(center, direction, 200.0f, hit);
+            ASSERT_EQ(result, BruteForceRayCast(primitives, center, direction, 200.0f, expectedHit));
+            if (result)
+            {
+                EXPECT_NEAR(hit.Distance, expectedHit.Distance, 1e-4f);
+            }
+        }
+    }
+
+    TEST(BVHTests, Build_PutsEveryPrimitiveInExactlyOneLeaf)
+    {
+        // Arrange
+        auto primitives = MakePrimitives(1000, 1);
+
+        // Act
+        BVH bvh(primitives);
+
+        // Assert
+        std::vector<int> seen(primitives.size(), 0);
+        for (const auto& node : bvh.GetNodes())
+        {
+            EXPECT_LE(node.Count, BVH::MaxLeafSize);
+            for (uint32 i = node.First; i < node.First + node.Count; i++)
+            {
+                const uint32 primitive = bvh.GetPrimitiveIndices()[i];
+                seen[primitive]++;
+                EXPECT_TRUE(AABB::Contains(AABB(node.Min, node.Max), primitives[primitive]));
+            }
+        }
+        EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(bvh.GetNodes().data()) % 64, 0u);
+    }
+
+    TEST(BVHTests, Queries_MatchBruteForce)
+    {
+        // Arrange
+        auto primitives = MakePrimitives(2000, 2);
+
+        // Act
+        BVH bvh(primitives);
+
+        // Assert
+        ExpectQueriesMatchBruteForce(bvh, primitives);
+    }
+
+    TEST(BVHTests, RayCast_ReturnsClosestHit)
+    {
+        // Arrange
+        std::vector<AABB> primitives =
+        {
+            AABB({ -1.0f, -1.0f, 9.0f }, { 1.0f, 1.0f, 11.0f }),
+            AABB({ -1.0f, -1.0f, 4.0f }, { 1.0f, 1.0f, 6.0f }),
+            AABB({ 5.0f, -1.0f, 0.0f }, { 6.0f, 1.0f, 2.0f })
+        };
+        BVH bvh(primitives);
+        BVH::RayHit hit;
+
+        // Act & Assert
+        ASSERT_TRUE(bvh.RayCast(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+        EXPECT_EQ(hit.Primitive, 1u);
+        EXPECT_FLOAT_EQ(hit.Distance, 4.0f);
+        EXPECT_FALSE(bvh.RayCast(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), 3.0f, hit));
+        EXPECT_FALSE(bvh.RayCast(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, -1.0f), 100.0f, hit));
+    }
+
+    TEST(BVHTests, Refit_AfterPrimitivesMove_MatchesBruteForce)
+    {
+        // Arrange
+        auto primitives = MakePrimitives(1500, 3);
+        BVH bvh(primitives);
+        for (size_t i = 0; i < primitives.size(); i += 3)
+        {
+            primitives[i] = AABB::FromCenterExtents(primitives[i].GetCenter() + Vector3(5.0f, -3.0f, 2.0f), primitives[i].GetExtents());
+        }
+
+        // Act
+        bvh.Refit(primitives);
+
+        // Assert
+        ExpectQueriesMatchBruteForce(bvh, primitives);
+    }
+
+    TEST(BVHTests, RefitSinglePrimitive_UpdatesAncestors)
+    {
+        // Arrange
+        auto primitives = MakePrimitives(500, 4);
+        BVH bvh(primitives);
+        primitives[42] = AABB({ 90.0f, 90.0f, 90.0f }, { 91.0f, 91.0f, 91.0f });
+
+        // Act
+        bvh.Refit(42, primitives[42]);
+
+        // Assert
+        EXPECT_TRUE(AABB::Contains(AABB(bvh.GetNodes()[0].Min, bvh.GetNodes()[0].Max), primitives[42]));
+        ExpectQueriesMatchBruteForce(bvh, primitives);
+        std::vector<uint32> result;
+        bvh.QuerySphere(Vector3(90.5f, 90.5f, 90.5f), 0.1f, result);
+        EXPECT_EQ(result, std::vector<uint32>{ 42 });
+    }
+
+    TEST(BVHTests, RayCast_AlongBoxFaces_HitsLikeThroughTheMiddle)
+    {
+        // Arrange
+        std::vector<AABB> primitives;
+        for (int i = 0; i < 64; i++)
+        {
+            const auto x = static_cast<float>(i * 3);
+            primitives.push_back(AABB({ x, 0.0f, 0.0f }, { x + 1.0f, 1.0f, 1.0f }));
+        }
+        BVH bvh(primitives);
+
+        // Act & Assert
+        for (float y : { 0.0f, 0.5f, 1.0f })
+        {
+            for (float z : { 0.0f, 0.5f, 1.0f })
+            {
+                BVH::RayHit hit;
+                ASSERT_TRUE(bvh.RayCast(Vector3(-5.0f, y, z), Vector3(1.0f, 0.0f, 0.0f), 1000.0f, hit)) << "y = " << y << ", z = " << z;
+                EXPECT_EQ(hit.Primitive, 0u);
+                EXPECT_FLOAT_EQ(hit.Distance, 5.0f);
+            }
+        }
+        BVH::RayHit hit;
+        EXPECT_FALSE(bvh.RayCast(Vector3(-5.0f, 1.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 1000.0f, hit));
+        EXPECT_FALSE(bvh.RayCast(Vector3(-5.0f, -0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f), 1000.0f, hit));
+    }
+
+    TEST(BVHTests, EmptyPrimitives_AreNeverFound)
+    {
+        // Arrange
+        auto primitives = MakePrimitives(300, 5);
+        primitives.insert(primitives.begin(), AABB());
+        primitives[150] = AABB();
+        primitives.push_back(AABB({ 0.0f, 1.0f, 0.0f }, { 1.0f, 0.0f, 1.0f }));
+        const uint32 lastEmpty = static_cast<uint32>(primitives.size() - 1);
+
+        // Act
+        BVH bvh(primitives);
+
+        // Assert
+        std::vector<int> seen(primitives.size(), 0);
+        for (const auto& node : bvh.GetNodes())
+        {
+            for (uint32 i = node.First; i < node.First + node.Count; i++)
+            {
+                seen[bvh.GetPrimitiveIndices()[i]]++;
+            }
+        }
+        EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+
+        std::vector<uint32> result;
+        bvh.QueryAABB(AABB({ -100.0f, -100.0f, -100.0f }, { 100.0f, 100.0f, 100.0f }), result);
+        bvh.QuerySphere(Vector3(0.0f), 200.0f, result);
+        EXPECT_EQ(std::count(result.begin(), result.end(), 0u), 0);
+        EXPECT_EQ(std::count(result.begin(), result.end(), 150u), 0);
+        EXPECT_EQ(std::count(result.begin(), result.end(), lastEmpty), 0);
+        EXPECT_EQ(result.size(), 2 * (primitives.size() - 3));
+
+        for (int ray = 0; ray < 20; ray++)
+        {
+            const Vector3 target = primitives[1 + ray * 7].GetCenter();
+            BVH::RayHit hit;
+            ASSERT_TRUE(bvh.RayCast(Vector3(-80.0f, 0.0f, 0.0f), target - Vector3(-80.0f, 0.0f, 0.0f), 2.0f, hit));
+            EXPECT_FALSE(primitives[hit.Primitive].IsEmpty());
+        }
+
+        // A refit can give an empty primitive real bounds
+        bvh.Refit(0, AABB({ 90.0f, 90.0f, 90.0f }, { 91.0f, 91.0f, 91.0f }));
+        result.clear();
+        bvh.QuerySphere(Vector3(90.5f, 90.5f, 90.5f), 0.1f, result);
+        EXPECT_EQ(result, std::vector<uint32>{ 0 });
+    }
+}
@@ -0,0 +1,153 @@
+#include "PCH.h"
+#include "Assertions.h"
+#include "Tbx/Math/Codecs.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static Quaternion MakeRotation(int i)
+    {
+        const auto f = static_cast<float>(i);
+        return Quaternion::FromEuler(f * 23.0f - 170.0f, f * 41.0f, f * 67.0f + 5.0f);
+    }
+
+    static Vector3 MakeNormal(int i)
+    {
+        const auto f = static_cast<float>(i);
+        return Vector3::Normalize(Vector3(std::sin(f * 1.3f), std::cos(f * 0.7f) - 0.2f, std::sin(f * 2.9f + 1.0f)));
+    }
+
+    static void ExpectSameRotation(const Quaternion& actual, const Quaternion& expected, float tolerance)
+    {
+        // q and -q are the same rotation, the codec always returns the one with a positive largest component
+        const float sign = Quaternion::Dot(actual, expected) < 0.0f ? -1.0f : 1.0f;
+        EXPECT_NEAR(actual.X * sign, expected.X, tolerance);
+        EXPECT_NEAR(actual.Y * sign, expected.Y, tolerance);
+        EXPECT_NEAR(actual.Z * sign, expected.Z, tolerance);
+        EXPECT_NEAR(actual.W * sign, expected.W, tolerance);
+    }
+
+    TEST(QuaternionCodecTests, PackUnpack_RoundTripsWithinDocumentedError)
+    {
+        for (int i = 0; i < 64; i++)
+        {
+            // Arrange
+            Quaternion rotation = MakeRotation(i);
+
+            // Act
+            Quaternion unpacked32 = QuaternionCodec::Unpack32(QuaternionCodec::Pack32(rotation));
+            Quaternion unpacked48 = QuaternionCodec::Unpack48(QuaternionCodec::Pack48(rotation));
+            Quaternion unpacked64 = QuaternionCodec::Unpack64(QuaternionCodec::Pack64(rotation));
+
+            // Assert
+            ExpectSameRotation(unpacked32, rotation, 2e-3f);
+            ExpectSameRotation(unpacked48, rotation, 6e-5f);
+            ExpectSameRotation(unpacked64, rotation, 2e-6f);
+        }
+    }
+
+    TEST(QuaternionCodecTests, Pack_NegatedQuaternionPacksTheSame)
+    {
+        // Arrange
+        Quaternion rotation = MakeRotation(7);
+        Quaternion negated = { -rotation.X, -rotation.Y, -rotation.Z, -rotation.W };
+
+        // Act
+        uint32 packed = QuaternionCodec::Pack32(rotation);
+        uint32 packedNegated = QuaternionCodec::Pack32(negated);
+
+        // Assert
+        EXPECT_EQ(packed, packedNegated);
+        ExpectSameRotation(QuaternionCodec::Unpack64(QuaternionCodec::Pack64(Quaternion())), Quaternion(), 1e-6f);
+    }
+
+    TEST(QuaternionCodecTests, Batch_MatchesScalar)
+    {
+        // Arrange
+        std::vector<Quaternion> rotations;
+        for (int i = 0; i < 19; i++)
+        {
+            rotations.push_back(MakeRotation(i));
+        }
+        std::vector<uint32> packed32(rotations.size());
+        std::vector<PackedQuaternion48> packed48(rotations.size());
+        std::vector<uint64> packed64(rotations.size());
+        std::vector<Quaternion> unpacked(rotations.size());
+
+        // Act
+        QuaternionCodec::Pack32Batch(rotations, packed32);
+        QuaternionCodec::Pack48Batch(rotations, packed48);
+        QuaternionCodec::Pack64Batch(rotations, packed64);
+        QuaternionCodec::Unpack48Batch(packed48, unpacked);
+
+        // Assert
+        for (size_t i = 0; i < rotations.size(); i++)
+        {
+            EXPECT_EQ(packed32[i], QuaternionCodec::Pack32(rotations[i]));
+            EXPECT_EQ(packed48[i], QuaternionCodec::Pack48(rotations[i]));
+            EXPECT_EQ(packed64[i], QuaternionCodec::Pack64(rotations[i]));
+            ExpectSameRotation(unpacked[i], QuaternionCodec::Unpack48(packed48[i]), 1e-6f);
+        }
+        EXPECT_THROW(QuaternionCodec::Unpack32Batch(packed32, std::span(unpacked).first(3)), std::out_of_range);
+    }
+
+    TEST(NormalCodecTests, EncodeDecode_RoundTripsWithinDocumentedError)
+    {
+        for (int i = 0; i < 64; i++)
+        {
+            // Arrange
+            Vector3 normal = MakeNormal(i);
+
+            // Act
+            Vector3 decoded16 = NormalCodec::Decode16(NormalCodec::Encode16(normal));
+            Vector3 decoded32 = NormalCodec::Decode32(NormalCodec::Encode32(normal));
+
+            // Assert
+            ExpectNear(decoded16, normal, 0.017f);
+            ExpectNear(decoded32, normal, 7e-5f);
+            EXPECT_NEAR(Vector3::Dot(decoded16, decoded16), 1.0f, 1e-5f);
+        }
+    }
+
+    TEST(NormalCodecTests, EncodeDecode_AxesRoundTripExactly)
+    {
+        // Arrange
+        const Vector3 axes[] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+
+        for (const Vector3& axis : axes)
+        {
+            // Act
+            Vector3 decoded = NormalCodec::Decode16(NormalCodec::Encode16(axis));
+
+            // Assert
+            ExpectNear(decoded, axis, 1e-6f);
+        }
+        ExpectNear(NormalCodec::Decode32(NormalCodec::Encode32(Vector3(0.0f))), Vector3(0, 0, 1), 1e-6f);
+    }
+
+    TEST(NormalCodecTests, Batch_MatchesScalar)
+    {
+        // Arrange
+        std::vector<Vector3> normals;
+        for (int i = 0; i < 21; i++)
+        {
+            normals.push_back(MakeNormal(i));
+        }
+        std::vector<uint16> encoded16(normals.size());
+        std::vector<uint32> encoded32(normals.size());
+        std::vector<Vector3> decoded(normals.size());
+
+        // Act
+        NormalCodec::Encode16Batch(normals, encoded16);
+        NormalCodec::Encode32Batch(normals, encoded32);
+        NormalCodec::Decode32Batch(encoded32, decoded);
+
+        // Assert
+        for (size_t i = 0; i < normals.size(); i++)
+        {
+            EXPECT_EQ(encoded16[i], NormalCodec::Encode16(normals[i]));
+            EXPECT_EQ(encoded32[i], NormalCodec::Encode32(normals[i]));
+            ExpectNear(decoded[i], NormalCodec::Decode32(encoded32[i]), 1e-6f);
+        }
+        EXPECT_THROW(NormalCodec::Encode16Batch(normals, std::span(encoded16).first(4)), std::out_of_range);
+    }
+}
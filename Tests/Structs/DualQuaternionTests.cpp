@@ -0,0 +1,166 @@
+#include "PCH.h"
+#include "Assertions.h"
+#include "Tbx/Math/DualQuaternion.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static Transform MakeRigidTransform(int i)
+    {
+        const auto f = static_cast<float>(i);
+        return { Vector3(f, -2.0f * f, 0.5f * f + 1.0f), Quaternion::FromEuler(f * 23.0f, f * 41.0f, f * 67.0f), Vector3(1.0f) };
+    }
+
+    static void ExpectNear(const DualQuaternion& actual, const DualQuaternion& expected, float tolerance)
+    {
+        EXPECT_NEAR(actual.Real.X, expected.Real.X, tolerance);
+        EXPECT_NEAR(actual.Real.Y, expected.Real.Y, tolerance);
+        EXPECT_NEAR(actual.Real.Z, expected.Real.Z, tolerance);
+        EXPECT_NEAR(actual.Real.W, expected.Real.W, tolerance);
+        EXPECT_NEAR(actual.Dual.X, expected.Dual.X, tolerance);
+        EXPECT_NEAR(actual.Dual.Y, expected.Dual.Y, tolerance);
+        EXPECT_NEAR(actual.Dual.Z, expected.Dual.Z, tolerance);
+        EXPECT_NEAR(actual.Dual.W, expected.Dual.W, tolerance);
+    }
+
+    TEST(DualQuaternionTests, TransformPoint_MatchesFromTRS)
+    {
+        // Arrange
+        Transform transform = MakeRigidTransform(3);
+        Vector3 point(1.0f, 2.0f, -3.0f);
+        DualQuaternion dualQuaternion = DualQuaternion::FromTransform(transform);
+
+        // Act
+        Vector3 result = dualQuaternion * point;
+
+        // Assert
+        ExpectNear(result, Mat4x4::TransformPoint(Mat4x4::FromTRS(transform.Position, transform.Rotation, transform.Scale), point), 1e-5f);
+        ExpectNear(DualQuaternion::GetTranslation(dualQuaternion), transform.Position, 1e-5f);
+    }
+
+    TEST(DualQuaternionTests, Multiply_MatchesMatrixMultiply)
+    {
+        // Arrange
+        Transform parent = MakeRigidTransform(2);
+        Transform child = MakeRigidTransform(5);
+        Vector3 point(-4.0f, 0.5f, 2.0f);
+
+        // Act
+        DualQuaternion result = DualQuaternion::FromTransform(parent) * DualQuaternion::FromTransform(child);
+
+        // Assert
+        Mat4x4 expected = Mat4x4::FromTRS(parent.Position, parent.Rotation, parent.Scale) * Mat4x4::FromTRS(child.Position, child.Rotation, child.Scale);
+        ExpectNear(result * point, Mat4x4::TransformPoint(expected, point), 1e-4f);
+    }
+
+    TEST(DualQuaternionTests, Inverse_UndoesTransform)
+    {
+        // Arrange
+        DualQuaternion dualQuaternion = DualQuaternion::FromTransform(MakeRigidTransform(4));
+        Vector3 point(3.0f, -1.0f, 7.0f);
+
+        // Act
+        Vector3 result = DualQuaternion::Inverse(dualQuaternion) * (dualQuaternion * point);
+
+        // Assert
+        ExpectNear(result, point, 1e-4f);
+        ExpectNear(DualQuaternion::Inverse(dualQuaternion) * dualQuaternion, DualQuaternion(), 1e-6f);
+    }
+
+    TEST(DualQuaternionTests, FromMat4x4_RoundTripsThroughToMat4x4)
+    {
+        // Arrange
+        std::vector<Quaternion> rotations = { Quaternion::FromEuler(30.0f, 60.0f, 90.0f), Quaternion(1.0f, 0.0f, 0.0f, 0.0f), Quaternion(0.0f, 0.0f, 1.0f, 0.0f) };
+        Vector3 translation(5.0f, -6.0f, 7.0f);
+
+        for (const Quaternion& rotation : rotations)
+        {
+            // Act
+            DualQuaternion result = DualQuaternion::FromMat4x4(Mat4x4::FromTRS(translation, rotation, Vector3(2.0f, 3.0f, 4.0f)));
+
+            // Assert
+            EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(result.Real, rotation));
+            ExpectNear(DualQuaternion::GetTranslation(result), translation, 1e-5f);
+            Mat4x4 matrix = DualQuaternion::ToMat4x4(result);
+            Mat4x4 expected = Mat4x4::FromTRS(translation, rotation, Vector3(1.0f));
+            for (int i = 0; i < 16; i++)
+                EXPECT_NEAR(matrix[i], expected[i], 1e-5f);
+        }
+    }
+
+    TEST(DualQuaternionTests, Blend_TakesShortestPathAndStaysRigid)
+    {
+        // Arrange
+        DualQuaternion from = DualQuaternion::FromRotationTranslation(Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), 0.0f), Vector3(0.0f));
+        DualQuaternion to = DualQuaternion::FromRotationTranslation(Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), 90.0f), Vector3(2.0f, 0.0f, 0.0f));
+        DualQuaternion flippedTo = { Quaternion::Subtract({ 0, 0, 0, 0 }, to.Real), Quaternion::Subtract({ 0, 0, 0, 0 }, to.Dual) };
+        std::vector<DualQuaternion> dualQuaternions = { from, flippedTo };
+        std::vector<float> weights = { 0.5f, 0.5f };
+
+        // Act
+        DualQuaternion result = DualQuaternion::Blend(from, flippedTo, 0.5f);
+        DualQuaternion weighted = DualQuaternion::Blend(dualQuaternions, weights);
+
+        // Assert
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(result.Real, Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), 45.0f)));
+        EXPECT_NEAR(Quaternion::Dot(result.Real, result.Real), 1.0f, 1e-6f);
+        EXPECT_NEAR(Quaternion::Dot(result.Real, result.Dual), 0.0f, 1e-6f);
+        ExpectNear(weighted, result, 1e-6f);
+        ExpectNear(DualQuaternion::Blend(from, to, 1.0f), to, 1e-6f);
+    }
+
+    TEST(DualQuaternionTests, Batches_MatchScalarVersions)
+    {
+        // Arrange
+        std::vector<Transform> transforms;
+        std::vector<DualQuaternion> lhs;
+        std::vector<DualQuaternion> rhs;
+        std::vector<Vector3> points;
+        for (int i = 0; i < 37; i++)
+        {
+            transforms.push_back(MakeRigidTransform(i));
+            lhs.push_back(DualQuaternion::FromTransform(MakeRigidTransform(i)));
+            rhs.push_back(DualQuaternion::FromTransform(MakeRigidTransform(i + 50)));
+            points.push_back(Vector3(static_cast<float>(i), 1.0f, -0.5f * static_cast<float>(i)));
+        }
+        std::vector<DualQuaternion> products(lhs.size());
+        std::vector<DualQuaternion> blends(lhs.size());
+        std::vector<DualQuaternion> converted(lhs.size());
+        std::vector<Vector3> transformed(points.size());
+        std::vector<Mat4x4> matrices(lhs.size());
+
+        // Act
+        DualQuaternion::MultiplyBatch(lhs, rhs, products);
+        DualQuaternion::BlendBatch(lhs, rhs, 0.3f, blends);
+        DualQuaternion::FromTransformBatch(transforms, converted);
+        DualQuaternion::TransformPointBatch(lhs[7], points, transformed);
+        DualQuaternion::ToMat4x4Batch(lhs, matrices);
+
+        // Assert
+        for (size_t i = 0; i < lhs.size(); i++)
+        {
+            ExpectNear(products[i], lhs[i] * rhs[i], 1e-5f);
+            ExpectNear(blends[i], DualQuaternion::Blend(lhs[i], rhs[i], 0.3f), 1e-5f);
+            ExpectNear(converted[i], lhs[i], 1e-6f);
+            ExpectNear(transformed[i], lhs[7] * points[i], 1e-4f);
+            Mat4x4 expected = DualQuaternion::ToMat4x4(lhs[i]);
+            for (int j = 0; j < 16; j++)
+                EXPECT_NEAR(matrices[i][j], expected[j], 1e-5f);
+        }
+    }
+
+    TEST(DualQuaternionTests, Batches_WithSmallerOutput_Throw)
+    {
+        // Arrange
+        std::vector<DualQuaternion> dualQuaternions(2);
+        std::vector<DualQuaternion> smaller(1);
+        std::vector<Vector3> points(2);
+        std::vector<Vector3> smallerPoints(1);
+        std::vector<float> smallerWeights(1);
+
+        // Act & Assert
+        EXPECT_THROW(DualQuaternion::MultiplyBatch(dualQuaternions, smaller, dualQuaternions), std::out_of_range);
+        EXPECT_THROW(DualQuaternion::BlendBatch(dualQuaternions, dualQuaternions, 0.5f, smaller), std::out_of_range);
+        EXPECT_THROW(DualQuaternion::TransformPointBatch(DualQuaternion(), points, smallerPoints), std::out_of_range);
+        EXPECT_THROW(DualQuaternion::Blend(dualQuaternions, smallerWeights), std::out_of_range);
+    }
+}
@@ -0,0 +1,130 @@
+#include "PCH.h"
+#include "Assertions.h"
+#include "Tbx/Math/Frustum.h"
+#include "Tbx/Math/Trig.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static Frustum MakeFrustum()
+    {
+        // Camera at the origin looking down +Z
+        const Mat4x4 projection = Mat4x4::PerspectiveProjection(Tbx::Math::DegreesToRadians(90.0f), 1.0f, 1.0f, 100.0f);
+        const Mat4x4 view = Mat4x4::LookAt(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 1.0f, 0.0f));
+        return Frustum(projection * view);
+    }
+
+    TEST(FrustumTests, Constructor_ExtractsNormalizedInwardPlanes)
+    {
+        // Act
+        Frustum frustum = MakeFrustum();
+
+        // Assert
+        EXPECT_NEAR(frustum.Planes[Frustum::Near].Normal.Z, 1.0f, 1e-5f);
+        EXPECT_NEAR(frustum.Planes[Frustum::Near].Distance, -1.0f, 1e-4f);
+        EXPECT_NEAR(frustum.Planes[Frustum::Far].Normal.Z, -1.0f, 1e-5f);
+        EXPECT_NEAR(frustum.Planes[Frustum::Far].Distance, 100.0f, 1e-2f);
+        EXPECT_NEAR(frustum.Planes[Frustum::Left].Normal.X, 0.70710678f, 1e-5f);
+        EXPECT_NEAR(frustum.Planes[Frustum::Right].Normal.X, -0.70710678f, 1e-5f);
+    }
+
+    TEST(FrustumTests, Contains_ChecksPointsAgainstAllPlanes)
+    {
+        // Arrange
+        Frustum frustum = MakeFrustum();
+
+        // Act & Assert
+        EXPECT_TRUE(Frustum::Contains(frustum, Vector3(0.0f, 0.0f, 10.0f)));
+        EXPECT_TRUE(Frustum::Contains(frustum, Vector3(9.0f, -9.0f, 10.0f)));
+        EXPECT_FALSE(Frustum::Contains(frustum, Vector3(11.0f, 0.0f, 10.0f)));
+        EXPECT_FALSE(Frustum::Contains(frustum, Vector3(0.0f, 0.0f, -10.0f)));
+        EXPECT_FALSE(Frustum::Contains(frustum, Vector3(0.0f, 0.0f, 0.5f)));
+        EXPECT_FALSE(Frustum::Contains(frustum, Vector3(0.0f, 0.0f, 150.0f)));
+    }
+
+    TEST(FrustumTests, Intersects_AcceptsBoundsStraddlingAPlane)
+    {
+        // Arrange
+        Frustum frustum = MakeFrustum();
+
+        // Act & Assert
+        EXPECT_TRUE(Frustum::Intersects(frustum, Vector3(12.0f, 0.0f, 10.0f), 2.0f));
+        EXPECT_FALSE(Frustum::Intersects(frustum, Vector3(14.0f, 0.0f, 10.0f), 2.0f));
+        EXPECT_TRUE(Frustum::Intersects(frustum, AABB({ 10.5f, -1.0f, 9.0f }, { 12.0f, 1.0f, 11.0f })));
+        EXPECT_FALSE(Frustum::Intersects(frustum, AABB({ 12.0f, -1.0f, 9.0f }, { 13.0f, 1.0f, 10.0f })));
+        EXPECT_FALSE(Frustum::Intersects(frustum, AABB({ -1.0f, -1.0f, -5.0f }, { 1.0f, 1.0f, -2.0f })));
+    }
+
+    TEST(FrustumTests, CullSpheresAndAABBs_MatchSingleTests)
+    {
+        // Arrange
+        Frustum frustum = MakeFrustum();
+        std::vector<float> x, y, z, radius;
+        std::vector<AABB> boxes;
+        for (int i = 0; i < 133; i++)
+        {
+            const auto f = static_cast<float>(i);
+            x.push_back((i % 17) * 3.1f - 25.0f);
+            y.push_back((i % 11) * 2.3f - 12.0f);
+            z.push_back(f * 0.9f - 10.0f);
+            radius.push_back(0.5f + (i % 5) * 0.75f);
+            boxes.push_back(AABB::FromCenterExtents(Vector3(x.back(), y.back(), z.back()), Vector3(radius.back(), 1.0f, 0.5f)));
+        }
+        AABBBuffer buffer(boxes);
+        std::vector<uint64> sphereMask(buffer.GetMaskWordCount());
+        std::vector<uint64> boxMask(buffer.GetMaskWordCount());
+
+        // Act
+        Frustum::CullSpheres(frustum, x, y, z, radius, sphereMask);
+        Frustum::CullAABBs(frustum, buffer, boxMask);
+
+        // Assert
+        size_t visibleSpheres = 0;
+        for (size_t i = 0; i < boxes.size(); i++)
+        {
+            EXPECT_EQ(IsMaskBitSet(sphereMask, i), Frustum::Intersects(frustum, Vector3(x[i], y[i], z[i]), radius[i])) << i;
+            EXPECT_EQ(IsMaskBitSet(boxMask, i), Frustum::Intersects(frustum, boxes[i])) << i;
+            visibleSpheres += IsMaskBitSet(sphereMask, i);
+        }
+        EXPECT_GT(visibleSpheres, 10u);
+        EXPECT_LT(visibleSpheres, boxes.size() - 10);
+        EXPECT_EQ(sphereMask[2] >> 5, 0u);
+    }
+
+    TEST(FrustumTests, IntersectsAndCullAABBs_RejectEmptyBoxes)
+    {
+        // Arrange
+        Frustum frustum = MakeFrustum();
+        const AABB visible = AABB::FromCenterExtents(Vector3(0.0f, 0.0f, 10.0f), Vector3(1.0f));
+        const AABB inverted(Vector3(0.0f, 1.0f, 10.0f), Vector3(1.0f, 0.0f, 11.0f));
+        std::vector<AABB> boxes;
+        for (int i = 0; i < 9; i++)
+        {
+            // Empty boxes land in the SIMD lanes and in the scalar tail
+            boxes.push_back(i % 3 == 0 ? visible : i % 3 == 1 ? AABB() : inverted);
+        }
+        AABBBuffer buffer(boxes);
+        std::vector<uint64> mask(buffer.GetMaskWordCount());
+
+        // Act
+        Frustum::CullAABBs(frustum, buffer, mask);
+
+        // Assert
+        EXPECT_FALSE(Frustum::Intersects(frustum, AABB()));
+        EXPECT_FALSE(Frustum::Intersects(frustum, inverted));
+        for (size_t i = 0; i < boxes.size(); i++)
+        {
+            EXPECT_EQ(IsMaskBitSet(mask, i), i % 3 == 0) << i;
+        }
+    }
+
+    TEST(FrustumTests, CullSpheres_WithMismatchedSpans_Throws)
+    {
+        // Arrange
+        Frustum frustum = MakeFrustum();
+        std::vector<float> x(10), y(10), z(9), radius(10);
+        std::vector<uint64> mask(1);
+
+        // Act & Assert
+        EXPECT_THROW(Frustum::CullSpheres(frustum, x, y, z, radius, mask), std::out_of_range);
+    }
+}
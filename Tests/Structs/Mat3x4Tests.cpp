@@ -0,0 +1,111 @@
+#include "PCH.h"
+#include "Tbx/Math/Mat3x4.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static Mat4x4 MakeAffineMat4x4(int i)
+    {
+        const auto f = static_cast<float>(i);
+        return Mat4x4::FromTRS(Vector3(f, -2.0f * f, 3.0f), Quaternion::FromEuler(f * 13.0f, f * 29.0f, f * 7.0f), Vector3(1.0f + f * 0.5f, 2.0f, 0.5f));
+    }
+
+    TEST(Mat3x4Tests, DefaultConstructor_InitializesToIdentity)
+    {
+        // Arrange & Act
+        Mat3x4 matrix;
+
+        // Assert
+        EXPECT_EQ(Mat3x4::ToMat4x4(matrix), Mat4x4());
+    }
+
+    TEST(Mat3x4Tests, FromMat4x4_RoundTripsLosslessly)
+    {
+        // Arrange
+        Mat4x4 matrix = MakeAffineMat4x4(3);
+
+        // Act
+        Mat4x4 result = Mat3x4::ToMat4x4(Mat3x4::FromMat4x4(matrix));
+
+        // Assert
+        EXPECT_EQ(result, matrix);
+    }
+
+    TEST(Mat3x4Tests, FromTRS_MatchesMat4x4FromTRS)
+    {
+        // Arrange
+        Mat4x4 matrix = MakeAffineMat4x4(3);
+
+        // Act
+        Mat3x4 result = Mat3x4::FromTRS(Vector3(3.0f, -6.0f, 3.0f), Quaternion::FromEuler(39.0f, 87.0f, 21.0f), Vector3(2.5f, 2.0f, 0.5f));
+
+        // Assert
+        Mat3x4 expected = Mat3x4::FromMat4x4(matrix);
+        for (int i = 0; i < 12; i++)
+            EXPECT_NEAR(result[i], expected[i], 1e-5f);
+    }
+
+    TEST(Mat3x4Tests, Multiply_MatchesMat4x4Multiply)
+    {
+        // Arrange
+        Mat4x4 lhs = MakeAffineMat4x4(2);
+        Mat4x4 rhs = MakeAffineMat4x4(5);
+
+        // Act
+        Mat4x4 result = Mat3x4::ToMat4x4(Mat3x4::FromMat4x4(lhs) * Mat3x4::FromMat4x4(rhs));
+
+        // Assert
+        Mat4x4 expected = lhs * rhs;
+        for (int i = 0; i < 16; i++)
+            EXPECT_NEAR(result[i], expected[i], 1e-5f);
+    }
+
+    TEST(Mat3x4Tests, Inverse_MatchesMat4x4Inverse)
+    {
+        // Arrange
+        Mat4x4 matrix = MakeAffineMat4x4(4);
+
+        // Act
+        Mat4x4 result = Mat3x4::ToMat4x4(Mat3x4::Inverse(Mat3x4::FromMat4x4(matrix)));
+
+        // Assert
+        Mat4x4 expected = Mat4x4::Inverse(matrix);
+        for (int i = 0; i < 16; i++)
+            EXPECT_NEAR(result[i], expected[i], 1e-5f);
+    }
+
+    TEST(Mat3x4Tests, InverseOrthonormal_UndoesRigidTransform)
+    {
+        // Arrange
+        Mat3x4 matrix = Mat3x4::FromTRS(Vector3(4.0f, 5.0f, -6.0f), Quaternion::FromEuler(30.0f, 45.0f, 60.0f), Vector3(1.0f));
+        Vector3 point(1.0f, -2.0f, 3.0f);
+
+        // Act
+        Vector3 result = Mat3x4::TransformPoint(Mat3x4::InverseOrthonormal(matrix), Mat3x4::TransformPoint(matrix, point));
+
+        // Assert
+        EXPECT_NEAR(result.X, point.X, 1e-5f);
+        EXPECT_NEAR(result.Y, point.Y, 1e-5f);
+        EXPECT_NEAR(result.Z, point.Z, 1e-5f);
+    }
+
+    TEST(Mat3x4Tests, TransformPointAndVector_MatchMat4x4)
+    {
+        // Arrange
+        Mat4x4 matrix = MakeAffineMat4x4(6);
+        Mat3x4 affine = Mat3x4::FromMat4x4(matrix);
+        Vector3 point(-1.0f, 0.5f, 2.0f);
+
+        // Act
+        Vector3 transformedPoint = Mat3x4::TransformPoint(affine, point);
+        Vector3 transformedVector = Mat3x4::TransformVector(affine, point);
+
+        // Assert
+        Vector3 expected = Mat4x4::TransformPoint(matrix, point);
+        EXPECT_FLOAT_EQ(transformedPoint.X, expected.X);
+        EXPECT_FLOAT_EQ(transformedPoint.Y, expected.Y);
+        EXPECT_FLOAT_EQ(transformedPoint.Z, expected.Z);
+        EXPECT_NEAR(transformedVector.X, expected.X - matrix[12], 1e-5f);
+        EXPECT_NEAR(transformedVector.Y, expected.Y - matrix[13], 1e-5f);
+        EXPECT_NEAR(transformedVector.Z, expected.Z - matrix[14], 1e-5f);
+    }
+}
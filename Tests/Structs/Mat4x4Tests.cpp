@@ -2,6 +2,8 @@
 #include "Tbx/Math/Mat4x4.h"
 #include "Tbx/Math/Trig.h"
 #include "Tbx/Math/Constants.h"
+#include "Tbx/Math/ThreadPool.h"
+#include <vector>
 
 namespace Tbx::Tests::Core::Math
 {
@@ -105,6 +107,92 @@ namespace Tbx::Tests::Core::Math
         EXPECT_EQ(result.ToString(), expected.ToString());
     }
 
+    TEST(Mat4x4Tests, Multiply_ComposesTransformsInOrder)
+    {
+        // Arrange
+        Mat4x4 translation = Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f));
+        Mat4x4 scale = Mat4x4::FromScale(Vector3(2.0f, 2.0f, 2.0f));
+
+        // Act
+        Mat4x4 result = translation * scale;
+
+        // Assert
+        EXPECT_FLOAT_EQ(result(0, 0), 2.0f);
+        EXPECT_FLOAT_EQ(result(1, 1), 2.0f);
+        EXPECT_FLOAT_EQ(result(2, 2), 2.0f);
+        EXPECT_FLOAT_EQ(result(3, 0), 1.0f);
+        EXPECT_FLOAT_EQ(result(3, 1), 2.0f);
+        EXPECT_FLOAT_EQ(result(3, 2), 3.0f);
+        EXPECT_FLOAT_EQ(result(3, 3), 1.0f);
+    }
+
+    TEST(Mat4x4Tests, Inverse_MultipliedByOriginal_ProducesIdentity)
+    {
+        // Arrange
+        Mat4x4 m = Mat4x4::FromTRS(Vector3(1.0f, -2.0f, 3.0f), Quaternion::FromEuler(30.0f, 45.0f, 60.0f), Vector3(2.0f, 0.5f, 4.0f));
+
+        // Act
+        Mat4x4 result = m * Mat4x4::Inverse(m);
+
+        // Assert
+        for (int i = 0; i < 16; i++)
+            EXPECT_NEAR(result[i], Constants::Mat4x4::Identity[i], 1e-5f);
+    }
+
+    TEST(Mat4x4Tests, Transpose_SwapsRowsAndColumns)
+    {
+        // Arrange
+        Mat4x4 m = {
+            1, 2, 3, 4,
+            5, 6, 7, 8,
+            9, 10, 11, 12,
+            13, 14, 15, 16
+        };
+
+        // Act
+        Mat4x4 result = Mat4x4::Transpose(m);
+
+        // Assert
+        for (int row = 0; row < 4; ++row)
+            for (int col = 0; col < 4; ++col)
+                EXPECT_FLOAT_EQ(result(row, col), m(col, row));
+    }
+
+    TEST(Mat4x4Tests, MultiplyBatch_MatchesSingleMultiply)
+    {
+        // Arrange
+        const Mat4x4 viewProjection = Mat4x4::PerspectiveProjection(1.0f, 16.0f / 9.0f, 0.1f, 100.0f) * Mat4x4::FromPosition(Vector3(0.0f, 0.0f, -5.0f));
+        std::vector<Mat4x4> models;
+        for (int i = 0; i < 5000; i++)
+            models.push_back(Mat4x4::FromTRS(Vector3(static_cast<float>(i), 1.0f, 2.0f), Quaternion::FromEuler(0.0f, static_cast<float>(i), 0.0f), Vector3(1.0f)));
+        std::vector<Mat4x4> lhsResult(models.size());
+        std::vector<Mat4x4> rhsResult(models.size());
+        std::vector<Mat4x4> pairResult(models.size());
+
+        // Act
+        Mat4x4::MultiplyBatch(viewProjection, models, lhsResult);
+        Mat4x4::MultiplyBatch(models, viewProjection, rhsResult);
+        Mat4x4::MultiplyBatch(models, models, pairResult);
+
+        // Assert
+        for (size_t i = 0; i < models.size(); i++)
+        {
+            EXPECT_EQ(lhsResult[i], viewProjection * models[i]);
+            EXPECT_EQ(rhsResult[i], models[i] * viewProjection);
+            EXPECT_EQ(pairResult[i], models[i] * models[i]);
+        }
+    }
+
+    TEST(Mat4x4Tests, MultiplyBatch_WithSmallerOutput_Throws)
+    {
+        // Arrange
+        std::vector<Mat4x4> input(4);
+        std::vector<Mat4x4> output(3);
+
+        // Act & Assert
+        EXPECT_THROW(Mat4x4::MultiplyBatch(Mat4x4(), input, output), std::out_of_range);
+    }
+
     TEST(Mat4x4Tests, MultiplyScalarLeft_ScalesAllElements)
     {
         // Arrange
@@ -239,6 +327,26 @@ namespace Tbx::Tests::Core::Math
         EXPECT_NEAR(trs(3, 3), 1.0f, 0.001f);
     }
 
+    TEST(Mat4x4Tests, Rotate_AppliesRotationBeforeExistingTransform)
+    {
+        // Arrange
+        Mat4x4 translation = Mat4x4::FromPosition(Vector3(1.0f, 2.0f, 3.0f));
+
+        // Act
+        Mat4x4 result = Mat4x4::Rotate(translation, 90.0f, Vector3(0.0f, 0.0f, 2.0f));
+
+        // Assert
+        EXPECT_NEAR(result(0, 0), 0.0f, 0.001f);
+        EXPECT_NEAR(result(0, 1), 1.0f, 0.001f);
+        EXPECT_NEAR(result(1, 0), -1.0f, 0.001f);
+        EXPECT_NEAR(result(1, 1), 0.0f, 0.001f);
+        EXPECT_NEAR(result(2, 2), 1.0f, 0.001f);
+        EXPECT_NEAR(result(3, 0), 1.0f, 0.001f);
+        EXPECT_NEAR(result(3, 1), 2.0f, 0.001f);
+        EXPECT_NEAR(result(3, 2), 3.0f, 0.001f);
+        EXPECT_NEAR(result(3, 3), 1.0f, 0.001f);
+    }
+
     TEST(Mat4x4Tests, LookAt_CreatesValidViewMatrix)
     {
         // Arrange
@@ -329,5 +437,156 @@ namespace Tbx::Tests::Core::Math
         EXPECT_NEAR(perspective(2, 3), 1.0f, epsilon);
         EXPECT_NEAR(perspective(3, 3), 0.0f, epsilon);
     }
-}
 
+    TEST(Mat4x4Tests, TransformPoint_AppliesScaleRotationThenTranslation)
+    {
+        // Arrange
+        Mat4x4 matrix = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(0.0f, 90.0f, 0.0f), Vector3(2.0f));
+        Vector3 point(1.0f, 0.0f, 0.0f);
+
+        // Act
+        Vector3 transformedPoint = Mat4x4::TransformPoint(matrix, point);
+        Vector3 transformedDirection = Mat4x4::TransformDirection(matrix, point);
+
+        // Assert
+        EXPECT_NEAR(transformedPoint.X, 1.0f, 1e-5f);
+        EXPECT_NEAR(transformedPoint.Y, 2.0f, 1e-5f);
+        EXPECT_NEAR(std::fabs(transformedPoint.Z - 3.0f), 2.0f, 1e-5f);
+        EXPECT_NEAR(transformedDirection.X, 0.0f, 1e-5f);
+        EXPECT_NEAR(std::fabs(transformedDirection.Z), 2.0f, 1e-5f);
+    }
+
+    TEST(Mat4x4Tests, TransformPointProjective_DividesByW)
+    {
+        // Arrange
+        Mat4x4 projection = Mat4x4::PerspectiveProjection(1.2f, 1.5f, 0.1f, 100.0f);
+        Vector3 point(2.0f, -1.0f, 10.0f);
+
+        // Act
+        Vector3 result = Mat4x4::TransformPointProjective(projection, point);
+
+        // Assert
+        const float w = projection[3] * point.X + projection[7] * point.Y + projection[11] * point.Z + projection[15];
+        EXPECT_NEAR(result.X, (projection[0] * point.X + projection[4] * point.Y + projection[8] * point.Z + projection[12]) / w, 1e-6f);
+        EXPECT_NEAR(result.Y, (projection[1] * point.X + projection[5] * point.Y + projection[9] * point.Z + projection[13]) / w, 1e-6f);
+        EXPECT_NEAR(result.Z, (projection[2] * point.X + projection[6] * point.Y + projection[10] * point.Z + projection[14]) / w, 1e-6f);
+    }
+
+    TEST(Mat4x4Tests, TransformBatches_MatchScalarTransforms)
+    {
+        // Arrange
+        Mat4x4 matrix = Mat4x4::FromTRS(Vector3(4.0f, -2.0f, 7.0f), Quaternion::FromEuler(30.0f, 45.0f, -60.0f), Vector3(1.5f, 0.5f, 2.0f));
+        Mat4x4 projection = Mat4x4::PerspectiveProjection(1.2f, 1.5f, 0.1f, 100.0f);
+        std::vector<Vector3> points;
+        for (int i = 0; i < 37; i++)
+        {
+            const auto f = static_cast<float>(i);
+            points.emplace_back(f * 0.5f - 9.0f, std::sin(f) * 3.0f, f + 1.0f);
+        }
+        std::vector<Vector3> transformedPoints(points.size());
+        std::vector<Vector3> transformedDirections(points.size());
+        std::vector<Vector3> projectedPoints(points.size());
+
+        // Act
+        Mat4x4::TransformPoints(matrix, points, transformedPoints);
+        Mat4x4::TransformDirections(matrix, points, transformedDirections);
+        Mat4x4::TransformPointsProjective(projection, points, projectedPoints);
+
+        // Assert
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            const Vector3 point = Mat4x4::TransformPoint(matrix, points[i]);
+            const Vector3 direction = Mat4x4::TransformDirection(matrix, points[i]);
+            const Vector3 projected = Mat4x4::TransformPointProjective(projection, points[i]);
+            EXPECT_NEAR(transformedPoints[i].X, point.X, 1e-4f);
+            EXPECT_NEAR(transformedPoints[i].Y, point.Y, 1e-4f);
+            EXPECT_NEAR(transformedPoints[i].Z, point.Z, 1e-4f);
+            EXPECT_NEAR(transformedDirections[i].X, direction.X, 1e-4f);
+            EXPECT_NEAR(transformedDirections[i].Y, direction.Y, 1e-4f);
+            EXPECT_NEAR(transformedDirections[i].Z, direction.Z, 1e-4f);
+            EXPECT_NEAR(projectedPoints[i].X, projected.X, 1e-5f);
+            EXPECT_NEAR(projectedPoints[i].Y, projected.Y, 1e-5f);
+            EXPECT_NEAR(projectedPoints[i].Z, projected.Z, 1e-5f);
+        }
+        EXPECT_THROW(Mat4x4::TransformPoints(matrix, points, std::span(transformedPoints).first(3)), std::out_of_range);
+    }
+
+    TEST(Mat4x4Tests, TransformPoints_ThreadedAndInPlaceMatchSingleThreaded)
+    {
+        // Arrange
+        Mat4x4 matrix = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(10.0f, 20.0f, 30.0f), Vector3(1.0f));
+        std::vector<Vector3> points;
+        for (int i = 0; i < 20003; i++)
+        {
+            const auto f = static_cast<float>(i);
+            points.emplace_back(f * 0.01f, -f * 0.02f, std::cos(f));
+        }
+        std::vector<Vector3> expected(points.size());
+        std::vector<Vector3> threaded(points.size());
+        ThreadPool pool(3);
+
+        // Act
+        Mat4x4::TransformPoints(matrix, points, expected);
+        Mat4x4::TransformPoints(matrix, points, threaded, pool);
+        Mat4x4::TransformPoints(matrix, points, points);
+
+        // Assert
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            ASSERT_EQ(threaded[i].ToString(), expected[i].ToString());
+            ASSERT_EQ(points[i].ToString(), expected[i].ToString());
+        }
+    }
+
+    TEST(Mat4x4Tests, Builders_AtCompileTime_MatchRuntime)
+    {
+        // Arrange
+        constexpr Mat4x4 view = Mat4x4::LookAt(Vector3(3.0f, 4.0f, -5.0f), Vector3(0.0f), Vector3(0.0f, 1.0f, 0.0f));
+        constexpr Mat4x4 perspective = Mat4x4::PerspectiveProjection(Tbx::Math::DegreesToRadians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+        constexpr Mat4x4 orthographic = Mat4x4::OrthographicProjection(Bounds::FromOrthographicProjection(5.0f, 16.0f / 9.0f), 0.1f, 100.0f);
+        constexpr Mat4x4 model = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), 90.0f), Vector3(2.0f));
+        float fov = 60.0f;
+        float eyeX = 3.0f;
+        float angle = 90.0f;
+
+        // Act
+        const Mat4x4 runtimeView = Mat4x4::LookAt(Vector3(eyeX, 4.0f, -5.0f), Vector3(0.0f), Vector3(0.0f, 1.0f, 0.0f));
+        const Mat4x4 runtimePerspective = Mat4x4::PerspectiveProjection(Tbx::Math::DegreesToRadians(fov), 16.0f / 9.0f, 0.1f, 100.0f);
+        const Mat4x4 runtimeOrthographic = Mat4x4::OrthographicProjection(Bounds::FromOrthographicProjection(5.0f, 16.0f / 9.0f), 0.1f, 100.0f);
+        const Mat4x4 runtimeModel = Mat4x4::FromTRS(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), angle), Vector3(2.0f));
+
+        // Assert
+        static_assert(Constants::Mat4x4::Identity == Mat4x4());
+        static_assert(model[12] == 1.0f && model[15] == 1.0f);
+        for (int i = 0; i < 16; i++)
+        {
+            EXPECT_NEAR(view[i], runtimeView[i], 1e-6f) << i;
+            EXPECT_NEAR(perspective[i], runtimePerspective[i], 1e-6f) << i;
+            EXPECT_EQ(orthographic[i], runtimeOrthographic[i]) << i;
+            EXPECT_NEAR(model[i], runtimeModel[i], 1e-6f) << i;
+        }
+    }
+
+    TEST(Mat4x4Tests, TaggedConstructors_MatchInitializerListConstructors)
+    {
+        // Arrange
+        const Mat4x4 upright =
+        {
+            { 1.0f, 2.0f, 3.0f, 4.0f },
+            { 5.0f, 6.0f, 7.0f, 8.0f },
+            { 9.0f, 10.0f, 11.0f, 12.0f },
+            { 13.0f, 14.0f, 15.0f, 16.0f }
+        };
+
+        // Act
+        constexpr Mat4x4 rowMajor(RowMajor, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+        constexpr Mat4x4 columnMajor(ColumnMajor, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, 4, 8, 12, 16);
+
+        // Assert
+        static_assert(noexcept(Mat4x4()) && noexcept(Mat4x4(RowMajor, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)));
+        static_assert(!std::is_constructible_v<Mat4x4, RowMajorTag, float, float, float>);
+        static_assert(rowMajor == columnMajor && rowMajor(0, 1) == 5.0f && rowMajor(1, 0) == 2.0f);
+        EXPECT_EQ(rowMajor, upright);
+        EXPECT_EQ(columnMajor, upright);
+    }
+}
@@ -0,0 +1,65 @@
+#include "PCH.h"
+#include "Tbx/Math/Mat.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    TEST(MatTests, Multiply_Float4x4_MatchesMat4x4)
+    {
+        // Arrange
+        Mat4x4 lhs = Mat4x4::FromTRS(Vector3(1, 2, 3), Quaternion::FromEuler(10, 20, 30), Vector3(2, 1, 0.5f));
+        Mat4x4 rhs = Mat4x4::PerspectiveProjection(60.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+
+        // Act
+        Mat<float, 4, 4> result = Mat<float, 4, 4>(lhs) * Mat<float, 4, 4>(rhs);
+
+        // Assert
+        EXPECT_EQ(static_cast<Mat4x4>(result), lhs * rhs);
+    }
+
+    TEST(MatTests, Multiply_Double4x4_MatchesMat4x4WithinFloatPrecision)
+    {
+        // Arrange
+        Mat4x4 lhs = Mat4x4::FromTRS(Vector3(1, 2, 3), Quaternion::FromEuler(10, 20, 30), Vector3(2, 1, 0.5f));
+        Mat4x4 rhs = Mat4x4::FromTRS(Vector3(-4, 5, 6), Quaternion::FromEuler(-40, 5, 90), Vector3(1, 3, 1));
+        std::array<double, 16> lhsValues = {};
+        std::array<double, 16> rhsValues = {};
+        for (int i = 0; i < 16; i++)
+        {
+            lhsValues[i] = lhs.Values[i];
+            rhsValues[i] = rhs.Values[i];
+        }
+
+        // Act
+        Mat4x4D result = Mat4x4D(lhsValues) * Mat4x4D(rhsValues);
+        Mat4x4 expected = lhs * rhs;
+
+        // Assert
+        for (int i = 0; i < 16; i++)
+        {
+            EXPECT_NEAR(result.Values[i], expected.Values[i], 1e-5);
+        }
+    }
+
+    TEST(MatTests, Multiply_NonSquare_ProducesRowsByColumns)
+    {
+        // Arrange
+        Mat<int, 2, 3> lhs(RowMajor,
+            1, 2, 3,
+            4, 5, 6);
+        Mat<int, 3, 2> rhs(RowMajor,
+            7, 8,
+            9, 10,
+            11, 12);
+
+        // Act
+        Mat<int, 2, 2> product = lhs * rhs;
+        Vec<int, 2> transformed = lhs * Vector3I(1, 0, -1);
+        Mat<int, 3, 2> transposed = Mat<int, 2, 3>::Transpose(lhs);
+
+        // Assert
+        EXPECT_EQ(product, (Mat<int, 2, 2>(RowMajor, 58, 64, 139, 154)));
+        EXPECT_EQ(transformed, Vector2I(-2, -2));
+        EXPECT_EQ(transposed.At(2, 1), 6);
+        EXPECT_EQ(Mat3x3D() * Vector3D(1, 2, 3), Vector3D(1, 2, 3));
+    }
+}
@@ -0,0 +1,131 @@
+#include "PCH.h"
+#include "Tbx/Math/PackedVectors.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static Vector3 MakePosition(int i)
+    {
+        const auto f = static_cast<float>(i);
+        return { std::sin(f * 1.7f) * 40.0f, std::cos(f * 0.3f) * 3.0f - 1.0f, f * 0.25f - 2.0f };
+    }
+
+    TEST(Vector3HTests, FloatToHalf_MatchesKnownEncodings)
+    {
+        // Arrange
+        const std::pair<float, uint16> cases[] =
+        {
+            { 0.0f, 0x0000 }, { -0.0f, 0x8000 }, { 1.0f, 0x3C00 }, { -2.0f, 0xC000 }, { 65504.0f, 0x7BFF },
+            { 65520.0f, 0x7C00 }, { 1e9f, 0x7C00 }, { 5.9604645e-8f, 0x0001 }, { 6.097555e-5f, 0x03FF }, { 1.0f + 1.0f / 2048.0f, 0x3C00 },
+            { 1.0f + 3.0f / 2048.0f, 0x3C02 }, { std::numeric_limits<float>::infinity(), 0x7C00 }
+        };
+
+        for (const auto& [value, expected] : cases)
+        {
+            // Act
+            uint16 half = Vector3H::FloatToHalf(value);
+
+            // Assert
+            EXPECT_EQ(half, expected) << value;
+        }
+        EXPECT_TRUE(std::isnan(Vector3H::HalfToFloat(Vector3H::FloatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+    }
+
+    TEST(Vector3HTests, HalfToFloat_RoundTripsEveryFiniteHalf)
+    {
+        for (uint32 half = 0; half < 0x10000; half++)
+        {
+            // Skip infinities and NaNs
+            if ((half & 0x7C00) == 0x7C00) continue;
+
+            // Act
+            float value = Vector3H::HalfToFloat(static_cast<uint16>(half));
+
+            // Assert
+            ASSERT_EQ(Vector3H::FloatToHalf(value), half);
+        }
+    }
+
+    TEST(Vector3HTests, Batch_MatchesScalar)
+    {
+        // Arrange
+        std::vector<Vector3> vectors;
+        for (int i = 0; i < 23; i++)
+        {
+            vectors.push_back(MakePosition(i) * 1.37f);
+        }
+        std::vector<Vector3H> halves(vectors.size());
+        std::vector<Vector3> restored(vectors.size());
+
+        // Act
+        Vector3H::FromVector3Batch(vectors, halves);
+        Vector3H::ToVector3Batch(halves, restored);
+
+        // Assert
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+            EXPECT_EQ(halves[i], Vector3H(vectors[i]));
+            EXPECT_EQ(restored[i].ToString(), halves[i].ToVector3().ToString());
+            EXPECT_NEAR(restored[i].X, vectors[i].X, std::fabs(vectors[i].X) / 2048.0f);
+        }
+        EXPECT_THROW(Vector3H::ToVector3Batch(halves, std::span(restored).first(2)), std::out_of_range);
+    }
+
+    TEST(Vector3Q16Tests, QuantizeDequantize_RoundTripsWithinOneStep)
+    {
+        // Arrange
+        const AABB bounds = { { -40.0f, -4.0f, -2.0f }, { 40.0f, 2.0f, 10.0f } };
+        const Vector3 maxError = bounds.GetSize() * (0.5f / 65535.0f) + Vector3(1e-5f);
+
+        for (int i = 0; i < 48; i++)
+        {
+            // Act
+            Vector3 position = MakePosition(i);
+            Vector3 restored = Vector3Q16::Dequantize(Vector3Q16::Quantize(position, bounds), bounds);
+
+            // Assert
+            EXPECT_NEAR(restored.X, position.X, maxError.X);
+            EXPECT_NEAR(restored.Y, position.Y, maxError.Y);
+            EXPECT_NEAR(restored.Z, position.Z, maxError.Z);
+        }
+    }
+
+    TEST(Vector3Q16Tests, Quantize_ClampsToBoundsAndHandlesFlatAxes)
+    {
+        // Arrange
+        const AABB bounds = { { 0.0f, 1.0f, 5.0f }, { 10.0f, 1.0f, 6.0f } };
+
+        // Act
+        Vector3Q16 below = Vector3Q16::Quantize({ -5.0f, 1.0f, 4.0f }, bounds);
+        Vector3Q16 above = Vector3Q16::Quantize({ 20.0f, 7.0f, 9.0f }, bounds);
+
+        // Assert
+        EXPECT_EQ(below, (Vector3Q16{ 0, 0, 0 }));
+        EXPECT_EQ(above, (Vector3Q16{ 65535, 0, 65535 }));
+        EXPECT_EQ(Vector3Q16::Dequantize(above, bounds).ToString(), Vector3(10.0f, 1.0f, 6.0f).ToString());
+    }
+
+    TEST(Vector3Q16Tests, Batch_MatchesScalar)
+    {
+        // Arrange
+        const AABB bounds = { { -40.0f, -4.0f, -2.0f }, { 40.0f, 2.0f, 10.0f } };
+        std::vector<Vector3> positions;
+        for (int i = 0; i < 29; i++)
+        {
+            positions.push_back(MakePosition(i));
+        }
+        std::vector<Vector3Q16> quantized(positions.size());
+        std::vector<Vector3> restored(positions.size());
+
+        // Act
+        Vector3Q16::QuantizeBatch(positions, bounds, quantized);
+        Vector3Q16::DequantizeBatch(quantized, bounds, restored);
+
+        // Assert
+        for (size_t i = 0; i < positions.size(); i++)
+        {
+            EXPECT_EQ(quantized[i], Vector3Q16::Quantize(positions[i], bounds));
+            EXPECT_EQ(restored[i].ToString(), Vector3Q16::Dequantize(quantized[i], bounds).ToString());
+        }
+        EXPECT_THROW(Vector3Q16::QuantizeBatch(positions, bounds, std::span(quantized).first(5)), std::out_of_range);
+    }
+}
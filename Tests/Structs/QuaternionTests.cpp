@@ -310,4 +310,239 @@ namespace Tbx::Tests::Core::Math
         EXPECT_NEAR(identity.W, 1.0f, 1e-6f);
     }
 
+    TEST(QuaternionTests, FromEulerBatch_MatchesFromEuler)
+    {
+        // Arrange
+        std::vector<Vector3> euler;
+        for (int i = 0; i < 37; i++)
+        {
+            euler.emplace_back(static_cast<float>(i * 23 % 360) - 180.0f, static_cast<float>(i * 7 % 160) - 80.0f, static_cast<float>(i * 41 % 720) - 360.0f);
+        }
+        std::vector<Quaternion> batch(euler.size());
+
+        // Act
+        Quaternion::FromEulerBatch(euler, batch);
+
+        // Assert
+        for (size_t i = 0; i < euler.size(); i++)
+        {
+            const Quaternion expected = Quaternion::FromEuler(euler[i]);
+            EXPECT_NEAR(batch[i].X, expected.X, 1e-6f) << i;
+            EXPECT_NEAR(batch[i].Y, expected.Y, 1e-6f) << i;
+            EXPECT_NEAR(batch[i].Z, expected.Z, 1e-6f) << i;
+            EXPECT_NEAR(batch[i].W, expected.W, 1e-6f) << i;
+        }
+    }
+
+    TEST(QuaternionTests, ToEulerBatch_MatchesToEuler)
+    {
+        // Arrange
+        std::vector<Quaternion> quaternions;
+        for (int i = 0; i < 37; i++)
+        {
+            quaternions.push_back(Quaternion::FromEuler(static_cast<float>(i * 23 % 360) - 180.0f, static_cast<float>(i * 7 % 160) - 80.0f, static_cast<float>(i * 41 % 360) - 180.0f));
+        }
+        quaternions.push_back(Constants::Quaternion::Identity);
+        std::vector<Vector3> batch(quaternions.size());
+
+        // Act
+        Quaternion::ToEulerBatch(quaternions, batch);
+
+        // Assert
+        for (size_t i = 0; i < quaternions.size(); i++)
+        {
+            const Vector3 expected = Quaternion::ToEuler(quaternions[i]);
+            EXPECT_NEAR(batch[i].X, expected.X, 1e-3f) << i;
+            EXPECT_NEAR(batch[i].Y, expected.Y, 1e-3f) << i;
+            EXPECT_NEAR(batch[i].Z, expected.Z, 1e-3f) << i;
+        }
+    }
+
+    TEST(QuaternionTests, FromEulerBatch_WithSmallerOutput_Throws)
+    {
+        // Arrange
+        std::vector<Vector3> euler(5);
+        std::vector<Quaternion> out(4);
+
+        // Act & Assert
+        EXPECT_THROW(Quaternion::FromEulerBatch(euler, out), std::out_of_range);
+    }
+
+    static float AngleBetween(const Quaternion& lhs, const Quaternion& rhs)
+    {
+        // The rotation angle is 4 * asin(chord / 2), which unlike acos(dot) stays accurate for nearly equal rotations
+        const double sign = Quaternion::Dot(lhs, rhs) < 0.0f ? -1.0 : 1.0;
+        const double x = lhs.X - sign * rhs.X;
+        const double y = lhs.Y - sign * rhs.Y;
+        const double z = lhs.Z - sign * rhs.Z;
+        const double w = lhs.W - sign * rhs.W;
+        return static_cast<float>(4.0 * std::asin(std::min(1.0, std::sqrt(x * x + y * y + z * z + w * w) * 0.5)));
+    }
+
+    TEST(QuaternionTests, Slerp_Halfway_ReturnsHalfRotation)
+    {
+        // Arrange
+        const Quaternion from = Constants::Quaternion::Identity;
+        const Quaternion to = Quaternion::FromEuler(0.0f, 90.0f, 0.0f);
+
+        // Act
+        const Quaternion result = Quaternion::Slerp(from, to, 0.5f);
+
+        // Assert
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(result, Quaternion::FromEuler(0.0f, 45.0f, 0.0f)));
+    }
+
+    TEST(QuaternionTests, Slerp_WithNegatedTarget_TakesShortestPath)
+    {
+        // Arrange
+        const Quaternion from = Constants::Quaternion::Identity;
+        const Quaternion to = Quaternion::FromEuler(0.0f, 90.0f, 0.0f);
+        const Quaternion negatedTo = { -to.X, -to.Y, -to.Z, -to.W };
+
+        // Act
+        const Quaternion result = Quaternion::Slerp(from, negatedTo, 0.5f);
+
+        // Assert
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(result, Quaternion::FromEuler(0.0f, 45.0f, 0.0f)));
+    }
+
+    TEST(QuaternionTests, Nlerp_ReturnsUnitQuaternionBetweenEndpoints)
+    {
+        // Arrange
+        const Quaternion from = Quaternion::FromEuler(10.0f, 0.0f, 0.0f);
+        const Quaternion to = Quaternion::FromEuler(10.0f, 120.0f, 0.0f);
+
+        // Act
+        const Quaternion start = Quaternion::Nlerp(from, to, 0.0f);
+        const Quaternion end = Quaternion::Nlerp(from, to, 1.0f);
+        const Quaternion middle = Quaternion::Nlerp(from, to, 0.3f);
+
+        // Assert
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(start, from));
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(end, to));
+        EXPECT_NEAR(Quaternion::Dot(middle, middle), 1.0f, 1e-6f);
+    }
+
+    TEST(QuaternionTests, FastSlerp_StaysWithinDocumentedErrorOfSlerp)
+    {
+        // Arrange
+        const Quaternion from = Quaternion::FromEuler(30.0f, -20.0f, 10.0f);
+        float maxError = 0.0f;
+
+        // Act
+        for (int angle = 0; angle < 360; angle += 15)
+        {
+            const Quaternion to = Quaternion::FromEuler(static_cast<float>(angle), static_cast<float>(angle) * 0.5f, 80.0f);
+            for (float t = 0.0f; t <= 1.0f; t += 0.05f)
+            {
+                maxError = std::max(maxError, AngleBetween(Quaternion::FastSlerp(from, to, t), Quaternion::Slerp(from, to, t)));
+            }
+        }
+
+        // Assert
+        EXPECT_LT(maxError, 1e-3f);
+    }
+
+    TEST(QuaternionTests, BlendBatches_MatchScalarBlends)
+    {
+        // Arrange
+        std::vector<Quaternion> from;
+        std::vector<Quaternion> to;
+        std::vector<float> t;
+        for (int i = 0; i < 37; i++)
+        {
+            from.push_back(Quaternion::FromEuler(static_cast<float>(i * 17 % 360), static_cast<float>(i * 5 % 170) - 85.0f, 0.0f));
+            to.push_back(Quaternion::FromEuler(static_cast<float>(i * 29 % 360), 10.0f, static_cast<float>(i * 11 % 360)));
+            t.push_back(static_cast<float>(i % 11) / 10.0f);
+        }
+        to[3] = from[3];
+        std::vector<Quaternion> slerp(from.size());
+        std::vector<Quaternion> slerpSameT(from.size());
+        std::vector<Quaternion> nlerp(from.size());
+        std::vector<Quaternion> fastSlerp(from.size());
+
+        // Act
+        Quaternion::SlerpBatch(from, to, t, slerp);
+        Quaternion::SlerpBatch(from, to, 0.25f, slerpSameT);
+        Quaternion::NlerpBatch(from, to, t, nlerp);
+        Quaternion::FastSlerpBatch(from, to, t, fastSlerp);
+
+        // Assert
+        for (size_t i = 0; i < from.size(); i++)
+        {
+            EXPECT_LT(AngleBetween(slerp[i], Quaternion::Slerp(from[i], to[i], t[i])), 1e-5f) << i;
+            EXPECT_LT(AngleBetween(slerpSameT[i], Quaternion::Slerp(from[i], to[i], 0.25f)), 1e-5f) << i;
+            EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(nlerp[i], Quaternion::Nlerp(from[i], to[i], t[i]))) << i;
+            EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(fastSlerp[i], Quaternion::FastSlerp(from[i], to[i], t[i]))) << i;
+        }
+    }
+
+    TEST(QuaternionTests, SlerpBatch_WithSmallerTSpan_Throws)
+    {
+        // Arrange
+        std::vector<Quaternion> from(5);
+        std::vector<Quaternion> to(5);
+        std::vector<float> t(4);
+        std::vector<Quaternion> out(5);
+
+        // Act & Assert
+        EXPECT_THROW(Quaternion::SlerpBatch(from, to, t, out), std::out_of_range);
+    }
+
+    TEST(QuaternionTests, RotateBatches_MatchScalarRotation)
+    {
+        // Arrange
+        const Quaternion rotation = Quaternion::FromEuler(30.0f, -45.0f, 60.0f);
+        std::vector<Quaternion> rotations;
+        std::vector<Vector3> vectors;
+        for (int i = 0; i < 37; i++)
+        {
+            const auto f = static_cast<float>(i);
+            rotations.push_back(Quaternion::FromEuler(f * 17.0f, f * 5.0f - 85.0f, f * 11.0f));
+            vectors.emplace_back(f - 18.0f, std::sin(f) * 4.0f, 2.0f * f);
+        }
+        std::vector<Vector3> rotatedSame(vectors.size());
+        std::vector<Vector3> rotatedEach(vectors.size());
+        std::vector<Vector3> rotatedInPlace = vectors;
+
+        // Act
+        Quaternion::RotateBatch(rotation, vectors, rotatedSame);
+        Quaternion::RotateBatch(rotations, vectors, rotatedEach);
+        Quaternion::RotateBatch(rotation, rotatedInPlace, rotatedInPlace);
+
+        // Assert
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+            const Vector3 same = rotation * vectors[i];
+            const Vector3 each = rotations[i] * vectors[i];
+            EXPECT_NEAR(rotatedSame[i].X, same.X, 1e-4f) << i;
+            EXPECT_NEAR(rotatedSame[i].Y, same.Y, 1e-4f) << i;
+            EXPECT_NEAR(rotatedSame[i].Z, same.Z, 1e-4f) << i;
+            EXPECT_NEAR(rotatedEach[i].X, each.X, 1e-4f) << i;
+            EXPECT_NEAR(rotatedEach[i].Y, each.Y, 1e-4f) << i;
+            EXPECT_NEAR(rotatedEach[i].Z, each.Z, 1e-4f) << i;
+            EXPECT_EQ(rotatedInPlace[i].ToString(), rotatedSame[i].ToString()) << i;
+        }
+        EXPECT_THROW(Quaternion::RotateBatch(std::span(rotations).first(36), vectors, rotatedEach), std::out_of_range);
+    }
+
+    TEST(QuaternionTests, Builders_AtCompileTime_MatchRuntime)
+    {
+        // Arrange
+        constexpr Quaternion euler = Quaternion::FromEuler(30.0f, -45.0f, 120.0f);
+        constexpr Quaternion axisAngle = Quaternion::FromAxisAngle(Vector3(1.0f, 2.0f, 3.0f), 75.0f);
+        constexpr Quaternion fromVector = Vector3(10.0f, 20.0f, 30.0f);
+        float x = 30.0f;
+        float angle = 75.0f;
+
+        // Act
+        const Quaternion runtimeEuler = Quaternion::FromEuler(x, -45.0f, 120.0f);
+        const Quaternion runtimeAxisAngle = Quaternion::FromAxisAngle(Vector3(1.0f, 2.0f, 3.0f), angle);
+
+        // Assert
+        static_assert(Constants::Quaternion::Identity.W == 1.0f);
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(euler, runtimeEuler, 1e-6f));
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(axisAngle, runtimeAxisAngle, 1e-6f));
+        EXPECT_TRUE(Quaternion::IsEqualOrEquivalent(fromVector, Quaternion::FromEuler(x / 3.0f, 20.0f, 30.0f), 1e-6f));
+    }
 }
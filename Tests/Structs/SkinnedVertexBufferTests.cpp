@@ -0,0 +1,163 @@
+#include "PCH.h"
+#include "Tbx/Math/SkinnedVertexBuffer.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static SkinnedVertexBuffer::Vertex MakeVertex(int i, uint32 jointCount)
+    {
+        const auto f = static_cast<float>(i);
+        SkinnedVertexBuffer::Vertex vertex;
+        vertex.Position = Vector3(f, 1.0f - f * 0.5f, f * 0.25f);
+        vertex.Normal = Vector3::Normalize(Vector3(1.0f, f, 2.0f));
+        vertex.Joints = { i % jointCount, (i + 1) % jointCount, (i + 2) % jointCount, (i + 3) % jointCount };
+        vertex.Weights = { 0.4f, 0.3f, 0.2f, 0.1f };
+        return vertex;
+    }
+
+    static std::vector<Mat4x4> MakeSkinMatrices(uint32 count)
+    {
+        std::vector<Mat4x4> matrices;
+        for (uint32 i = 0; i < count; i++)
+        {
+            const auto f = static_cast<float>(i);
+            matrices.push_back(Mat4x4::FromTRS(Vector3(f, -f, 2.0f * f), Quaternion::FromEuler(f * 11.0f, f * 17.0f, f * 5.0f), Vector3(1.0f + f * 0.1f)));
+        }
+        return matrices;
+    }
+
+    TEST(SkinnedVertexBufferTests, Add_StoresVertexComponents)
+    {
+        // Arrange
+        SkinnedVertexBuffer buffer;
+        SkinnedVertexBuffer::Vertex vertex = MakeVertex(3, 8);
+
+        // Act
+        size_t index = buffer.Add(vertex);
+        SkinnedVertexBuffer::Vertex result = buffer.Get(index);
+
+        // Assert
+        EXPECT_EQ(index, 0u);
+        EXPECT_EQ(buffer.Size(), 1u);
+        EXPECT_EQ(result.Position.ToString(), vertex.Position.ToString());
+        EXPECT_EQ(result.Normal.ToString(), vertex.Normal.ToString());
+        EXPECT_EQ(result.Joints, vertex.Joints);
+        EXPECT_EQ(result.Weights, vertex.Weights);
+    }
+
+    TEST(SkinnedVertexBufferTests, Skin_WithSingleJoint_TransformsByItsMatrix)
+    {
+        // Arrange
+        SkinnedVertexBuffer::Vertex vertex;
+        vertex.Position = Vector3(1.0f, 2.0f, 3.0f);
+        vertex.Normal = Vector3(0.0f, 1.0f, 0.0f);
+        vertex.Joints = { 1, 0, 0, 0 };
+        SkinnedVertexBuffer buffer;
+        buffer.Add(vertex);
+        std::vector<Mat4x4> matrices = { Mat4x4(), Mat4x4::FromPosition(Vector3(10.0f, 20.0f, 30.0f)) };
+        std::vector<Vector3> positions(1);
+        std::vector<Vector3> normals(1);
+
+        // Act
+        buffer.Skin(matrices, positions, normals);
+
+        // Assert
+        EXPECT_FLOAT_EQ(positions[0].X, 11.0f);
+        EXPECT_FLOAT_EQ(positions[0].Y, 22.0f);
+        EXPECT_FLOAT_EQ(positions[0].Z, 33.0f);
+        EXPECT_FLOAT_EQ(normals[0].X, 0.0f);
+        EXPECT_FLOAT_EQ(normals[0].Y, 1.0f);
+        EXPECT_FLOAT_EQ(normals[0].Z, 0.0f);
+    }
+
+    TEST(SkinnedVertexBufferTests, Skin_BlendsJointMatricesByWeight)
+    {
+        // Arrange
+        std::vector<SkinnedVertexBuffer::Vertex> vertices;
+        for (int i = 0; i < 37; i++)
+            vertices.push_back(MakeVertex(i, 5));
+        SkinnedVertexBuffer buffer(vertices);
+        std::vector<Mat4x4> matrices = MakeSkinMatrices(5);
+        std::vector<Vector3> positions(vertices.size());
+        std::vector<Vector3> normals(vertices.size());
+
+        // Act
+        buffer.Skin(matrices, positions, normals);
+
+        // Assert
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            Vector3 expected = Vector3(0.0f);
+            for (size_t k = 0; k < SkinnedVertexBuffer::MaxInfluences; k++)
+                expected = expected + Mat4x4::TransformPoint(matrices[vertices[i].Joints[k]], vertices[i].Position) * vertices[i].Weights[k];
+            EXPECT_NEAR(positions[i].X, expected.X, 1e-4f);
+            EXPECT_NEAR(positions[i].Y, expected.Y, 1e-4f);
+            EXPECT_NEAR(positions[i].Z, expected.Z, 1e-4f);
+            EXPECT_NEAR(Vector3::Dot(normals[i], normals[i]), 1.0f, 1e-5f);
+        }
+    }
+
+    TEST(SkinnedVertexBufferTests, Skin_WithThreadPool_MatchesSingleThreaded)
+    {
+        // Arrange
+        std::vector<SkinnedVertexBuffer::Vertex> vertices;
+        for (int i = 0; i < 10007; i++)
+            vertices.push_back(MakeVertex(i, 16));
+        SkinnedVertexBuffer buffer(vertices);
+        std::vector<Mat4x4> matrices = MakeSkinMatrices(16);
+        std::vector<Vector3> positions(vertices.size());
+        std::vector<Vector3> normals(vertices.size());
+        std::vector<Vector3> pooledPositions(vertices.size());
+        std::vector<Vector3> pooledNormals(vertices.size());
+        ThreadPool pool(4);
+
+        // Act
+        buffer.Skin(matrices, positions, normals);
+        buffer.Skin(matrices, pooledPositions, pooledNormals, pool);
+
+        // Assert
+        for (size_t i = 0; i < vertices.size(); i++)
+        {
+            EXPECT_EQ(pooledPositions[i].ToString(), positions[i].ToString());
+            EXPECT_EQ(pooledNormals[i].ToString(), normals[i].ToString());
+        }
+    }
+
+    TEST(SkinnedVertexBufferTests, Skin_WithMissingSkinMatrixOrSmallerOutput_Throws)
+    {
+        // Arrange
+        SkinnedVertexBuffer buffer;
+        buffer.Add(MakeVertex(0, 4));
+        buffer.Add(MakeVertex(1, 4));
+        std::vector<Mat4x4> matrices = MakeSkinMatrices(4);
+        std::vector<Mat4x4> fewerMatrices = MakeSkinMatrices(3);
+        std::vector<Vector3> outputs(2);
+        std::vector<Vector3> smallerOutputs(1);
+
+        // Act & Assert
+        EXPECT_THROW(buffer.Skin(fewerMatrices, outputs, outputs), std::out_of_range);
+        EXPECT_THROW(buffer.Skin(matrices, smallerOutputs, outputs), std::out_of_range);
+        EXPECT_THROW(buffer.Skin(matrices, outputs, smallerOutputs), std::out_of_range);
+    }
+
+    TEST(SkinnedVertexBufferTests, Set_UpdatesTheJointsSkinChecks)
+    {
+        // Arrange
+        SkinnedVertexBuffer buffer;
+        buffer.Add(MakeVertex(0, 2));
+        buffer.Add(MakeVertex(1, 2));
+        std::vector<Mat4x4> twoMatrices = MakeSkinMatrices(2);
+        std::vector<Mat4x4> fiveMatrices = MakeSkinMatrices(5);
+        std::vector<Vector3> outputs(2);
+        SkinnedVertexBuffer::Vertex vertex = MakeVertex(0, 2);
+        vertex.Joints = { 0, 4, 0, 0 };
+
+        // Act & Assert
+        buffer.Set(1, vertex);
+        EXPECT_THROW(buffer.Skin(twoMatrices, outputs, outputs), std::out_of_range);
+        EXPECT_NO_THROW(buffer.Skin(fiveMatrices, outputs, outputs));
+        buffer.Set(1, MakeVertex(1, 2));
+        EXPECT_NO_THROW(buffer.Skin(twoMatrices, outputs, outputs));
+        buffer.Clear();
+        EXPECT_NO_THROW(buffer.Skin({}, outputs, outputs));
+    }
+}
@@ -0,0 +1,87 @@
+#include "PCH.h"
+#include "Tbx/Math/ThreadPool.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    TEST(ThreadPoolTests, ParallelFor_VisitsEveryIndexOnce)
+    {
+        // Arrange
+        ThreadPool pool(4);
+        std::vector<int> visits(10000, 0);
+
+        // Act
+        pool.ParallelFor(visits.size(), 64, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                visits[i]++;
+        });
+
+        // Assert
+        EXPECT_EQ(pool.GetThreadCount(), 4u);
+        for (int count : visits)
+            EXPECT_EQ(count, 1);
+    }
+
+    TEST(ThreadPoolTests, ParallelFor_CanBeCalledRepeatedly)
+    {
+        // Arrange
+        ThreadPool pool(3);
+        std::atomic<size_t> total = 0;
+
+        // Act
+        for (int i = 0; i < 100; i++)
+        {
+            pool.ParallelFor(1000, 10, [&](size_t begin, size_t end) { total += end - begin; });
+        }
+
+        // Assert
+        EXPECT_EQ(total.load(), 100000u);
+    }
+
+    TEST(ThreadPoolTests, ParallelFor_FromSeveralThreads_RunsEveryCallsWork)
+    {
+        // Arrange
+        ThreadPool pool(4);
+        std::vector<std::vector<int>> visits(4, std::vector<int>(5000, 0));
+        std::vector<std::thread> callers;
+
+        // Act
+        for (auto& callerVisits : visits)
+        {
+            callers.emplace_back([&pool, &callerVisits]()
+            {
+                for (int i = 0; i < 20; i++)
+                {
+                    pool.ParallelFor(callerVisits.size(), 32, [&](size_t begin, size_t end)
+                    {
+                        for (size_t index = begin; index < end; index++)
+                            callerVisits[index]++;
+                    });
+                }
+            });
+        }
+        for (auto& caller : callers)
+            caller.join();
+
+        // Assert
+        for (const auto& callerVisits : visits)
+        {
+            for (int count : callerVisits)
+                EXPECT_EQ(count, 20);
+        }
+    }
+
+    TEST(ThreadPoolTests, ParallelFor_SingleThread_RunsOnCaller)
+    {
+        // Arrange
+        ThreadPool pool(1);
+        std::thread::id caller = std::this_thread::get_id();
+        std::thread::id runner = {};
+
+        // Act
+        pool.ParallelFor(100, 1, [&](size_t, size_t) { runner = std::this_thread::get_id(); });
+
+        // Assert
+        EXPECT_EQ(runner, caller);
+    }
+}
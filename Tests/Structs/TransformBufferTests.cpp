@@ -0,0 +1,132 @@
+#include "PCH.h"
+#include "Tbx/Math/TransformBuffer.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static Transform MakeTransform(int i)
+    {
+        const auto f = static_cast<float>(i);
+        return
+        {
+            Vector3(f, -2.0f * f, 0.5f * f),
+            Quaternion::FromEuler(f * 7.0f, f * 13.0f, f * 29.0f),
+            Vector3(1.0f + f * 0.1f, 2.0f, 0.5f + f * 0.01f)
+        };
+    }
+
+    TEST(TransformBufferTests, Add_StoresTransformComponents)
+    {
+        // Arrange
+        TransformBuffer buffer;
+        Transform transform = MakeTransform(3);
+
+        // Act
+        size_t index = buffer.Add(transform);
+        Transform result = buffer.Get(index);
+
+        // Assert
+        EXPECT_EQ(index, 0u);
+        EXPECT_EQ(buffer.Size(), 1u);
+        EXPECT_EQ(result.ToString(), transform.ToString());
+    }
+
+    TEST(TransformBufferTests, Remove_MovesLastTransformIntoPlace)
+    {
+        // Arrange
+        TransformBuffer buffer;
+        buffer.Add(MakeTransform(0));
+        buffer.Add(MakeTransform(1));
+        buffer.Add(MakeTransform(2));
+
+        // Act
+        buffer.Remove(0);
+
+        // Assert
+        EXPECT_EQ(buffer.Size(), 2u);
+        EXPECT_EQ(buffer.Get(0).ToString(), MakeTransform(2).ToString());
+        EXPECT_EQ(buffer.Get(1).ToString(), MakeTransform(1).ToString());
+    }
+
+    TEST(TransformBufferTests, Set_WritesEveryComponent)
+    {
+        // Arrange
+        TransformBuffer buffer;
+        buffer.Add(MakeTransform(0));
+        buffer.Add(MakeTransform(1));
+
+        // Act
+        buffer.Set(1, MakeTransform(5));
+
+        // Assert
+        EXPECT_EQ(buffer.Get(1).ToString(), MakeTransform(5).ToString());
+        EXPECT_EQ(buffer.Get(0).ToString(), MakeTransform(0).ToString());
+    }
+
+    TEST(TransformBufferTests, GetAndSet_ThrowOutOfRange)
+    {
+        // Arrange
+        TransformBuffer buffer;
+        buffer.Add(MakeTransform(0));
+        buffer.Add(MakeTransform(1));
+
+        // Act
+        buffer.Remove(1);
+
+        // Assert
+        EXPECT_THROW(buffer.Get(2), std::out_of_range);
+        EXPECT_THROW(buffer.Set(2, MakeTransform(2)), std::out_of_range);
+        EXPECT_THROW(buffer.SetPosition(5, Vector3(1.0f)), std::out_of_range);
+        EXPECT_THROW(buffer.Get(1), std::out_of_range);
+        EXPECT_NO_THROW(buffer.Get(0));
+    }
+
+    TEST(TransformBufferTests, ComponentSpans_ReadAndWriteTheBuffer)
+    {
+        // Arrange
+        TransformBuffer buffer;
+        buffer.Add(MakeTransform(0));
+        buffer.Add(MakeTransform(1));
+
+        // Act
+        buffer.GetScaleZ()[1] = 7.0f;
+
+        // Assert
+        const TransformBuffer& constBuffer = buffer;
+        EXPECT_EQ(constBuffer.GetPositionX().size(), buffer.Size());
+        EXPECT_EQ(constBuffer.GetRotationW()[1], MakeTransform(1).Rotation.W);
+        EXPECT_EQ(buffer.Get(1).Scale.Z, 7.0f);
+    }
+
+    TEST(TransformBufferTests, ComputeWorldMatrices_MatchesFromTRS)
+    {
+        // Arrange
+        std::vector<Transform> transforms;
+        for (int i = 0; i < 21; i++)
+            transforms.push_back(MakeTransform(i));
+        TransformBuffer buffer(transforms);
+        std::vector<Mat4x4> matrices(transforms.size());
+
+        // Act
+        buffer.ComputeWorldMatrices(matrices);
+
+        // Assert
+        for (size_t i = 0; i < transforms.size(); i++)
+        {
+            Mat4x4 expected = Mat4x4::FromTRS(transforms[i].Position, transforms[i].Rotation, transforms[i].Scale);
+            for (int j = 0; j < 16; j++)
+                EXPECT_FLOAT_EQ(matrices[i][j], expected[j]);
+        }
+    }
+
+    TEST(TransformBufferTests, ComputeWorldMatrices_WithSmallerOutput_Throws)
+    {
+        // Arrange
+        TransformBuffer buffer;
+        buffer.Add(Transform());
+        buffer.Add(Transform());
+        std::vector<Mat4x4> matrices(1);
+
+        // Act & Assert
+        EXPECT_THROW(buffer.ComputeWorldMatrices(matrices), std::out_of_range);
+    }
+}
@@ -0,0 +1,186 @@
+#include "PCH.h"
+#include "Tbx/Math/TransformHierarchy.h"
+
+namespace Tbx::Tests::Core::Math
+{
+    static void ExpectMatrixNear(const Mat4x4& actual, const Mat4x4& expected)
+    {
+        for (int i = 0; i < 16; i++)
+            EXPECT_NEAR(actual[i], expected[i], 1e-5f);
+    }
+
+    TEST(TransformHierarchyTests, Add_Child_IsStoredAfterParentsSubtree)
+    {
+        // Arrange
+        TransformHierarchy hierarchy;
+        size_t root = hierarchy.Add(Transform());
+        size_t otherRoot = hierarchy.Add(Transform());
+        size_t firstChild = hierarchy.Add(Transform(), root);
+
+        // Act
+        size_t secondChild = hierarchy.Add(Transform(), root);
+
+        // Assert
+        EXPECT_EQ(root, 0u);
+        EXPECT_EQ(firstChild, 1u);
+        EXPECT_EQ(secondChild, 2u);
+        EXPECT_EQ(otherRoot, 1u); // Was shifted by the inserted children
+        EXPECT_EQ(hierarchy.GetParent(1), root);
+        EXPECT_EQ(hierarchy.GetParent(2), root);
+        EXPECT_EQ(hierarchy.GetParent(3), TransformHierarchy::NoParent);
+        EXPECT_EQ(hierarchy.GetDescendantCount(root), 2u);
+    }
+
+    TEST(TransformHierarchyTests, UpdateWorldMatrices_CombinesParentAndLocal)
+    {
+        // Arrange
+        TransformHierarchy hierarchy;
+        Transform parentLocal(Vector3(1.0f, 2.0f, 3.0f), Quaternion::FromEuler(0.0f, 90.0f, 0.0f), Vector3(2.0f));
+        Transform childLocal(Vector3(0.0f, 0.0f, 1.0f), Quaternion::FromEuler(45.0f, 0.0f, 0.0f), Vector3(1.0f));
+        size_t parent = hierarchy.Add(parentLocal);
+        size_t child = hierarchy.Add(childLocal, parent);
+
+        // Act
+        size_t updated = hierarchy.UpdateWorldMatrices();
+
+        // Assert
+        Mat4x4 parentWorld = Mat4x4::FromTRS(parentLocal.Position, parentLocal.Rotation, parentLocal.Scale);
+        Mat4x4 childWorld = parentWorld * Mat4x4::FromTRS(childLocal.Position, childLocal.Rotation, childLocal.Scale);
+        EXPECT_EQ(updated, 2u);
+        ExpectMatrixNear(hierarchy.GetWorld(parent), parentWorld);
+        ExpectMatrixNear(hierarchy.GetWorld(child), childWorld);
+    }
+
+    TEST(TransformHierarchyTests, UpdateWorldMatrices_OnlyUpdatesDirtySubtrees)
+    {
+        // Arrange
+        TransformHierarchy hierarchy;
+        size_t staticRoot = hierarchy.Add(Transform());
+        hierarchy.Add(Transform(), staticRoot);
+        size_t movingRoot = hierarchy.Add(Transform());
+        size_t movingChild = hierarchy.Add(Transform(Vector3(0.0f, 1.0f, 0.0f), Quaternion(), Vector3(1.0f)), movingRoot);
+        hierarchy.UpdateWorldMatrices();
+
+        // Act
+        hierarchy.SetLocal(movingRoot, Transform(Vector3(5.0f, 0.0f, 0.0f), Quaternion(), Vector3(1.0f)));
+        size_t updated = hierarchy.UpdateWorldMatrices();
+
+        // Assert
+        EXPECT_EQ(updated, 2u);
+        EXPECT_FALSE(hierarchy.IsDirty(movingRoot));
+        EXPECT_FLOAT_EQ(hierarchy.GetWorld(movingChild)(3, 0), 5.0f);
+        EXPECT_FLOAT_EQ(hierarchy.GetWorld(movingChild)(3, 1), 1.0f);
+        EXPECT_EQ(hierarchy.UpdateWorldMatrices(), 0u);
+    }
+
+    TEST(TransformHierarchyTests, Remove_RemovesWholeSubtree)
+    {
+        // Arrange
+        TransformHierarchy hierarchy;
+        size_t root = hierarchy.Add(Transform());
+        size_t child = hierarchy.Add(Transform(), root);
+        hierarchy.Add(Transform(), child);
+        hierarchy.Add(Transform());
+        size_t lastChild = hierarchy.Add(Transform(), 3);
+
+        // Act
+        hierarchy.Remove(child);
+
+        // Assert
+        EXPECT_EQ(hierarchy.Size(), 3u);
+        EXPECT_EQ(hierarchy.GetDescendantCount(root), 0u);
+        EXPECT_EQ(lastChild, 4u);
+        EXPECT_EQ(hierarchy.GetParent(2), 1u); // The last child's parent index shifted down with it
+    }
+
+    TEST(TransformHierarchyTests, Accessors_WithOutOfRangeIndex_Throw)
+    {
+        // Arrange
+        TransformHierarchy hierarchy;
+        size_t root = hierarchy.Add(Transform());
+        hierarchy.Add(Transform(), root);
+
+        // Act & Assert
+        EXPECT_THROW(hierarchy.GetLocal(2), std::out_of_range);
+        EXPECT_THROW(hierarchy.SetLocal(2, Transform()), std::out_of_range);
+        EXPECT_THROW(hierarchy.GetWorld(2), std::out_of_range);
+        EXPECT_THROW(hierarchy.GetParent(2), std::out_of_range);
+        EXPECT_THROW(hierarchy.GetDescendantCount(2), std::out_of_range);
+        EXPECT_THROW(hierarchy.GetDepth(2), std::out_of_range);
+        EXPECT_THROW(hierarchy.IsDirty(2), std::out_of_range);
+        EXPECT_THROW(hierarchy.Remove(2), std::out_of_range);
+        EXPECT_NO_THROW(hierarchy.GetWorld(1));
+    }
+
+    TEST(TransformHierarchyTests, ParallelUpdates_MatchSingleThreadedUpdate)
+    {
+        // Arrange
+        TransformHierarchy serial;
+        for (int root = 0; root < 50; root++)
+        {
+            const auto f = static_cast<float>(root);
+            size_t rootIndex = serial.Add(Transform(Vector3(f, 0.0f, 0.0f), Quaternion::FromEuler(0.0f, f * 10.0f, 0.0f), Vector3(1.0f)));
+            for (int child = 0; child < 10; child++)
+            {
+                size_t childIndex = serial.Add(Transform(Vector3(0.0f, 1.0f, 0.0f), Quaternion::FromEuler(f, 0.0f, 0.0f), Vector3(1.5f)), rootIndex);
+                serial.Add(Transform(Vector3(0.0f, 0.0f, 2.0f), Quaternion(), Vector3(0.5f)), childIndex);
+            }
+        }
+        TransformHierarchy parallelFull = serial;
+        TransformHierarchy parallelIncremental = serial;
+        ThreadPool pool(4);
+
+        // Act
+        serial.UpdateAllWorldMatrices();
+        parallelFull.UpdateAllWorldMatrices(pool);
+        size_t updated = parallelIncremental.UpdateWorldMatrices(pool);
+
+        // Assert
+        EXPECT_EQ(updated, serial.Size());
+        for (size_t i = 0; i < serial.Size(); i++)
+        {
+            EXPECT_EQ(parallelFull.GetWorld(i), serial.GetWorld(i));
+            EXPECT_EQ(parallelIncremental.GetWorld(i), serial.GetWorld(i));
+        }
+    }
+
+    TEST(TransformHierarchyTests, ParallelUpdate_WithOneLargeDirtySubtree_MatchesSingleThreadedUpdate)
+    {
+        // Arrange
+        TransformHierarchy serial;
+        size_t staticRoot = serial.Add(Transform());
+        serial.Add(Transform(Vector3(1.0f, 0.0f, 0.0f), Quaternion(), Vector3(1.0f)), staticRoot);
+        size_t sceneRoot = serial.Add(Transform());
+        for (int child = 0; child < 100; child++)
+        {
+            const auto f = static_cast<float>(child);
+            size_t childIndex = serial.Add(Transform(Vector3(f, 1.0f, 0.0f), Quaternion::FromEuler(0.0f, f, 0.0f), Vector3(1.0f)), sceneRoot);
+            for (int leaf = 0; leaf < 50; leaf++)
+            {
+                serial.Add(Transform(Vector3(0.0f, 0.0f, 2.0f), Quaternion::FromEuler(f, 0.0f, 0.0f), Vector3(0.5f)), childIndex);
+            }
+        }
+        serial.UpdateWorldMatrices();
+        ASSERT_GE(serial.GetDescendantCount(sceneRoot) + 1, TransformHierarchy::LargeSubtreeSize);
+
+        TransformHierarchy parallel = serial;
+        ThreadPool pool(4);
+        const Transform moved(Vector3(5.0f, 0.0f, 0.0f), Quaternion::FromEuler(0.0f, 30.0f, 0.0f), Vector3(2.0f));
+        serial.SetLocal(sceneRoot, moved);
+        serial.SetLocal(1, moved);
+        parallel.SetLocal(sceneRoot, moved);
+        parallel.SetLocal(1, moved);
+
+        // Act
+        size_t serialUpdated = serial.UpdateWorldMatrices();
+        size_t parallelUpdated = parallel.UpdateWorldMatrices(pool);
+
+        // Assert
+        EXPECT_EQ(parallelUpdated, serialUpdated);
+        for (size_t i = 0; i < serial.Size(); i++)
+        {
+            EXPECT_EQ(parallel.GetWorld(i), serial.GetWorld(i));
+            EXPECT_FALSE(parallel.IsDirty(i));
+        }
+    }
+}
@@ -1,6 +1,8 @@
 ﻿#include "PCH.h"
 #include "Tbx/Math/Vectors.h"
 #include "Tbx/Math/Constants.h"
+#include <cstring>
+#include <limits>
 
 namespace Tbx::Tests::Core::Math
 {
@@ -148,4 +150,215 @@ namespace Tbx::Tests::Core::Math
         EXPECT_EQ(v.X, 1);
         EXPECT_EQ(v.Y, 1);
     }
-}
\ No newline at end of file
+
+    TEST(Vector3ATests, Layout_IsSixteenBytesAndAligned)
+    {
+        // Arrange
+        std::vector<Vector3A> vectors(3);
+
+        // Act
+        const auto address = reinterpret_cast<uintptr_t>(&vectors[1]);
+
+        // Assert
+        EXPECT_EQ(sizeof(Vector3A), 16u);
+        EXPECT_EQ(alignof(Vector3A), 16u);
+        EXPECT_EQ(address % 16, 0u);
+    }
+
+    TEST(Vector3ATests, Operators_MatchVector3)
+    {
+        // Arrange
+        Vector3 a(1, 2, 3);
+        Vector3 b(4, -5, 6);
+        Vector3A alignedA = a;
+        Vector3A alignedB = b;
+
+        // Act
+        Vector3A sum = alignedA + alignedB;
+        Vector3A difference = alignedA - alignedB;
+        Vector3A product = alignedA * alignedB;
+        Vector3A scaled = alignedA * 2.0f;
+        Vector3A accumulated = alignedA;
+        accumulated += alignedB;
+        accumulated *= 0.5f;
+
+        // Assert
+        EXPECT_EQ(sum, Vector3A(a + b));
+        EXPECT_EQ(difference, Vector3A(a - b));
+        EXPECT_EQ(product, Vector3A(a * b));
+        EXPECT_EQ(scaled, Vector3A(a * 2.0f));
+        EXPECT_EQ(accumulated, Vector3A(2.5f, -1.5f, 4.5f));
+        EXPECT_FLOAT_EQ(Vector3A::Dot(alignedA, alignedB), Vector3::Dot(a, b));
+        EXPECT_EQ(static_cast<Vector3>(Vector3A::Cross(alignedA, alignedB)).ToString(), Vector3::Cross(a, b).ToString());
+    }
+
+    TEST(Vector3ATests, Normalize_ReturnsNormalizedVector)
+    {
+        // Arrange
+        Vector3A v(3, 0, 4);
+
+        // Act
+        Vector3A result = Vector3A::Normalize(v);
+
+        // Assert
+        EXPECT_NEAR(result.X, 0.6f, 1e-5f);
+        EXPECT_NEAR(result.Y, 0.0f, 1e-5f);
+        EXPECT_NEAR(result.Z, 0.8f, 1e-5f);
+        EXPECT_EQ(result.ToString(), Vector3A(0.6f, 0.0f, 0.8f).ToString());
+    }
+
+    TEST(Vector3ATests, ScalarOperators_KeepPaddingZero)
+    {
+        // Arrange
+        Vector3A v(1, -2, 3);
+
+        // Act
+        Vector3A scaled = v * std::numeric_limits<float>::infinity();
+        Vector3A divided = v / 0.0f;
+        float scaledLanes[4] = {};
+        float dividedLanes[4] = {};
+        std::memcpy(scaledLanes, &scaled, sizeof(scaled));
+        std::memcpy(dividedLanes, &divided, sizeof(divided));
+
+        // Assert
+        EXPECT_EQ(scaledLanes[3], 0.0f);
+        EXPECT_EQ(dividedLanes[3], 0.0f);
+        EXPECT_EQ(scaled.Y, -std::numeric_limits<float>::infinity());
+        EXPECT_FLOAT_EQ(Vector3A::Dot(-v, Vector3A(1)), -2.0f);
+    }
+
+    TEST(Vector4Tests, Operators_WorkComponentWise)
+    {
+        // Arrange
+        Vector4 a(1, 2, 3, 4);
+        Vector4 b(5, 6, 7, 8);
+
+        // Act
+        Vector4 sum = a + b;
+        Vector4 difference = b - a;
+        Vector4 product = a * b;
+        Vector4 scaled = a * 3.0f;
+        float dot = Vector4::Dot(a, b);
+
+        // Assert
+        EXPECT_EQ(sum, Vector4(6, 8, 10, 12));
+        EXPECT_EQ(difference, Vector4(4));
+        EXPECT_EQ(product, Vector4(5, 12, 21, 32));
+        EXPECT_EQ(scaled, Vector4(3, 6, 9, 12));
+        EXPECT_FLOAT_EQ(dot, 70.0f);
+        EXPECT_EQ(Vector4(Vector3(1, 2, 3), 1).ToString(), "(1, 2, 3, 1)");
+        EXPECT_EQ(sizeof(Vector4), 16u);
+        EXPECT_EQ(alignof(Vector4), 16u);
+    }
+
+    TEST(Vector4Tests, Normalize_ReturnsUnitLengthVector)
+    {
+        // Arrange
+        Vector4 v(1, 1, 1, 1);
+
+        // Act
+        Vector4 result = Vector4::Normalize(v);
+
+        // Assert
+        EXPECT_NEAR(result.X, 0.5f, 1e-6f);
+        EXPECT_NEAR(result.W, 0.5f, 1e-6f);
+        EXPECT_NEAR(Vector4::Dot(result, result), 1.0f, 1e-6f);
+    }
+
+    TEST(Vector2Tests, Arithmetic_MatchesVector3)
+    {
+        // Arrange
+        Vector2 a(1, 2);
+        Vector2 b(3, -4);
+
+        // Act
+        Vector2 sum = a + b;
+        Vector2 product = a * b;
+        Vector2 scaled = 2.0f * a;
+        float dot = Vector2::Dot(a, b);
+        Vector2 normalized = Vector2::Normalize(b);
+
+        // Assert
+        EXPECT_EQ(sum, Vector2(4, -2));
+        EXPECT_EQ(product, Vector2(3, -8));
+        EXPECT_EQ(scaled, Vector2(2, 4));
+        EXPECT_FLOAT_EQ(dot, -5.0f);
+        EXPECT_FLOAT_EQ(normalized.X, 0.6f);
+        EXPECT_FLOAT_EQ(normalized.Y, -0.8f);
+    }
+
+    TEST(Vector3DTests, DoublePrecision_KeepsDigitsFloatsLose)
+    {
+        // Arrange
+        Vector3D position(1e8, 2e8, 3e8);
+        Vector3D offset(0.25, 0.5, 0.75);
+
+        // Act
+        Vector3D moved = position + offset;
+        Vector3D back = moved - position;
+        Vector3D cross = Vector3D::Cross({ 1, 0, 0 }, { 0, 1, 0 });
+
+        // Assert
+        EXPECT_EQ(back, offset);
+        EXPECT_EQ(cross, Vector3D(0, 0, 1));
+        EXPECT_NEAR(Vector3D::Normalize(Vector3D(3, 0, 4)).Z, 0.8, 1e-15);
+        EXPECT_EQ(Vector3(Vector3D(1.5, 2.5, 3.5)), Vector3(1.5f, 2.5f, 3.5f));
+        EXPECT_EQ(sizeof(Vector3D), 24u);
+        EXPECT_EQ(alignof(Vector4D), 32u);
+    }
+
+    TEST(Vector3ITests, IntegerArithmetic_IsExact)
+    {
+        // Arrange
+        Vector3I a(1, -2, 3);
+        Vector3I b(4, 5, -6);
+
+        // Act
+        Vector3I sum = a + b;
+        Vector3I cross = Vector3I::Cross(a, b);
+        int dot = Vector3I::Dot(a, b);
+
+        // Assert
+        EXPECT_EQ(sum, Vector3I(5, 3, -3));
+        EXPECT_EQ(cross, Vector3I(-3, 18, 13));
+        EXPECT_EQ(dot, -24);
+        EXPECT_EQ((Vector2I(7, 9) / 2).ToString(), "(3, 4)");
+    }
+
+    TEST(Vector4ITests, IntegerArithmetic_IsExact)
+    {
+        // Arrange
+        Vector4I a(1, -2, 3, 70000);
+        Vector4I b(4, 5, -6, 30000);
+
+        // Act
+        Vector4I sum = a + b;
+        Vector4I difference = a - b;
+        Vector4I product = a * b;
+        int dot = Vector4I::Dot(a, b);
+
+        // Assert
+        EXPECT_EQ(sum, Vector4I(5, 3, -3, 100000));
+        EXPECT_EQ(difference, Vector4I(-3, -7, 9, 40000));
+        EXPECT_EQ(product, Vector4I(4, -10, -18, 2100000000));
+        EXPECT_EQ(dot, 2099999976);
+        EXPECT_EQ(alignof(Vector4I), 16u);
+    }
+
+    TEST(VecTests, LongVectors_StoreComponentsInValues)
+    {
+        // Arrange
+        constexpr Vec<float, 6> a(1, 2, 3, 4, 5, 6);
+        constexpr Vec<float, 6> b(1);
+
+        // Act
+        Vec<float, 6> sum = a + b;
+        float dot = Vec<float, 6>::Dot(a, b);
+
+        // Assert
+        static_assert(a.Values[5] == 6.0f && b.Values[0] == 1.0f);
+        EXPECT_EQ(sum.ToString(), "(2, 3, 4, 5, 6, 7)");
+        EXPECT_FLOAT_EQ(dot, 21.0f);
+        EXPECT_EQ(sizeof(Vec<float, 6>), 6 * sizeof(float));
+    }
+}
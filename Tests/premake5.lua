@@ -30,4 +30,11 @@ project "Glm Math Plugin Tests"
         "googletest",
         "googlemock",
         "Glm Maths"
-    }
\ No newline at end of file
+    }
+
+    filter "options:tbx-math-inline"
+        defines
+        {
+            "TBX_MATH_INLINE"
+        }
+    filter {}
@@ -1,3 +1,15 @@
+newoption
+{
+    trigger = "tbx-math-inline",
+    description = "Defines the hot Glm Maths arithmetic inline in the headers (TBX_MATH_INLINE)"
+}
+
+newoption
+{
+    trigger = "tbx-math-fast-trig",
+    description = "Routes Math::Sin, Cos, Tan, ASin, ACos and ATan to the polynomial approximations (TBX_MATH_FAST_TRIG)"
+}
+
 project "Glm Maths"
     kind "StaticLib"
     language "C++"
@@ -22,6 +34,7 @@ project "Glm Maths"
         "./Include/**.c",
         "./Include/**.cc",
         "./Include/**.hpp",
+        "./Include/**.inl",
         "./Include/**.cpp",
         "./**.plugin",
         "./**.md",
@@ -45,4 +58,18 @@ project "Glm Maths"
         "GLM_ENABLE_EXPERIMENTAL",
         "GLM_FORCE_LEFT_HANDED",
         "GLM_DEPTH_ZERO_TO_ONE"
-    }
\ No newline at end of file
+    }
+
+    filter "options:tbx-math-inline"
+        defines
+        {
+            "TBX_MATH_INLINE"
+        }
+    filter {}
+
+    filter "options:tbx-math-fast-trig"
+        defines
+        {
+            "TBX_MATH_FAST_TRIG"
+        }
+    filter {}